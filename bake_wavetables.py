@@ -0,0 +1,87 @@
+"""
+Bakes single-cycle WAV files into one raw float blob (.nwt) for embedding as BinaryData,
+so plugin instances never run the audio file decoders. Called by the synth CMakeLists at
+build time; run by hand with:  python bake_wavetables.py out.nwt waves-1/*.wav
+
+Layout (little-endian):
+    "NWTB", u32 version, u32 table count
+    per table: u16 name length, UTF-8 name, u32 sample count, float32 samples
+"""
+import os
+import struct
+import sys
+
+VERSION = 1
+
+
+def read_wav_first_channel(path):
+    with open(path, "rb") as f:
+        data = f.read()
+
+    if data[0:4] != b"RIFF" or data[8:12] != b"WAVE":
+        raise ValueError(f"{path}: not a RIFF/WAVE file")
+
+    fmt = None
+    samples = None
+    pos = 12
+    while pos + 8 <= len(data):
+        chunk_id = data[pos:pos + 4]
+        size = struct.unpack_from("<I", data, pos + 4)[0]
+        body = data[pos + 8:pos + 8 + size]
+        if chunk_id == b"fmt ":
+            fmt = list(struct.unpack_from("<HHIIHH", body, 0))
+            if fmt[0] == 0xFFFE and len(body) >= 26:
+                # WAVE_FORMAT_EXTENSIBLE: the sub-format GUID starts with the real tag
+                fmt[0] = struct.unpack_from("<H", body, 24)[0]
+        elif chunk_id == b"data":
+            samples = body
+        pos += 8 + size + (size & 1)
+
+    if fmt is None or samples is None:
+        raise ValueError(f"{path}: missing fmt or data chunk")
+
+    format_tag, channels, _, _, _, bits = fmt
+
+    frame_bytes = channels * bits // 8
+    num_frames = len(samples) // frame_bytes
+    out = []
+    for i in range(num_frames):
+        offset = i * frame_bytes
+        if format_tag == 3 and bits == 32:
+            value = struct.unpack_from("<f", samples, offset)[0]
+        elif bits == 8:
+            value = (samples[offset] - 128) / 128.0
+        elif bits == 16:
+            value = struct.unpack_from("<h", samples, offset)[0] / 32768.0
+        elif bits == 24:
+            raw = int.from_bytes(samples[offset:offset + 3], "little", signed=True)
+            value = raw / 8388608.0
+        elif bits == 32:
+            value = struct.unpack_from("<i", samples, offset)[0] / 2147483648.0
+        else:
+            raise ValueError(f"{path}: unsupported {bits}-bit format {format_tag}")
+        out.append(value)
+    return out
+
+
+def bake(output_path, wav_paths):
+    blob = bytearray(b"NWTB")
+    blob += struct.pack("<II", VERSION, len(wav_paths))
+
+    for path in wav_paths:
+        name = os.path.splitext(os.path.basename(path))[0].encode("utf-8")
+        samples = read_wav_first_channel(path)
+        blob += struct.pack("<H", len(name)) + name
+        blob += struct.pack("<I", len(samples))
+        blob += struct.pack(f"<{len(samples)}f", *samples)
+
+    os.makedirs(os.path.dirname(os.path.abspath(output_path)), exist_ok=True)
+    with open(output_path, "wb") as f:
+        f.write(blob)
+
+
+if __name__ == "__main__":
+    if len(sys.argv) < 3:
+        print("usage: bake_wavetables.py <output.nwt> <wav files...>")
+        sys.exit(1)
+    bake(sys.argv[1], sys.argv[2:])
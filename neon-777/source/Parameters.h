@@ -0,0 +1,65 @@
+#pragma once
+#include <neon_ui_components/neon_ui_components.h>
+#include <neon_ui_components/modules/LfoModule.h>
+#include <neon_ui_components/modules/ArpModule.h>
+#include <neon_ui_components/modules/FxModule.h>
+#include <neon_ui_components/modules/ControlModule.h>
+#include <neon_ui_components/modules/ModMatrixModule.h>
+#include <neon_ui_components/modules/NoiseModule.h>
+#include <neon_ui_components/modules/SubOscModule.h>
+
+namespace neon
+{
+    /**
+     * addNeon777OscillatorParameters
+     * The two FM oscillators have no module class of their own; the editor shows them in a
+     * plain ModuleBase. defaultRatio indexes the Ratio choices.
+     */
+    static inline void addNeon777OscillatorParameters (ParameterLayout& layout, int defaultRatio)
+    {
+        std::vector<juce::String> fmRatios = {"0.5", "1.0", "1.5", "2.0", "3.0", "4.0", "5.0", "6.0", "7.0", "8.0", "9.0", "10.0", "11.0", "12.0", "14.0", "16.0"};
+
+        layout.addChoiceParameter ("Ratio", fmRatios, defaultRatio);
+        layout.addParameter ("Depth", 0.0f, 1.0f, 0.0f);
+        layout.addParameter ("Volume", 0.0f, 1.0f, 0.8f);
+        layout.addParameter ("Octave", -2.0f, 2.0f, 0.0f, false, 1.0f);
+        layout.addParameter ("Detune", -100.0f, 100.0f, 0.0f);
+        layout.addParameter ("Unison", 1.0f, 4.0f, 1.0f, false, 1.0f);
+        layout.addParameter ("USpread", 0.0f, 1.0f, 0.2f);
+        layout.addParameter ("Pan", -1.0f, 1.0f, 0.0f);
+
+        layout.addSpacer();
+        layout.addParameter ("KeySync", 0.0f, 1.0f, 1.0f, true);
+    }
+
+    /**
+     * addNeon777Parameters
+     * Every Neon 777 parameter, registered by the processor before the first patch loads.
+     * Same modules as Neon Jr, with the two FM oscillators above in place of the wavetable one.
+     */
+    static inline void addNeon777Parameters (NeonInstance& instance)
+    {
+        auto& registry = instance.getParameterRegistry();
+        const auto& names = instance.getRegistry();
+
+        { ParameterLayout l (registry, "Oscillator 1");  addNeon777OscillatorParameters (l, 1); } // 1.0
+        { ParameterLayout l (registry, "Oscillator 2");  addNeon777OscillatorParameters (l, 3); } // 2.0
+        { ParameterLayout l (registry, "Sub Osc");       SubOscModule::addParameters (l); }
+        { ParameterLayout l (registry, "Noise");         NoiseModule::addParameters (l); }
+        { ParameterLayout l (registry, "Ladder Filter"); LadderFilterModule::addParameters (l, names); }
+        { ParameterLayout l (registry, "Amp Output");    AmpModule::addParameters (l); }
+        { ParameterLayout l (registry, "Pitch Env");     DahdsrModule::addParameters (l, false, true); }
+        { ParameterLayout l (registry, "Filter Env");    DahdsrModule::addParameters (l, false, true); }
+        { ParameterLayout l (registry, "Mod Env");       DahdsrModule::addParameters (l); DahdsrModule::addModSlotParameters (l, names); }
+        { ParameterLayout l (registry, "Amp Env");       DahdsrModule::addParameters (l); }
+        { ParameterLayout l (registry, "LFO 1");         LfoModule::addParameters (l, names); }
+        { ParameterLayout l (registry, "LFO 2");         LfoModule::addParameters (l, names); }
+        { ParameterLayout l (registry, "Arp");           ArpModule::addParameters (l); }
+        { ParameterLayout l (registry, "Mod");           ModMatrixModule::addParameters (l, names); }
+        { ParameterLayout l (registry, "FX");            FxModule::addParameters (l); }
+        { ParameterLayout l (registry, "Control");       ControlModule::addParameters (l, true, true); }
+        { ParameterLayout l (registry, "Librarian");     LibrarianModule::addParameters (l); }
+
+        registry.setLayoutComplete();
+    }
+}
@@ -1,6 +1,7 @@
 #include "PluginProcessor.h"
 #include "PluginEditor.h"
 #include "ModulationTargets.h"
+#include "Parameters.h"
 #include <neon_ui_components/modules/LfoModule.h>
 #include <neon_ui_components/modules/ArpModule.h>
 #include <neon_ui_components/modules/FxModule.h>
@@ -16,94 +17,47 @@ namespace neon
     {
         setLookAndFeel (&lookAndFeel);
 
-        auto theme = NeonRegistry::getTheme();
+        auto& instance = p.getNeonInstance();
+        auto theme = instance.getRegistry().getTheme();
 
         selectionPanel.setCategoryNames ({ "OSC", "FILTER", "AMP", "M/FX", "MAIN" });
         selectionPanel.setButtonColors (juce::Colour (0xFFFF00FF), juce::Colour (0xFF808080));
         addAndMakeVisible (selectionPanel);
         
-        std::vector<juce::String> fmRatios = {"0.5", "1.0", "1.5", "2.0", "3.0", "4.0", "5.0", "6.0", "7.0", "8.0", "9.0", "10.0", "11.0", "12.0", "14.0", "16.0"};
-
-        // Modules
-        auto osc1 = std::make_unique<ModuleBase> ("Oscillator 1", theme.oscillator);
-        osc1->addChoiceParameter ("Ratio", fmRatios, 1); // 1.0 default
-        osc1->addParameter ("Depth", 0.0f, 1.0f, 0.0f);
-        osc1->addParameter ("Volume", 0.0f, 1.0f, 0.8f);
-        osc1->addParameter ("Octave", -2.0f, 2.0f, 0.0f, false, 1.0f);
-        osc1->addParameter ("Detune", -100.0f, 100.0f, 0.0f);
-        osc1->addParameter ("Unison", 1.0f, 4.0f, 1.0f, false, 1.0f);
-        osc1->addParameter ("USpread", 0.0f, 1.0f, 0.2f);
-        osc1->addParameter ("Pan", -1.0f, 1.0f, 0.0f);
-        
-        osc1->addSpacer(); 
-        osc1->addParameter ("KeySync", 0.0f, 1.0f, 1.0f, true);
-
-        auto osc2 = std::make_unique<ModuleBase> ("Oscillator 2", theme.oscillator);
-        osc2->addChoiceParameter ("Ratio", fmRatios, 3); // 2.0 default
-        osc2->addParameter ("Depth", 0.0f, 1.0f, 0.0f);
-        osc2->addParameter ("Volume", 0.0f, 1.0f, 0.8f);
-        osc2->addParameter ("Octave", -2.0f, 2.0f, 0.0f, false, 1.0f);
-        osc2->addParameter ("Detune", -100.0f, 100.0f, 0.0f);
-        osc2->addParameter ("Unison", 1.0f, 4.0f, 1.0f, false, 1.0f);
-        osc2->addParameter ("USpread", 0.0f, 1.0f, 0.2f);
-        osc2->addParameter ("Pan", -1.0f, 1.0f, 0.0f);
-
-        osc2->addSpacer();
-        osc2->addParameter ("KeySync", 0.0f, 1.0f, 1.0f, true);
-
-        auto subOsc = std::make_unique<SubOscModule> ("Sub Osc", theme.oscillator);
-        auto noise = std::make_unique<NoiseModule> ("Noise", theme.oscillator);
-        auto filter = std::make_unique<LadderFilterModule> ("Ladder Filter", theme.filter);
-        auto amp = std::make_unique<AmpModule> ("Amp Output", theme.amplifier);
+        // Modules: the parameters already exist (see addNeon777Parameters), each module adds its cards
+        auto osc1 = std::make_unique<ModuleBase> (instance, "Oscillator 1", theme.oscillator);
+        addNeon777OscillatorParameters (*osc1, 1); // 1.0 default
+
+        auto osc2 = std::make_unique<ModuleBase> (instance, "Oscillator 2", theme.oscillator);
+        addNeon777OscillatorParameters (*osc2, 3); // 2.0 default
+
+        auto subOsc = std::make_unique<SubOscModule> (instance, "Sub Osc", theme.oscillator);
+        auto noise = std::make_unique<NoiseModule> (instance, "Noise", theme.oscillator);
+        auto filter = std::make_unique<LadderFilterModule> (instance, "Ladder Filter", theme.filter);
+        auto amp = std::make_unique<AmpModule> (instance, "Amp Output", theme.amplifier);
         
-        auto envPitch = std::make_unique<DahdsrModule> ("Pitch Env", theme.envelope, false, true);  // Include modulation parameters
-        auto envFilter = std::make_unique<DahdsrModule> ("Filter Env", theme.envelope, false, true); // Include modulation parameters
-        auto envMod = std::make_unique<DahdsrModule> ("Mod Env", theme.envelope, false);  // No modulation parameters
-        auto envAmp = std::make_unique<DahdsrModule> ("Amp Env", theme.envelope, false);  // No modulation parameters
+        auto envPitch = std::make_unique<DahdsrModule> (instance, "Pitch Env", theme.envelope, false, true);  // Include modulation parameters
+        auto envFilter = std::make_unique<DahdsrModule> (instance, "Filter Env", theme.envelope, false, true); // Include modulation parameters
+        auto envMod = std::make_unique<DahdsrModule> (instance, "Mod Env", theme.envelope, false);  // No modulation parameters
+        auto envAmp = std::make_unique<DahdsrModule> (instance, "Amp Env", theme.envelope, false);  // No modulation parameters
+        DahdsrModule::addModSlotParameters (*envMod, instance.getRegistry());
 
-        auto lfo1 = std::make_unique<LfoModule> ("LFO 1", theme.modulation);
-        auto lfo2 = std::make_unique<LfoModule> ("LFO 2", theme.modulation);
+        auto lfo1 = std::make_unique<LfoModule> (instance, "LFO 1", theme.modulation);
+        auto lfo2 = std::make_unique<LfoModule> (instance, "LFO 2", theme.modulation);
 
-        auto arp = std::make_unique<ArpModule> ("Arp", theme.modulation);
+        auto arp = std::make_unique<ArpModule> (instance, "Arp", theme.modulation);
 
         // Control Matrix Module (Now renamed to MOD)
-        // 4-slot modulation matrix with [Source][Target][Amount]
-        auto modMatrix = std::make_unique<ModMatrixModule> ("Mod", theme.modulation);
-        auto targets = getModTargetNames();
-        std::vector<juce::String> sources = {"None", "Velocity", "Aftertouch", "Note#", 
-                                             "CC 1 (Mod Wheel)", "CC 11 (Expression)", "CC 2 (Breath)", 
-                                             "CC 4 (Foot Pedal)", "CC 64 (Sustain)",
-                                             "CC 16", "CC 17", "CC 18", "CC 19",
-                                             "CC 80", "CC 81", "CC 82", "CC 83"};
-
-        for (int i = 1; i <= 4; ++i)
-        {
-            modMatrix->addChoiceParameter ("Slot " + juce::String(i) + " Source", sources, 0);
-            modMatrix->addChoiceParameter ("Slot " + juce::String(i) + " Target", targets, 0);
-            modMatrix->addParameter       ("Slot " + juce::String(i) + " Amount", -100.0f, 100.0f, 0.0f);
-            modMatrix->addChoiceParameter (" ", {" "}, 0); // Spacer for alignment
-        }
+        auto modMatrix = std::make_unique<ModMatrixModule> (instance, "Mod", theme.modulation);
 
         // FX Module
-        auto fxModule = std::make_unique<FxModule> ("FX", theme.effects);
+        auto fxModule = std::make_unique<FxModule> (instance, "FX", theme.effects);
 
         // Global Controls Module
-        auto ctrlModule = std::make_unique<ControlModule> ("Control", theme.indicator);
+        auto ctrlModule = std::make_unique<ControlModule> (instance, "Control", theme.indicator, true, true);
 
         // Librarian Module
-        auto libModule = std::make_unique<LibrarianModule> ("Librarian", theme.background.brighter());
-
-        // ... (existing code continues)
-
-        // Page 1 has 7 cards (6 DAHDSR + 1 Mode). 
-        // We add one empty parameter to serve as a spacer to perfectly align the 4 Slot-pairs on Page 2.
-        envMod->addChoiceParameter (" ", {" "}, 0); 
-
-        for (int i = 1; i <= 4; ++i)
-        {
-            envMod->addChoiceParameter ("Slot " + juce::String(i) + " Target", targets, 0);
-            envMod->addParameter       ("Slot " + juce::String(i) + " Amount", -100.0f, 100.0f, 0.0f);
-        }
+        auto libModule = std::make_unique<LibrarianModule> (instance, "Librarian", theme.background.brighter());
 
         modules.add (osc1.release());        // 0 - OSC1
         modules.add (osc2.release());        // 1 - OSC2
@@ -156,6 +110,7 @@ namespace neon
 
         float pb = audioProcessor.getSignalPath().getPitchWheel();
         float mw = audioProcessor.getSignalPath().getModWheel();
+        const auto& governor = audioProcessor.getSignalPath().getCpuGovernor();
 
         for (auto* m : modules)
         {
@@ -163,7 +118,10 @@ namespace neon
             m->setVoiceCount (activeVoices);
             
             if (auto* ctrl = dynamic_cast<ControlModule*> (m))
+            {
                 ctrl->updateMeters (pb, mw, 0.0f); // Aftertouch is now per-voice, show 0 for global display
+                ctrl->updateCpuReport (governor.getLoad(), CpuGovernor::describe (governor.getDegradations()));
+            }
         }
     }
 
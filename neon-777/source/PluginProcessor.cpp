@@ -1,6 +1,7 @@
 #include "PluginProcessor.h"
 #include "PluginEditor.h"
 #include "ModulationTargets.h"
+#include "Parameters.h"
 #include <neon_ui_components/core/NeonPatchManager.h>
 
 namespace neon
@@ -8,11 +9,16 @@ namespace neon
     Neon777AudioProcessor::Neon777AudioProcessor()
         : AudioProcessor (BusesProperties().withOutput ("Output", juce::AudioChannelSet::stereo(), true))
     {
-        PatchManager::getInstance().initialize ("Neon777");
+        // Initialize modulation names for the UI components (shared by all instances)
+        static const auto targetNames = NeonRegistry::makeList (getNeon777ModTargetNames());
+        static const auto sourceNames = NeonRegistry::makeList (getNeon777CtrlSourceNames());
+        neonInstance.getRegistry().setTargetNames (targetNames);
+        neonInstance.getRegistry().setSourceNames (sourceNames);
 
-        // Initialize modulation names for the UI components
-        NeonRegistry::setTargetNames (getNeon777ModTargetNames());
-        NeonRegistry::setSourceNames (getNeon777CtrlSourceNames());
+        // Register the whole parameter set before the first patch is loaded into it
+        addNeon777Parameters (neonInstance);
+
+        neonInstance.getPatchManager().initialize ("Neon777");
     }
 
     Neon777AudioProcessor::~Neon777AudioProcessor()
@@ -38,6 +44,9 @@ namespace neon
         for (auto i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
             buffer.clear (i, 0, buffer.getNumSamples());
 
+        // Patches requested by Program Change / Bank Select in earlier blocks, parsed off-thread
+        neonInstance.getPatchManager().applyPendingProgramChange();
+
         // Sync keyboard state to midi buffer
         keyboardState.processNextMidiBuffer (midiMessages, 0, buffer.getNumSamples(), true);
 
@@ -55,47 +64,52 @@ namespace neon
         if (!midiMessages.isEmpty())
             midiActivity = true;
 
-        for (const auto metadata : midiMessages)
+        // Render up to each event's sample position, then apply it
+        const juce::AudioSourceChannelInfo info (&buffer, 0, buffer.getNumSamples());
+        signalPath.setNonRealtime (isNonRealtime()); // bounces render at the top quality tier
+        CpuGovernor::ScopedMeasurement measure (signalPath.getCpuGovernor(), info.numSamples);
+        signalPath.beginBlock (info.numSamples);
+        renderSplitAtMidi (midiMessages, info.numSamples,
+                           [&] (int start, int num) { signalPath.renderRange (info, start, num); },
+                           [this] (const juce::MidiMessage& msg) { handleMidiMessage (msg); });
+    }
+
+    void Neon777AudioProcessor::handleMidiMessage (const juce::MidiMessage& msg)
+    {
+        if (msg.isNoteOn())
+            signalPath.noteOn (msg.getNoteNumber(), msg.getFloatVelocity());
+        else if (msg.isNoteOff())
+            signalPath.noteOff (msg.getNoteNumber());
+        else if (msg.isAllNotesOff())
         {
-            const auto msg = metadata.getMessage();
-            if (msg.isNoteOn())
-                signalPath.noteOn (msg.getNoteNumber(), msg.getFloatVelocity());
-            else if (msg.isNoteOff())
-                signalPath.noteOff (msg.getNoteNumber());
-            else if (msg.isAllNotesOff())
-            {
-                for (int i = 0; i < 128; ++i) signalPath.noteOff(i);
-            }
-            else if (msg.isAllSoundOff())
-            {
-                for (int i = 0; i < 128; ++i) signalPath.noteOff(i);
-            }
-            else if (msg.isPitchWheel())
-                signalPath.setPitchWheel (juce::jmap ((float)msg.getPitchWheelValue(), 0.0f, 16383.0f, -1.0f, 1.0f));
-            else if (msg.isAftertouch())
-                signalPath.setPolyAftertouch (msg.getNoteNumber(), msg.getAfterTouchValue() / 127.0f);
-            else if (msg.isChannelPressure())
-                signalPath.setChannelAftertouch (msg.getChannelPressureValue() / 127.0f);
-            else if (msg.isController())
-            {
-                if (msg.getControllerNumber() == 1) // Mod Wheel
-                    signalPath.setModWheel (msg.getControllerValue() / 127.0f);
-                else if (msg.getControllerNumber() == 0 || msg.getControllerNumber() == 32)
-                {
-                    // Bank Select (CC 0 and 32 are standard for bank MSB/LSB)
-                    // We'll treat them as a combined bank index if needed, 
-                    // but for now let's just use the value.
-                    PatchManager::getInstance().selectBank (msg.getControllerValue());
-                }
-            }
-            else if (msg.isProgramChange())
+            for (int i = 0; i < 128; ++i) signalPath.noteOff(i);
+        }
+        else if (msg.isAllSoundOff())
+        {
+            for (int i = 0; i < 128; ++i) signalPath.noteOff(i);
+        }
+        else if (msg.isPitchWheel())
+            signalPath.setPitchWheel (juce::jmap ((float)msg.getPitchWheelValue(), 0.0f, 16383.0f, -1.0f, 1.0f));
+        else if (msg.isAftertouch())
+            signalPath.setPolyAftertouch (msg.getNoteNumber(), msg.getAfterTouchValue() / 127.0f);
+        else if (msg.isChannelPressure())
+            signalPath.setChannelAftertouch (msg.getChannelPressureValue() / 127.0f);
+        else if (msg.isController())
+        {
+            if (msg.getControllerNumber() == 1) // Mod Wheel
+                signalPath.setModWheel (msg.getControllerValue() / 127.0f);
+            else if (msg.getControllerNumber() == 0 || msg.getControllerNumber() == 32)
             {
-                PatchManager::getInstance().loadPatch (msg.getProgramChangeNumber());
+                // Bank Select (CC 0 and 32 are standard for bank MSB/LSB)
+                // We'll treat them as a combined bank index if needed, 
+                // but for now let's just use the value.
+                neonInstance.getPatchManager().requestBankSelect (msg.getControllerValue());
             }
         }
-
-        juce::AudioSourceChannelInfo info (&buffer, 0, buffer.getNumSamples());
-        signalPath.getNextAudioBlock (info);
+        else if (msg.isProgramChange())
+        {
+            neonInstance.getPatchManager().requestProgramChange (msg.getProgramChangeNumber());
+        }
     }
 
     juce::AudioProcessorEditor* Neon777AudioProcessor::createEditor()
@@ -33,13 +33,17 @@ namespace neon
         void getStateInformation (juce::MemoryBlock& destData) override {}
         void setStateInformation (const void* data, int sizeInBytes) override {}
 
+        NeonInstance& getNeonInstance() { return neonInstance; }
         SignalPath& getSignalPath() { return signalPath; }
         juce::MidiKeyboardState& getKeyboardState() { return keyboardState; }
 
         std::atomic<bool> midiActivity{ false };
 
     private:
-        SignalPath signalPath;
+        void handleMidiMessage (const juce::MidiMessage& msg);
+
+        NeonInstance neonInstance;
+        SignalPath signalPath { neonInstance };
         juce::MidiKeyboardState keyboardState;
 
         JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (Neon777AudioProcessor)
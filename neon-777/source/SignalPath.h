@@ -1,54 +1,61 @@
 #pragma once
 
 #include <juce_audio_basics/juce_audio_basics.h>
-#include <juce_audio_formats/juce_audio_formats.h>
 #include <juce_dsp/juce_dsp.h>
 #include <neon_ui_components/neon_ui_components.h>
-#include <atomic>
-#include <vector>
+#include "ModulationTargets.h"
 
 namespace neon
 {
+    /** Neon 777's oscillator section: two FM operator pairs with up to 4 unison voices each, and a square sub. */
+    struct FmSection
+    {
+        using Target = ModTarget;
+        static constexpr int numSmoothed = 4; // volume and pan of both oscillators
+
+        struct VoiceState
+        {
+            struct Pair
+            {
+                float carrierPhases[4] = {};
+                float modulatorPhases[4] = {};
+                float currentFrequency = 440.0f;
+
+                // Unison frequencies and pan gains, recomputed every control interval
+                float freqs[4] = {}, gainsL[4] = {}, gainsR[4] = {};
+            };
+
+            Pair osc1, osc2;
+            float subPhase = 0.0f;
+            Decimator decimatorL, decimatorR; // oscillator sum, when the quality tier oversamples
+
+            void reset()
+            {
+                for (auto* pair : { &osc1, &osc2 })
+                {
+                    std::fill (std::begin (pair->carrierPhases), std::end (pair->carrierPhases), 0.0f);
+                    std::fill (std::begin (pair->modulatorPhases), std::end (pair->modulatorPhases), 0.0f);
+                }
+                subPhase = 0.0f;
+                decimatorL.reset();
+                decimatorR.reset();
+            }
+        };
+    };
+
     /**
      * SignalPath
-     * The master audio engine for Neon Jr.
+     * The master audio engine for Neon 777: PolySignalPath with the FM oscillator pairs.
      * Polls the ParameterRegistry to drive the DSP.
      */
-    class SignalPath : public juce::AudioSource
+    class SignalPath : public PolySignalPath<SignalPath, FmSection>
     {
     public:
-        SignalPath();
+        explicit SignalPath (NeonInstance& instance);
         ~SignalPath() override = default;
 
-        void prepareToPlay (int samplesPerBlockExpected, double sampleRate) override;
-        void getNextAudioBlock (const juce::AudioSourceChannelInfo& bufferToFill) override;
-        void releaseResources() override;
-
-        void noteOn (int midiNote, float velocity);
-        void noteOff (int midiNote);
-        void setPolyAftertouch (int midiNote, float value);
-        void setChannelAftertouch (float value);
-        void setPitchWheel (float value) { pitchWheel = value; }
-        void setModWheel (float value) { modWheel = value; }
-        void setBpm (double newBpm) { bpm = newBpm; }
-
-        float getPitchWheel() const { return pitchWheel; }
-        float getModWheel() const { return modWheel; }
-        
-        int getActiveVoicesCount() const 
-        {
-            int count = 0;
-            for (auto& v : voices) if (v.isActive.load()) count++;
-            return count;
-        }
-
         struct FMOscState
         {
-            float carrierPhases[4] = {0.0f};
-            float modulatorPhases[4] = {0.0f};
-            float currentFrequency = 440.0f;
-            
-            // Parameter cache (polled from registry)
             int fmRatioIdx = 0;
             float fmIndex = 0.5f;
             float volume = 0.8f;
@@ -60,256 +67,73 @@ namespace neon
             float phaseStart = 0.0f;
             bool keySync = true;
 
-            // Legacy from Jr (keep for FX)
+            // Legacy from Jr (only drive is applied)
             float symmetry = 0.5f;
             float fold = 0.0f;
             float drive = 0.0f;
             float bitRedux = 0.0f;
         };
 
-        struct LfoSettings
-        {
-            int shape = 0; // Tri, RampUp, RampDn, Sq, S&H
-            bool syncMode = false; // false=Hz, true=Note
-            float rateHz = 1.0f;
-            int rateNoteIdx = 4;
-            bool keySync = true;
-            float phaseStart = 0.0f;
-            float delayMs = 0.0f;
-            float fadeMs = 0.0f; // NEW: Fade-in time
-            
-            struct ModSlot { float target = 0.0f; float amount = 0.0f; };
-            ModSlot slots[4];
-        };
-
-        struct LfoState
-        {
-            float phase = 0.0f;
-            float lastOutput = 0.0f;
-            bool sampleHoldTriggered = false;
-            double noteOnTime = -1.0;
-            
-            void reset(float startPhase, double onTime) { 
-                phase = startPhase; 
-                lastOutput = 0.0f; 
-                sampleHoldTriggered = false; 
-                noteOnTime = onTime;
-            }
-        };
+    private:
+        friend class PolySignalPath<SignalPath, FmSection>;
 
-        struct Voice
+        /** VoiceEngine policy: the two FM operator pairs and the square sub, for one control span. */
+        struct FmOscillators
         {
-            int midiNote = -1;
-            float velocity = 0.0f;
-            float aftertouch = 0.0f; // Poly aftertouch per voice
-            std::atomic<bool> isActive { false };
-            double noteOnTime = 0.0; // For voice stealing
-            
-            // Portamento/glide state
-            float targetFrequency = 440.0f;
-            float currentGlideFreq = 440.0f;
+            using Target = ModTarget;
+            static constexpr float mixGain = 0.33f;
 
-            FMOscState osc1;
-            FMOscState osc2;
-            float subPhase = 0.0f;
-            std::array<LfoState, 2> lfos;
-            juce::ADSR ampEnv, filterEnv, pitchEnv, modEnv;
-            juce::dsp::StateVariableTPTFilter<float> filter1;
-            juce::dsp::StateVariableTPTFilter<float> filter2;
-            
-            // XORshift noise generator state (ultra-cheap CPU)
-            uint32_t noiseState = 0x12345678;
+            const SignalPath& engine;
+            FMOscState settings1, settings2; // copies: volume and pan glide, one policy per control span
+            bool shaping = false;
 
-            // Decimation cache for CPU optimization
-            float u1Freqs[4], u1GainsL[4], u1GainsR[4];
-            float u2Freqs[4], u2GainsL[4], u2GainsR[4];
-            float mOsc1FM = 0, mOsc2FM = 0;
-            float mOsc1Pitch = 0, mOsc2Pitch = 0;
-            float mOsc1Sym = 0, mOsc1Fold = 0, mOsc1Drive = 0, mOsc1Bit = 0, mOsc1Lvl = 0, mOsc1Pan = 0;
-            float mOsc2Sym = 0, mOsc2Fold = 0, mOsc2Drive = 0, mOsc2Bit = 0, mOsc2Lvl = 0, mOsc2Pan = 0;
-            float mOsc1Det = 0, mOsc2Det = 0;
-            float mSubLevel = 0, mSubPitch = 0;
-            float mFiltCut = 0, mFiltRes = 0;
-            float mLfoAmts[2][4] = {{0.0f}};
-            int decimationCounter = 0;
+            bool isShaping() const noexcept { return shaping; }
+            void routeModulation (const float* sources, float* mods) const noexcept { engine.modRouting.apply (sources, mods); }
 
-            void reset()
+            void applyPitchBend (Voice& v, float semitones) const noexcept
             {
-                for (int i = 0; i < 4; ++i)
-                {
-                    osc1.carrierPhases[i] = 0.0f;
-                    osc1.modulatorPhases[i] = 0.0f;
-                    osc2.carrierPhases[i] = 0.0f;
-                    osc2.modulatorPhases[i] = 0.0f;
-                }
-                subPhase = 0.0f;
-                for (auto& l : lfos) l.reset(0.0f, -1.0);
-                
-                ampEnv.reset();
-                filterEnv.reset();
-                pitchEnv.reset();
-                modEnv.reset();
-                filter1.reset();
-                filter2.reset();
-                
-                for (int i = 0; i < 2; ++i)
-                    for (int j = 0; j < 4; ++j)
-                        mLfoAmts[i][j] = 0.0f;
+                v.mods[(size_t)ModTarget::Osc1Pitch] = semitones;
+                v.mods[(size_t)ModTarget::Osc2Pitch] = semitones;
+            }
 
-                noiseState = 0x12345678 + (uint32_t)(midiNote * 997);
-                isActive.store (false);
-                midiNote = -1;
+            void setFrequency (Voice& v, float hz) const noexcept
+            {
+                v.osc.osc1.currentFrequency = hz;
+                v.osc.osc2.currentFrequency = hz;
             }
-        };
 
-        struct ArpSettings
-        {
-            bool enabled = false;
-            int rateNoteIdx = 2;
-            int mode = 0;
-            int octaves = 1;
-            float gate = 0.8f;
-            bool latch = false;
+            template <bool Shaping>
+            void render (Voice& v, int s, float pitchEnv, float& left, float& right) const noexcept;
+            float renderSub (Voice& v, float level) const noexcept;
         };
 
-        struct ArpState
-        {
-            std::vector<int> heldNotes;
-            std::vector<int> sequence;
-            int sequenceIndex = 0;
-            double timer = 0.0;
-            int activeNote = -1;
-            bool gateOpen = false;
-            int physicalKeysDown = 0;
-
-            void reset() { heldNotes.clear(); sequence.clear(); sequenceIndex = 0; timer = 0.0; activeNote = -1; gateOpen = false; physicalKeysDown = 0; }
-        };
+        // PolySignalPath hooks
+        void bindOscillators();
+        void updateOscillators();
+        void applySmoothedOscillators();
+        void startOscillators (FmSection::VoiceState& osc, float frequency);
+        FmOscillators getOscillators() const;
+        static float getModUnitScale (ModTarget t);
 
-        struct FxSettings
-        {
-            int modType = 0; // 0=Off, 1=Chorus, 2=Phaser, 3=Flanger
-            float modRate = 1.0f;
-            float modDepth = 0.5f;
-            float modFeedback = 0.0f; // NEW: Modulation FX feedback
-            float modMix = 0.0f;
+        template <bool Shaping>
+        float renderOscSample (float& carrierPhase, float& modulatorPhase, float actualFreq, const FMOscState& settings) const noexcept;
 
-            float dlyTime = 400.0f;
-            int dlyNoteIdx = 4; // NEW: Delay note division index
-            float dlyFeedback = 0.3f;
-            float dlyMix = 0.0f;
-            bool dlySync = false;
+        enum OscSmoothedParam { smOsc1Volume = numSharedSmoothed, smOsc1Pan, smOsc2Volume, smOsc2Pan };
 
-            float rvbTime = 2.0f; // NEW: Reverb decay time
-            float rvbSize = 0.5f;
-            float rvbDamp = 0.5f;
-            float rvbPredelay = 0.0f; // NEW: Reverb predelay in ms
-            float rvbMix = 0.0f;
+        struct OscHandles
+        {
+            ParameterHandle ratio, depth, detune, octave, phase, keySync, volume, pan;
+            ParameterHandle unison, uSpread, drive, bitRedux, fold;
         };
 
-    private:
-        void updateParams();
-        void updateArpSequence();
-        void handleArp (int numSamples);
-        float renderOscSample (float& carrierPhase, float& modulatorPhase, float actualFreq, const FMOscState& settings);
-        
-        double sampleRate = 44100.0;
-        int samplesPerBlock = 512;
-        double bpm = 120.0;
-        double internalBpm = 120.0;
-        bool useHostBpm = false;
-
-        ArpSettings arpSettings;
-        ArpState arpState;
-        FxSettings fxSettings;
-        bool isMonoMode = false;
-        std::vector<int> monoHeldNotes;
-
-        // DSP FX
-        juce::dsp::Chorus<float> chorus;
-        juce::dsp::Phaser<float> phaser;
-        juce::dsp::Reverb reverb;
-        
-        struct DelayBlock
-        {
-            juce::dsp::DelayLine<float> line { 192000 }; // 4 seconds at 48k
-            float feedback = 0.0f;
-            float mix = 0.0f;
-            float lastL = 0, lastR = 0;
-            void prepare (const juce::dsp::ProcessSpec& spec) { line.prepare(spec); lastL = 0; lastR = 0; }
-            void process (juce::dsp::ProcessContextReplacing<float>& context);
-        } delay;
-        
-        // Polyphony
-        static constexpr int numVoices = 16;
-        std::array<Voice, numVoices> voices;
-        
-        // Global Parameter Cache (shared across voices)
         FMOscState globalOsc1;
         FMOscState globalOsc2;
-        float globalSubLevel = 0.0f;
-        float globalSubOctave = -1.0f; // -2, -1, or -0.5 octaves
-        float globalNoiseVolume = 0.0f;
-        std::array<LfoSettings, 2> globalLfos;
-        int   filterType = 0; // 0=LP, 1=HP, 2=BP
-        float baseFilterCutoff = 20000.0f;
-        float baseFilterRes = 0.0f;
-        float baseFilterDrive = 1.0f;
-        float filterKeyTrack = 0.5f;
-        bool filterIs24dB = true;
-        float filterVelocity = 0.0f; // NEW: Filter velocity sensitivity
-        float filterAftertouch = 0.0f; // NEW: Filter aftertouch sensitivity
-        
-        float filterEnvAmount = 0.0f;
-        int filterEnvTarget = 2; // NEW: 0=Osc1, 1=Osc2, 2=Both (for future use)
-        float filterEnvVelocity = 0.0f; // NEW: F-Env velocity sensitivity for amount
-        float filterEnvAftertouch = 0.0f; // NEW: F-Env aftertouch sensitivity for amount
-        float filterEnvVelAttack = 0.0f; // NEW: F-Env velocity sensitivity for attack
-        
-        float pitchEnvAmount = 0.0f;
-        int pitchEnvTarget = 2; // NEW: 0=Osc1, 1=Osc2, 2=Both
-        float pitchEnvVelocity = 0.0f; // NEW: P-Env velocity sensitivity for amount
-        float pitchEnvAftertouch = 0.0f; // NEW: P-Env aftertouch sensitivity for amount
-        float pitchEnvVelAttack = 0.0f; // NEW: P-Env velocity sensitivity for attack
-        
-        float ampLevel = 0.8f;
-        float ampVelocity = 0.5f; // Exists in Amp Output
-        float ampAftertouch = 0.0f; // NEW: Amp aftertouch sensitivity
-
-        float pitchWheel = 0.0f;  // -1.0 to 1.0
-        float modWheel = 0.0f;    // 0.0 to 1.0
-        float pbRange = 2.0f;     // Pitch bend range in semitones
-        
-        // NEW: Portamento
-        bool portaOn = false;
-        float portaTime = 100.0f; // ms
-        bool portaMode = false; // false=time, true=rate
-        float currentPortaFreq = 440.0f;
-        int lastMonoNote = -1;
-        
-        float ampEnvMode = 0.0f;
-        float filterEnvMode = 0.0f;
-        float pitchEnvMode = 0.0f;
-        float modEnvMode = 0.0f;
-        
-        juce::ADSR::Parameters ampParams, filterParams, pitchParams, modParams;
-
-        struct ModSlot
-        {
-            float target = 0.0f;
-            float amount = 0.0f;
-        };
-        ModSlot modSlots[4];
-
-        struct CtrlSlot
-        {
-            float target = 0.0f;
-            float amount = 0.0f;
-        };
-        std::array<CtrlSlot, 16> ctrlSlots; // Expanded from 8 to 16, source removed (uses Mod Env)
-        
-        ParameterRegistry& registry;
-        juce::AudioBuffer<float> tempBuffer;
+        OscHandles osc1Handles, osc2Handles;
+        ParameterGroupWatch osc1Watch, osc2Watch;
 
         JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (SignalPath)
     };
+
+    // Instantiated once, in SignalPath.cpp, next to the operator render loop it inlines
+    extern template class PolySignalPath<SignalPath, FmSection>;
 }
@@ -12,22 +12,34 @@ namespace neon
     class ChipOscModule : public ModuleBase
     {
     public:
-        ChipOscModule (const juce::String& name, const juce::Colour& color)
-            : ModuleBase (name, color)
+        ChipOscModule (NeonInstance& instance, const juce::String& name, const juce::Colour& color)
+            : ModuleBase (instance, name, color)
+        {
+            addParameters (*this);
+
+            lastAdjustedIndex = 0;
+        }
+
+        static void addParameters (ParameterLayout& layout)
+        {
+            addParameters (*this);
+
+            lastAdjustedIndex = 1;
+        }
+
+        static void addParameters (ParameterLayout& layout)
         {
             // Row 1
-            addChoiceParameter ("Waveform", { "Square", "Div 6 (Buzz)", "Div 31 (Low Buzz)", "Poly 4 (Noisy)", "Poly 5 (Metallic)", "Poly 9 (White)" }, 0);
-            addParameter ("Volume", 0.0f, 1.0f, 0.8f);
-            addSpacer();
-            addSpacer();
+            layout.addChoiceParameter ("Waveform", { "Square", "Div 6 (Buzz)", "Div 31 (Low Buzz)", "Poly 4 (Noisy)", "Poly 5 (Metallic)", "Poly 9 (White)" }, 0);
+            layout.addParameter ("Volume", 0.0f, 1.0f, 0.8f);
+            layout.addSpacer();
+            layout.addSpacer();
 
             // Row 2
-            addParameter ("Bit Depth", 1.0f, 16.0f, 4.0f, false, 1.0f, false, true);
-            addSpacer();
-            addSpacer();
-            addSpacer();
-
-            lastAdjustedIndex = 0;
+            layout.addParameter ("Bit Depth", 1.0f, 16.0f, 4.0f, false, 1.0f, false, true);
+            layout.addSpacer();
+            layout.addSpacer();
+            layout.addSpacer();
         }
 
     protected:
@@ -103,22 +115,20 @@ namespace neon
     class ChipFilterModule : public ModuleBase
     {
     public:
-        ChipFilterModule (const juce::String& name, const juce::Colour& color)
-            : ModuleBase (name, color)
+        ChipFilterModule (NeonInstance& instance, const juce::String& name, const juce::Colour& color)
+            : ModuleBase (instance, name, color)
         {
             // Row 1
-            addChoiceParameter ("Filter Type", { "LP", "HP", "BP" }, 0);
-            addParameter ("Cutoff", 20.0f, 20000.0f, 20000.0f);
-            addParameter ("Resonance", 0.0f, 1.0f, 0.0f);
-            addSpacer();
+            layout.addChoiceParameter ("Filter Type", { "LP", "HP", "BP" }, 0);
+            layout.addParameter ("Cutoff", 20.0f, 20000.0f, 20000.0f);
+            layout.addParameter ("Resonance", 0.0f, 1.0f, 0.0f);
+            layout.addSpacer();
 
             // Row 2
-            addSpacer();
-            addSpacer();
-            addSpacer();
-            addSpacer();
-
-            lastAdjustedIndex = 1;
+            layout.addSpacer();
+            layout.addSpacer();
+            layout.addSpacer();
+            layout.addSpacer();
         }
 
     protected:
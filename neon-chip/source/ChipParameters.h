@@ -0,0 +1,31 @@
+#pragma once
+#include <neon_ui_components/neon_ui_components.h>
+#include <neon_ui_components/modules/LfoModule.h>
+#include <neon_ui_components/modules/FxModule.h>
+#include <neon_ui_components/modules/ControlModule.h>
+#include "ChipModules.h"
+
+namespace neon
+{
+    /**
+     * addNeonChipParameters
+     * Every Neon Chip parameter, registered by the processor before the first patch loads.
+     */
+    static inline void addNeonChipParameters (NeonInstance& instance)
+    {
+        auto& registry = instance.getParameterRegistry();
+        const auto& names = instance.getRegistry();
+
+        { ParameterLayout l (registry, "Chip Osc");  ChipOscModule::addParameters (l); }
+        { ParameterLayout l (registry, "Filter");    ChipFilterModule::addParameters (l); }
+        { ParameterLayout l (registry, "Amp");       AmpModule::addParameters (l); }
+        { ParameterLayout l (registry, "Amp Env");   DahdsrModule::addParameters (l); }
+        { ParameterLayout l (registry, "LFO 1");     LfoModule::addParameters (l, names); }
+        { ParameterLayout l (registry, "LFO 2");     LfoModule::addParameters (l, names); }
+        { ParameterLayout l (registry, "FX");        FxModule::addParameters (l); }
+        { ParameterLayout l (registry, "Control");   ControlModule::addParameters (l, false, true); }
+        { ParameterLayout l (registry, "Librarian"); LibrarianModule::addParameters (l); }
+
+        registry.setLayoutComplete();
+    }
+}
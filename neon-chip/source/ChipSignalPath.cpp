@@ -5,9 +5,10 @@
 
 namespace neon
 {
-    ChipSignalPath::ChipSignalPath()
-        : registry (ParameterRegistry::getInstance())
+    ChipSignalPath::ChipSignalPath (NeonInstance& instance)
+        : registry (instance.getParameterRegistry())
     {
+        bindParameters();
     }
 
     void ChipSignalPath::prepareToPlay (int samplesPerBlockExpected, double sr)
@@ -23,10 +24,12 @@ namespace neon
 
         for (auto& v : voices)
         {
-            v.osc.setSampleRate (sr);
+            v.osc.setSampleRate (sr * oscOversampling);
             v.ampEnv.setSampleRate (sr);
             v.filter.prepare (spec);
         }
+
+        smoothers.prepare (sr);
     }
 
     void ChipSignalPath::releaseResources() {}
@@ -101,51 +104,116 @@ namespace neon
     }
 
     // ─── Parameter polling ────────────────────────────────
+    void ChipSignalPath::bindParameters()
+    {
+        handles.waveform     = registry.getHandle ("Chip Osc", "Waveform");
+        handles.bitDepth     = registry.getHandle ("Chip Osc", "Bit Depth");
+        handles.oscVolume    = registry.getHandle ("Chip Osc", "Volume");
+
+        handles.filterType   = registry.getHandle ("Filter", "Filter Type");
+        handles.filterCutoff = registry.getHandle ("Filter", "Cutoff");
+        handles.filterRes    = registry.getHandle ("Filter", "Resonance");
+
+        handles.ampAttack    = registry.getHandle ("Amp Env", "Attack");
+        handles.ampDecay     = registry.getHandle ("Amp Env", "Decay");
+        handles.ampSustain   = registry.getHandle ("Amp Env", "Sustain");
+        handles.ampRelease   = registry.getHandle ("Amp Env", "Release");
+
+        handles.ampLevel     = registry.getHandle ("Amp", "Level");
+        handles.ampVelocity  = registry.getHandle ("Amp", "Velocity");
+
+        handles.quality      = registry.getHandle ("Control", "Quality");
+    }
+
     void ChipSignalPath::updateParams()
     {
+        // Nothing moved anywhere in the registry since the last poll
+        auto generation = registry.getGeneration();
+        if (! paramsDirty && generation == lastParamGeneration)
+            return;
+
+        paramsDirty = false;
+        lastParamGeneration = generation;
+
         // Oscillator
-        if (auto* p = registry.getParameter ("Chip Osc/Waveform"))
-            waveformIndex = (int) p->getValue();
-        if (auto* p = registry.getParameter ("Chip Osc/Bit Depth"))
-            bitDepth = (int) p->getValue();
-        if (auto* p = registry.getParameter ("Chip Osc/Volume"))
-            oscVolume = p->getValue();
-        else
-            oscVolume = 0.8f;
+        if (registry.isBound (handles.waveform))
+            waveformIndex = (int) registry.getValue (handles.waveform);
+        if (registry.isBound (handles.bitDepth))
+            bitDepth = (int) registry.getValue (handles.bitDepth);
+        smoothers.setTarget (smOscVolume, registry.isBound (handles.oscVolume) ? registry.getValue (handles.oscVolume) : 0.8f);
 
         // Filter
-        if (auto* p = registry.getParameter ("Filter/Filter Type"))
-            filterType = (int) p->getValue();
-        if (auto* p = registry.getParameter ("Filter/Cutoff"))
-            filterCutoff = p->getValue();
-        else
-            filterCutoff = 20000.0f;
-        if (auto* p = registry.getParameter ("Filter/Resonance"))
-            filterRes = p->getValue();
+        if (registry.isBound (handles.filterType))
+            filterType = (int) registry.getValue (handles.filterType);
+        float cutoff = registry.isBound (handles.filterCutoff) ? registry.getValue (handles.filterCutoff) : 20000.0f;
+        smoothers.setTarget (smFilterCutoff, std::log2 (std::max (20.0f, cutoff) / 20.0f));
+        if (registry.isBound (handles.filterRes))
+            filterRes = registry.getValue (handles.filterRes);
 
         // Amp envelope
         float a = 0.005f, d = 0.3f, s = 1.0f, r = 0.3f;
-        if (auto* p = registry.getParameter ("Amp Env/Attack"))
-            a = std::max (0.001f, p->getValue() / 1000.0f);
-        if (auto* p = registry.getParameter ("Amp Env/Decay"))
-            d = std::max (0.001f, p->getValue() / 1000.0f);
-        if (auto* p = registry.getParameter ("Amp Env/Sustain"))
-            s = p->getValue(); 
-        if (auto* p = registry.getParameter ("Amp Env/Release"))
-            r = std::max (0.001f, p->getValue() / 1000.0f);
+        if (registry.isBound (handles.ampAttack))
+            a = std::max (0.001f, registry.getValue (handles.ampAttack) / 1000.0f);
+        if (registry.isBound (handles.ampDecay))
+            d = std::max (0.001f, registry.getValue (handles.ampDecay) / 1000.0f);
+        if (registry.isBound (handles.ampSustain))
+            s = registry.getValue (handles.ampSustain); 
+        if (registry.isBound (handles.ampRelease))
+            r = std::max (0.001f, registry.getValue (handles.ampRelease) / 1000.0f);
         ampParams = { a, d, s, r };
 
         // Amp
-        if (auto* p = registry.getParameter ("Amp/Level"))
-            ampLevel = p->getValue();
-        else
-            ampLevel = 0.8f;
-        if (auto* p = registry.getParameter ("Amp/Velocity"))
-            ampVelocity = p->getValue();
+        smoothers.setTarget (smAmpLevel, registry.isBound (handles.ampLevel) ? registry.getValue (handles.ampLevel) : 0.8f);
+        if (registry.isBound (handles.ampVelocity))
+            ampVelocity = registry.getValue (handles.ampVelocity);
+
+        // Render quality
+        if (registry.isBound (handles.quality))
+            chosenQuality.store ((int) registry.getValue (handles.quality));
+    }
+
+    void ChipSignalPath::applySmoothedParams()
+    {
+        oscVolume = smoothers.get (smOscVolume);
+        filterCutoff = 20.0f * std::exp2 (smoothers.get (smFilterCutoff));
+        ampLevel = smoothers.get (smAmpLevel);
     }
 
     // ─── Audio callback ───────────────────────────────────
     void ChipSignalPath::getNextAudioBlock (const juce::AudioSourceChannelInfo& info)
+    {
+        beginBlock (info.numSamples);
+        renderRange (info, 0, info.numSamples);
+    }
+
+    void ChipSignalPath::beginBlock (int numSamples)
+    {
+        registry.beginAudioBlock (numSamples, sampleRate);
+    }
+
+    void ChipSignalPath::renderRange (const juce::AudioSourceChannelInfo& block, int start, int numSamples)
+    {
+        // Render in segments split at parameter events so UI changes land sample-accurately
+        const int end = start + numSamples;
+
+        for (int pos = start; pos < end;)
+        {
+            int next = juce::jmin (end, registry.applyParameterEvents (pos));
+            updateParams();
+
+            // While anything is gliding, step in short control blocks
+            if (smoothers.isSmoothing())
+                next = juce::jmin (next, pos + SmoothingBank<numSmoothedParams>::controlBlockSize);
+
+            if (smoothers.advance (next - pos))
+                applySmoothedParams();
+
+            renderBlock ({ block.buffer, block.startSample + pos, next - pos });
+            pos = next;
+        }
+    }
+
+    void ChipSignalPath::renderBlock (const juce::AudioSourceChannelInfo& info)
     {
         auto* buffer = info.buffer;
         const int numSamples  = info.numSamples;
@@ -157,8 +225,16 @@ namespace neon
         // Clear output
         buffer->clear (startSample, numSamples);
 
-        // Poll parameters once per block
-        updateParams();
+        // Quality tier for this block; the oscillators follow a change of oversampling
+        quality = RenderQuality::get (getRenderQuality());
+        const int factor = quality.oversampling;
+
+        if (factor != oscOversampling)
+        {
+            oscOversampling = factor;
+            for (auto& v : voices)
+                v.osc.setSampleRate (sampleRate * factor);
+        }
 
         // Set up filter mode string
         auto filterMode = juce::dsp::StateVariableTPTFilterType::lowpass;
@@ -198,7 +274,11 @@ namespace neon
             {
                 // Drive oscillator at correct frequency
                 v.osc.noteOn (freq, false);  
-                float sample = v.osc.process();
+
+                float sub[Decimator::maxFactor];
+                for (int k = 0; k < factor; ++k)
+                    sub[k] = v.osc.process();
+                float sample = v.decimator.process (sub, factor);
 
                 // Skip filter if cutoff is fully open to guarantee signal pass
                 if (filterCutoff < 19800.0f || filterType != 0)
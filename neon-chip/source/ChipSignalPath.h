@@ -21,13 +21,18 @@ namespace neon
     class ChipSignalPath : public juce::AudioSource
     {
     public:
-        ChipSignalPath();
+        explicit ChipSignalPath (NeonInstance& instance);
         ~ChipSignalPath() override = default;
 
         void prepareToPlay (int samplesPerBlockExpected, double sampleRate) override;
         void getNextAudioBlock (const juce::AudioSourceChannelInfo& bufferToFill) override;
         void releaseResources() override;
 
+        // Sample-accurate MIDI: beginBlock() once per host block, then renderRange() for each
+        // stretch between events. start is the offset inside the block.
+        void beginBlock (int numSamples);
+        void renderRange (const juce::AudioSourceChannelInfo& block, int start, int numSamples);
+
         void noteOn (int midiNote, float velocity);
         void noteOff (int midiNote);
         void setPolyAftertouch (int midiNote, float value);
@@ -36,6 +41,11 @@ namespace neon
         void setModWheel (float value)   { modWheel = value; }
         void setBpm (double newBpm)      { bpm = newBpm; }
 
+        // The live tier is polled from Control "Quality" with the other parameters; processBlock
+        // reports bounces here, and they override it with OFFLINE
+        void setNonRealtime (bool isNonRealtime) { nonRealtime.store (isNonRealtime); }
+        RenderQuality::Tier getRenderQuality() const { return RenderQuality::resolve (chosenQuality.load(), nonRealtime.load()); }
+
         float getPitchWheel() const { return pitchWheel; }
         float getModWheel()  const { return modWheel; }
 
@@ -57,12 +67,14 @@ namespace neon
             double noteOnTime = 0.0;
 
             ChipOscillator osc;
+            Decimator decimator; // back from the oversampled oscillator rate
             juce::ADSR ampEnv;
             juce::dsp::StateVariableTPTFilter<float> filter;
 
             void reset()
             {
                 osc.reset();
+                decimator.reset();
                 ampEnv.reset();
                 filter.reset();
                 isActive.store (false);
@@ -71,7 +83,10 @@ namespace neon
         };
 
     private:
+        void bindParameters();
         void updateParams();
+        void renderBlock (const juce::AudioSourceChannelInfo& bufferToFill);
+        void applySmoothedParams();
 
         double sampleRate = 44100.0;
         int samplesPerBlock = 512;
@@ -97,12 +112,45 @@ namespace neon
         float ampLevel = 0.8f;
         float ampVelocity = 0.5f;
 
+        // Render quality: the pulse and LFSR waves are not band-limited, so the tiers that
+        // oversample run the oscillators at a multiple of the rate
+        std::atomic<int> chosenQuality { RenderQuality::realtime };
+        std::atomic<bool> nonRealtime { false };
+        RenderQuality::Settings quality; // getRenderQuality(), latched per block
+        int oscOversampling = 1;         // the multiple the oscillators are currently prepared for
+
+        // Continuous parameters glide through one bank; applySmoothedParams() copies
+        // the current values into the caches above.
+        enum SmoothedParam
+        {
+            smOscVolume,
+            smFilterCutoff, // octaves above 20 Hz
+            smAmpLevel,
+            numSmoothedParams
+        };
+
+        SmoothingBank<numSmoothedParams> smoothers;
+
         // Polyphony
         static constexpr int numVoices = 8;
         std::array<Voice, numVoices> voices;
 
         juce::AudioBuffer<float> tempBuffer;
 
+        // Registry handles, resolved once in bindParameters(). Unbound handles
+        // (module not created yet) leave the cached value untouched.
+        struct ParamHandles
+        {
+            ParameterHandle waveform, bitDepth, oscVolume;
+            ParameterHandle filterType, filterCutoff, filterRes;
+            ParameterHandle ampAttack, ampDecay, ampSustain, ampRelease;
+            ParameterHandle ampLevel, ampVelocity;
+            ParameterHandle quality;
+        } handles;
+
+        uint32_t lastParamGeneration = 0;
+        bool paramsDirty = true;
+
         ParameterRegistry& registry;
     };
 
@@ -15,7 +15,8 @@ namespace neon
     {
         setLookAndFeel (&lookAndFeel);
 
-        auto theme = NeonRegistry::getTheme();
+        auto& instance = p.getNeonInstance();
+        auto theme = instance.getRegistry().getTheme();
 
         selectionPanel.setCategoryNames ({ "CHIP", "FILTER", "AMP", "M/FX", "MAIN" });
         selectionPanel.setButtonColors (juce::Colour (0xFFFF00FF), juce::Colour (0xFF808080));
@@ -28,15 +29,15 @@ namespace neon
         selectionPanel.onModuleChanged = [this] (int index) { setActiveModule (index); };
         addAndMakeVisible (selectionPanel);
 
-        auto chipOsc = std::make_unique<ChipOscModule> ("Chip Osc", theme.oscillator);
-        auto filter = std::make_unique<ChipFilterModule> ("Filter", theme.filter);
-        auto amp = std::make_unique<AmpModule> ("Amp", theme.amplifier);
-        auto envAmp = std::make_unique<DahdsrModule> ("Amp Env", theme.envelope, false);
-        auto lfo1 = std::make_unique<LfoModule> ("LFO 1", theme.modulation);
-        auto lfo2 = std::make_unique<LfoModule> ("LFO 2", theme.modulation);
-        auto fxModule = std::make_unique<FxModule> ("FX", theme.effects);
-        auto ctrlModule = std::make_unique<ControlModule> ("Control", theme.indicator);
-        auto libModule = std::make_unique<LibrarianModule> ("Librarian", theme.background.brighter());
+        auto chipOsc = std::make_unique<ChipOscModule> (instance, "Chip Osc", theme.oscillator);
+        auto filter = std::make_unique<ChipFilterModule> (instance, "Filter", theme.filter);
+        auto amp = std::make_unique<AmpModule> (instance, "Amp", theme.amplifier);
+        auto envAmp = std::make_unique<DahdsrModule> (instance, "Amp Env", theme.envelope, false);
+        auto lfo1 = std::make_unique<LfoModule> (instance, "LFO 1", theme.modulation);
+        auto lfo2 = std::make_unique<LfoModule> (instance, "LFO 2", theme.modulation);
+        auto fxModule = std::make_unique<FxModule> (instance, "FX", theme.effects);
+        auto ctrlModule = std::make_unique<ControlModule> (instance, "Control", theme.indicator, false, true);
+        auto libModule = std::make_unique<LibrarianModule> (instance, "Librarian", theme.background.brighter());
 
         modules.add (chipOsc.release());
         modules.add (filter.release());
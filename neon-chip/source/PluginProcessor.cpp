@@ -1,6 +1,7 @@
 #include "PluginProcessor.h"
 #include "PluginEditor.h"
 #include "ModulationTargets.h"
+#include "ChipParameters.h"
 #include <neon_ui_components/core/NeonPatchManager.h>
 
 namespace neon
@@ -8,11 +9,16 @@ namespace neon
     NeonChipAudioProcessor::NeonChipAudioProcessor()
         : AudioProcessor (BusesProperties().withOutput ("Output", juce::AudioChannelSet::stereo(), true))
     {
-        PatchManager::getInstance().initialize ("NeonChip");
+        // Register modulation target / source names for UI components (shared by all instances)
+        static const auto targetNames = NeonRegistry::makeList (getNeonChipModTargetNames());
+        static const auto sourceNames = NeonRegistry::makeList (getNeonChipCtrlSourceNames());
+        neonInstance.getRegistry().setTargetNames (targetNames);
+        neonInstance.getRegistry().setSourceNames (sourceNames);
 
-        // Register modulation target / source names for UI components
-        NeonRegistry::setTargetNames (getNeonChipModTargetNames());
-        NeonRegistry::setSourceNames (getNeonChipCtrlSourceNames());
+        // Register the whole parameter set before the first patch is loaded into it
+        addNeonChipParameters (neonInstance);
+
+        neonInstance.getPatchManager().initialize ("NeonChip");
     }
 
     NeonChipAudioProcessor::~NeonChipAudioProcessor() = default;
@@ -36,6 +42,9 @@ namespace neon
         for (auto i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
             buffer.clear (i, 0, buffer.getNumSamples());
 
+        // Patches requested by Program Change / Bank Select in earlier blocks, parsed off-thread
+        neonInstance.getPatchManager().applyPendingProgramChange();
+
         keyboardState.processNextMidiBuffer (midiMessages, 0, buffer.getNumSamples(), true);
 
         // Get host BPM
@@ -52,38 +61,42 @@ namespace neon
         if (!midiMessages.isEmpty())
             midiActivity = true;
 
-        for (const auto metadata : midiMessages)
+        // Render up to each event's sample position, then apply it
+        const juce::AudioSourceChannelInfo info (&buffer, 0, buffer.getNumSamples());
+        signalPath.setNonRealtime (isNonRealtime()); // bounces render at the top quality tier
+        signalPath.beginBlock (info.numSamples);
+        renderSplitAtMidi (midiMessages, info.numSamples,
+                           [&] (int start, int num) { signalPath.renderRange (info, start, num); },
+                           [this] (const juce::MidiMessage& msg) { handleMidiMessage (msg); });
+    }
+
+    void NeonChipAudioProcessor::handleMidiMessage (const juce::MidiMessage& msg)
+    {
+        if (msg.isNoteOn())
+            signalPath.noteOn (msg.getNoteNumber(), msg.getFloatVelocity());
+        else if (msg.isNoteOff())
+            signalPath.noteOff (msg.getNoteNumber());
+        else if (msg.isAllNotesOff() || msg.isAllSoundOff())
         {
-            const auto msg = metadata.getMessage();
-            if (msg.isNoteOn())
-                signalPath.noteOn (msg.getNoteNumber(), msg.getFloatVelocity());
-            else if (msg.isNoteOff())
-                signalPath.noteOff (msg.getNoteNumber());
-            else if (msg.isAllNotesOff() || msg.isAllSoundOff())
-            {
-                for (int i = 0; i < 128; ++i) signalPath.noteOff (i);
-            }
-            else if (msg.isPitchWheel())
-                signalPath.setPitchWheel (juce::jmap ((float) msg.getPitchWheelValue(), 0.0f, 16383.0f, -1.0f, 1.0f));
-            else if (msg.isAftertouch())
-                signalPath.setPolyAftertouch (msg.getNoteNumber(), msg.getAfterTouchValue() / 127.0f);
-            else if (msg.isChannelPressure())
-                signalPath.setChannelAftertouch (msg.getChannelPressureValue() / 127.0f);
-            else if (msg.isController())
-            {
-                if (msg.getControllerNumber() == 1)
-                    signalPath.setModWheel (msg.getControllerValue() / 127.0f);
-                else if (msg.getControllerNumber() == 0 || msg.getControllerNumber() == 32)
-                    PatchManager::getInstance().selectBank (msg.getControllerValue());
-            }
-            else if (msg.isProgramChange())
-            {
-                PatchManager::getInstance().loadPatch (msg.getProgramChangeNumber());
-            }
+            for (int i = 0; i < 128; ++i) signalPath.noteOff (i);
+        }
+        else if (msg.isPitchWheel())
+            signalPath.setPitchWheel (juce::jmap ((float) msg.getPitchWheelValue(), 0.0f, 16383.0f, -1.0f, 1.0f));
+        else if (msg.isAftertouch())
+            signalPath.setPolyAftertouch (msg.getNoteNumber(), msg.getAfterTouchValue() / 127.0f);
+        else if (msg.isChannelPressure())
+            signalPath.setChannelAftertouch (msg.getChannelPressureValue() / 127.0f);
+        else if (msg.isController())
+        {
+            if (msg.getControllerNumber() == 1)
+                signalPath.setModWheel (msg.getControllerValue() / 127.0f);
+            else if (msg.getControllerNumber() == 0 || msg.getControllerNumber() == 32)
+                neonInstance.getPatchManager().requestBankSelect (msg.getControllerValue());
+        }
+        else if (msg.isProgramChange())
+        {
+            neonInstance.getPatchManager().requestProgramChange (msg.getProgramChangeNumber());
         }
-
-        juce::AudioSourceChannelInfo info (&buffer, 0, buffer.getNumSamples());
-        signalPath.getNextAudioBlock (info);
     }
 
     juce::AudioProcessorEditor* NeonChipAudioProcessor::createEditor()
@@ -8,8 +8,8 @@ namespace neon
     class AtariModule : public ChipModuleBase
     {
     public:
-        AtariModule() 
-            : ChipModuleBase("ATARI", juce::Colour(0xFF5555FF)) // Blue color for Atari
+        AtariModule(NeonInstance& instance) 
+            : ChipModuleBase(instance, "ATARI", juce::Colour(0xFF5555FF)) // Blue color for Atari
         {
             // Atari Sound Parameters
             addParameter("Waveform", 0.0f, 3.0f, 0.0f, false, 1.0f); // 0=Square, 1=Triangle, 2=Sawtooth, 3=Noise
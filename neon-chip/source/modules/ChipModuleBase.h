@@ -9,8 +9,8 @@ namespace neon
     class ChipModuleBase : public ModuleBase
     {
     public:
-        ChipModuleBase(const juce::String& name, const juce::Colour& color) 
-            : ModuleBase(name, color)
+        ChipModuleBase(NeonInstance& instance, const juce::String& name, const juce::Colour& color) 
+            : ModuleBase(instance, name, color)
         {
         }
 
@@ -8,8 +8,8 @@ namespace neon
     class NesModule : public ChipModuleBase
     {
     public:
-        NesModule() 
-            : ChipModuleBase("NES", juce::Colour(0xFF55FF55)) // Green color for NES
+        NesModule(NeonInstance& instance) 
+            : ChipModuleBase(instance, "NES", juce::Colour(0xFF55FF55)) // Green color for NES
         {
             // NES Square Wave Parameters
             addParameter("Waveform", 0.0f, 3.0f, 0.0f, false, 1.0f); // 0=Square1, 1=Square2, 2=Triangle, 3=Noise
@@ -8,8 +8,8 @@ namespace neon
     class SidModule : public ChipModuleBase
     {
     public:
-        SidModule() 
-            : ChipModuleBase("SID", juce::Colour(0xFFFF5555)) // Red color for SID
+        SidModule(NeonInstance& instance) 
+            : ChipModuleBase(instance, "SID", juce::Colour(0xFFFF5555)) // Red color for SID
         {
             // SID Oscillator Parameters
             addParameter("Waveform", 0.0f, 3.0f, 0.0f, false, 1.0f); // 0=SAW, 1=PULSE, 2=SINE, 3=TRIANGLE
@@ -0,0 +1,507 @@
+#pragma once
+
+#include <juce_gui_basics/juce_gui_basics.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace neon
+{
+    /**
+     * BankFile
+     * One bank of 128 patches in a single memory-mapped ".neonbank" file:
+     *
+     *     header      "NBNK", version, patch count, parameter count, section offsets
+     *     name table  128 x 64 bytes, UTF-8, zero padded
+     *     dictionary  parameter ids (u16 length + UTF-8 bytes each), read once on open
+     *     records     128 x parameterCount little-endian floats, NaN = not stored
+     *
+     * Recalling a patch is a pointer offset into the mapping, with no parsing.
+     * Saving writes the record in place unless the patch brings a parameter id the
+     * dictionary doesn't have yet, in which case the file is rebuilt once.
+     *
+     * Thread-safe: the patch loader reads while the message thread saves or renames.
+     * Use getShared() so every plugin instance in the process works on one mapping of
+     * a given bank; a rebuild then never has to replace a file that another instance
+     * still has mapped, and nobody keeps reading an orphaned copy afterwards.
+     * The legacy folder of patch_N.neon JSON files stays supported for import/export.
+     */
+    class BankFile
+    {
+    public:
+        static constexpr int numPatches = 128;
+        static constexpr int nameBytes = 64;
+        static constexpr juce::uint32 formatVersion = 1;
+        static constexpr const char* fileExtension = ".neonbank";
+
+        using PatchValues = std::vector<std::pair<juce::String, float>>;
+
+        explicit BankFile (const juce::File& bankFile) : file (bankFile)
+        {
+            open();
+        }
+
+        /** The process-wide BankFile for this path, opened on first use. */
+        static std::shared_ptr<BankFile> getShared (const juce::File& bankFile)
+        {
+            static std::mutex cacheLock;
+            static std::vector<std::weak_ptr<BankFile>> cache;
+
+            const std::lock_guard<std::mutex> scopedLock (cacheLock);
+            cache.erase (std::remove_if (cache.begin(), cache.end(), [] (auto& b) { return b.expired(); }), cache.end());
+
+            // Matched on the current path, so a bank renamed through moveTo is still found
+            for (auto& entry : cache)
+                if (auto shared = entry.lock(); shared != nullptr && shared->getFile() == bankFile)
+                    return shared;
+
+            auto shared = std::make_shared<BankFile> (bankFile);
+            cache.push_back (shared);
+            return shared;
+        }
+
+        juce::File getFile() const
+        {
+            const juce::ScopedLock sl (lock);
+            return file;
+        }
+
+        bool isValid() const
+        {
+            const juce::ScopedLock sl (lock);
+            return data != nullptr;
+        }
+
+        /**
+         * Re-maps the bank if the file on disk is no longer the one that is mapped, e.g.
+         * another process rebuilt it. Returns true if it had to. Call before reading.
+         */
+        bool reopenIfReplaced()
+        {
+            const juce::ScopedLock sl (lock);
+            if (file.getFileIdentifier() == fileIdentifier && file.getSize() == fileSize)
+                return false;
+
+            close();
+            open();
+            return true;
+        }
+
+        juce::StringArray getPatchNames() const
+        {
+            const juce::ScopedLock sl (lock);
+            juce::StringArray names;
+            for (int i = 0; i < numPatches; ++i)
+                names.add (readName (i));
+            return names;
+        }
+
+        /**
+         * Calls fn (parameterId, value) for every value stored in the patch and returns how
+         * many there were (0 for an empty INIT slot). name receives the patch name.
+         */
+        template <typename Fn>
+        int readPatch (int index, juce::String& name, Fn&& fn) const
+        {
+            const juce::ScopedLock sl (lock);
+            name = "INIT PATCH";
+            if (data == nullptr || ! juce::isPositiveAndBelow (index, numPatches))
+                return 0;
+
+            name = readName (index);
+
+            int numStored = 0;
+            const auto* record = data + recordsOffset + (size_t)index * (size_t)ids.size() * sizeof (float);
+            for (int i = 0; i < ids.size(); ++i)
+            {
+                auto value = readFloat (record + (size_t)i * sizeof (float));
+                if (! std::isnan (value))
+                {
+                    fn (ids[i], value);
+                    ++numStored;
+                }
+            }
+            return numStored;
+        }
+
+        /** Message thread. Stores a patch; values not listed are left unset (NaN). */
+        bool writePatch (int index, const juce::String& name, const PatchValues& values)
+        {
+            if (! juce::isPositiveAndBelow (index, numPatches))
+                return false;
+
+            const juce::ScopedLock sl (lock);
+            reopenIfReplaced();
+
+            bool fitsInPlace = data != nullptr && writable;
+            for (auto& v : values)
+                fitsInPlace = fitsInPlace && idIndices.count (v.first) > 0;
+
+            if (fitsInPlace)
+            {
+                writeName (data + nameTableOffset + (size_t)index * nameBytes, name);
+
+                auto* record = data + recordsOffset + (size_t)index * (size_t)ids.size() * sizeof (float);
+                for (int i = 0; i < ids.size(); ++i)
+                    writeFloat (record + (size_t)i * sizeof (float), std::numeric_limits<float>::quiet_NaN());
+                for (auto& v : values)
+                    writeFloat (record + (size_t)idIndices[v.first] * sizeof (float), v.second);
+                return true;
+            }
+
+            // New parameter ids: restride every record and rewrite the file once
+            auto contents = readContents();
+            for (auto& v : values)
+                contents.addId (v.first);
+
+            contents.names.set (index, name);
+            contents.clearPatch (index);
+            for (auto& v : values)
+                contents.set (index, contents.ids.indexOf (v.first), v.second);
+
+            // Can fail while another process has the bank mapped (Windows won't replace
+            // it); the old mapping is restored and the caller reports the failed save
+            close();
+            bool ok = writeContents (file, contents);
+            open();
+            return ok;
+        }
+
+        /** Message thread: rename / move the bank on disk. */
+        bool moveTo (const juce::File& newFile)
+        {
+            const juce::ScopedLock sl (lock);
+            reopenIfReplaced();
+            close();
+            bool ok = file.moveFileTo (newFile);
+            if (ok)
+                file = newFile;
+            open();
+            return ok;
+        }
+
+        /** Creates a bank of 128 empty INIT patches. */
+        static bool createEmpty (const juce::File& destFile)
+        {
+            return writeContents (destFile, Contents());
+        }
+
+        // -------- JSON import / export --------
+
+        /** Converts a folder of patch_N.neon files (plus optional index.txt) into a bank file. */
+        static bool importJsonBank (const juce::File& sourceDir, const juce::File& destFile)
+        {
+            Contents contents;
+            juce::StringArray indexNames;
+            auto indexFile = sourceDir.getChildFile ("index.txt");
+            if (indexFile.existsAsFile())
+                indexNames.addLines (indexFile.loadFileAsString());
+
+            for (int i = 0; i < numPatches; ++i)
+            {
+                juce::String name = indexNames[i].isNotEmpty() ? indexNames[i] : juce::String ("INIT PATCH");
+                PatchValues values;
+                readJsonPatch (sourceDir.getChildFile (getJsonPatchFileName (i)), name, values);
+
+                contents.names.set (i, name);
+                for (auto& v : values)
+                    contents.addId (v.first);
+                for (auto& v : values)
+                    contents.set (i, contents.ids.indexOf (v.first), v.second);
+            }
+
+            return writeContents (destFile, contents);
+        }
+
+        /** Writes the bank out as patch_N.neon files plus index.txt. */
+        bool exportJsonBank (const juce::File& destDir) const
+        {
+            if (! destDir.createDirectory())
+                return false;
+
+            juce::StringArray names;
+            for (int i = 0; i < numPatches; ++i)
+            {
+                juce::String name;
+                PatchValues values;
+                readPatch (i, name, [&] (const juce::String& id, float value) { values.push_back ({ id, value }); });
+
+                if (! writeJsonPatch (destDir.getChildFile (getJsonPatchFileName (i)), name, values))
+                    return false;
+                names.add (name);
+            }
+
+            return destDir.getChildFile ("index.txt").replaceWithText (names.joinIntoString ("\n"));
+        }
+
+        /** Reads a single .neon JSON patch. Leaves name untouched if the file has none. */
+        static bool readJsonPatch (const juce::File& jsonFile, juce::String& name, PatchValues& values)
+        {
+            if (! jsonFile.existsAsFile())
+                return false;
+
+            auto json = juce::JSON::parse (jsonFile);
+            if (! json.isObject())
+                return false;
+
+            name = json.getProperty ("name", name).toString();
+
+            if (auto* params = json.getProperty ("parameters", juce::var()).getDynamicObject())
+                for (auto& it : params->getProperties())
+                    values.push_back ({ it.name.toString(), (float)it.value });
+
+            return true;
+        }
+
+        static bool writeJsonPatch (const juce::File& jsonFile, const juce::String& name, const PatchValues& values)
+        {
+            juce::DynamicObject::Ptr obj = new juce::DynamicObject();
+            obj->setProperty ("name", name);
+
+            if (! values.empty())
+            {
+                juce::DynamicObject::Ptr params = new juce::DynamicObject();
+                for (auto& v : values)
+                    params->setProperty (v.first, v.second);
+                obj->setProperty ("parameters", juce::var (params));
+            }
+
+            return jsonFile.replaceWithText (juce::JSON::toString (juce::var (obj)));
+        }
+
+        static juce::String getJsonPatchFileName (int index)
+        {
+            return juce::String ("patch_") + juce::String (index + 1) + ".neon";
+        }
+
+    private:
+        static constexpr size_t headerSize = 32;
+
+        // Whole-bank model, only used for import and when the dictionary grows
+        struct Contents
+        {
+            Contents()
+            {
+                for (int i = 0; i < numPatches; ++i)
+                    names.add ("INIT PATCH");
+            }
+
+            void addId (const juce::String& id)
+            {
+                if (ids.contains (id))
+                    return;
+
+                // Restride: every patch gets one more (unset) column
+                std::vector<float> restrided ((size_t)numPatches * (size_t)(ids.size() + 1), std::numeric_limits<float>::quiet_NaN());
+                for (int p = 0; p < numPatches; ++p)
+                    for (int i = 0; i < ids.size(); ++i)
+                        restrided[(size_t)p * (size_t)(ids.size() + 1) + (size_t)i] = values[(size_t)p * (size_t)ids.size() + (size_t)i];
+
+                ids.add (id);
+                values = std::move (restrided);
+            }
+
+            void set (int patch, int id, float value)
+            {
+                values[(size_t)patch * (size_t)ids.size() + (size_t)id] = value;
+            }
+
+            void clearPatch (int patch)
+            {
+                for (int i = 0; i < ids.size(); ++i)
+                    set (patch, i, std::numeric_limits<float>::quiet_NaN());
+            }
+
+            juce::StringArray names;
+            juce::StringArray ids;
+            std::vector<float> values;
+        };
+
+        void open()
+        {
+            mapping.reset();
+            data = nullptr;
+            ids.clear();
+            idIndices.clear();
+            fileIdentifier = file.getFileIdentifier();
+            fileSize = file.getSize();
+
+            if (! file.existsAsFile())
+                return;
+
+            // Factory banks may sit in a read-only install folder
+            writable = file.hasWriteAccess();
+            mapping = std::make_unique<juce::MemoryMappedFile> (file, writable ? juce::MemoryMappedFile::readWrite
+                                                                               : juce::MemoryMappedFile::readOnly);
+            auto* base = static_cast<juce::uint8*> (mapping->getData());
+            auto size = mapping->getSize();
+
+            if (base == nullptr || size < headerSize || std::memcmp (base, "NBNK", 4) != 0
+                || readInt (base + 4) != formatVersion || readInt (base + 8) != (juce::uint32)numPatches)
+            {
+                mapping.reset();
+                return;
+            }
+
+            auto numIds = (size_t)readInt (base + 12);
+            nameTableOffset = readInt (base + 16);
+            auto dictionaryOffset = (size_t)readInt (base + 20);
+            recordsOffset = readInt (base + 24);
+
+            if (nameTableOffset + (size_t)numPatches * nameBytes > size
+                || recordsOffset + (size_t)numPatches * numIds * sizeof (float) > size)
+            {
+                mapping.reset();
+                return;
+            }
+
+            auto pos = dictionaryOffset;
+            for (size_t i = 0; i < numIds; ++i)
+            {
+                if (pos + 2 > recordsOffset)
+                    break;
+
+                auto length = (size_t)juce::ByteOrder::littleEndianShort (base + pos);
+                pos += 2;
+                if (pos + length > recordsOffset)
+                    break;
+
+                auto id = juce::String::fromUTF8 (reinterpret_cast<const char*> (base + pos), (int)length);
+                idIndices[id] = ids.size();
+                ids.add (id);
+                pos += length;
+            }
+
+            if ((size_t)ids.size() != numIds)
+            {
+                ids.clear();
+                idIndices.clear();
+                mapping.reset();
+                return;
+            }
+
+            data = base;
+        }
+
+        void close()
+        {
+            data = nullptr;
+            mapping.reset();
+        }
+
+        Contents readContents() const
+        {
+            Contents contents;
+            for (auto& id : ids)
+                contents.addId (id);
+
+            for (int p = 0; p < numPatches; ++p)
+            {
+                juce::String name;
+                readPatch (p, name, [&] (const juce::String& id, float value) { contents.set (p, idIndices.at (id), value); });
+                contents.names.set (p, name);
+            }
+            return contents;
+        }
+
+        static bool writeContents (const juce::File& destFile, const Contents& contents)
+        {
+            juce::MemoryOutputStream out;
+
+            juce::MemoryOutputStream dictionary;
+            for (auto& id : contents.ids)
+            {
+                auto utf8 = id.toUTF8();
+                auto length = juce::jmin ((size_t)0xffff, id.getNumBytesAsUTF8());
+                dictionary.writeShort ((short)length);
+                dictionary.write (utf8.getAddress(), length);
+            }
+
+            const auto nameTableOffset = headerSize;
+            const auto dictionaryOffset = nameTableOffset + (size_t)numPatches * nameBytes;
+            const auto recordsOffset = (dictionaryOffset + dictionary.getDataSize() + 15) & ~(size_t)15;
+
+            out.write ("NBNK", 4);
+            out.writeInt ((int)formatVersion);
+            out.writeInt (numPatches);
+            out.writeInt (contents.ids.size());
+            out.writeInt ((int)nameTableOffset);
+            out.writeInt ((int)dictionaryOffset);
+            out.writeInt ((int)recordsOffset);
+            out.writeInt (0);
+
+            for (int i = 0; i < numPatches; ++i)
+            {
+                juce::uint8 slot[nameBytes] {};
+                writeName (slot, contents.names[i]);
+                out.write (slot, nameBytes);
+            }
+
+            out << dictionary;
+            out.writeRepeatedByte (0, recordsOffset - out.getDataSize());
+
+            for (auto v : contents.values)
+                out.writeFloat (v);
+
+            return destFile.replaceWithData (out.getData(), out.getDataSize());
+        }
+
+        juce::String readName (int index) const
+        {
+            if (data == nullptr)
+                return "INIT PATCH";
+
+            auto* name = reinterpret_cast<const char*> (data + nameTableOffset + (size_t)index * nameBytes);
+            size_t length = 0;
+            while (length < nameBytes && name[length] != 0)
+                ++length;
+            return juce::String::fromUTF8 (name, (int)length);
+        }
+
+        static void writeName (juce::uint8* dest, juce::String name)
+        {
+            // Keep a terminating zero and never split a UTF-8 sequence
+            while (name.getNumBytesAsUTF8() >= (size_t)nameBytes)
+                name = name.dropLastCharacters (1);
+
+            std::memset (dest, 0, nameBytes);
+            std::memcpy (dest, name.toRawUTF8(), name.getNumBytesAsUTF8());
+        }
+
+        static juce::uint32 readInt (const juce::uint8* p) noexcept { return juce::ByteOrder::littleEndianInt (p); }
+
+        static float readFloat (const juce::uint8* p) noexcept
+        {
+            auto bits = juce::ByteOrder::littleEndianInt (p);
+            float value;
+            std::memcpy (&value, &bits, sizeof (value));
+            return value;
+        }
+
+        static void writeFloat (juce::uint8* p, float value) noexcept
+        {
+            juce::uint32 bits;
+            std::memcpy (&bits, &value, sizeof (bits));
+            bits = juce::ByteOrder::swapIfBigEndian (bits);
+            std::memcpy (p, &bits, sizeof (bits));
+        }
+
+        juce::CriticalSection lock;
+        juce::File file;
+        std::unique_ptr<juce::MemoryMappedFile> mapping;
+        juce::uint8* data = nullptr;
+        bool writable = false;
+        juce::uint64 fileIdentifier = 0;
+        juce::int64 fileSize = 0;
+        size_t nameTableOffset = 0, recordsOffset = 0;
+        juce::StringArray ids;
+        std::map<juce::String, int> idIndices;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (BankFile)
+    };
+}
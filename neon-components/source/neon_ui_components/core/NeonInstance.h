@@ -0,0 +1,38 @@
+#pragma once
+
+#include <juce_gui_basics/juce_gui_basics.h>
+#include "NeonParameterRegistry.h"
+#include "NeonRegistry.h"
+#include "NeonPatchManager.h"
+
+namespace neon
+{
+    /**
+     * NeonInstance
+     * Everything that used to be a process-wide singleton, owned per AudioProcessor:
+     * the ParameterRegistry, the UI NeonRegistry and the PatchManager.
+     * Two plugin instances in one host never share parameter state.
+     *
+     * The processor registers its full parameter layout at construction, so state,
+     * program changes and the engine work whether or not an editor was ever opened.
+     * Modules are handed the instance explicitly:
+     *
+     *     auto osc = std::make_unique<OscillatorModule> (audioProcessor.getNeonInstance(), "Oscillator 1", theme.oscillator);
+     */
+    class NeonInstance
+    {
+    public:
+        NeonInstance() : patchManager (parameterRegistry, registry) {}
+
+        ParameterRegistry& getParameterRegistry() { return parameterRegistry; }
+        NeonRegistry& getRegistry() { return registry; }
+        PatchManager& getPatchManager() { return patchManager; }
+
+    private:
+        ParameterRegistry parameterRegistry;
+        NeonRegistry registry;
+        PatchManager patchManager;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (NeonInstance)
+    };
+}
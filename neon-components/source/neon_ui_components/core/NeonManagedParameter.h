@@ -1,13 +1,23 @@
 #pragma once
 
 #include <juce_gui_basics/juce_gui_basics.h>
+#include <atomic>
 
 namespace neon
 {
+    /** Receives every value change of a registered parameter (implemented by ParameterRegistry). */
+    struct ParameterChangeSink
+    {
+        virtual ~ParameterChangeSink() = default;
+        virtual void parameterValueChanged (int slotIndex, float newValue) = 0;
+    };
+
     /**
      * ManagedParameter
      * A lightweight abstraction for a parameter value.
      * Separates the value logic from the UI representation.
+     * The value is atomic: written by the UI / patch loader. The audio thread reads the
+     * copy the ParameterRegistry keeps in sync through its event queue.
      */
     class ManagedParameter
     {
@@ -86,9 +96,27 @@ namespace neon
             return binaryOffLabel.isNotEmpty() ? binaryOffLabel : "OFF";
         }
 
-        float getValue() const { return value; }
+        float getValue() const { return value.load (std::memory_order_relaxed); }
         float getDefaultValue() const { return defaultValue; }
-        void setValue (float newValue) { value = juce::jlimit ((float)range.start, (float)range.end, newValue); }
+
+        /**
+         * dontSendNotification skips the change sink; only the ParameterRegistry uses it,
+         * when it has already updated the audio-side value itself.
+         */
+        void setValue (float newValue, juce::NotificationType notification = juce::sendNotification)
+        {
+            auto clamped = juce::jlimit ((float)range.start, (float)range.end, newValue);
+            if (value.exchange (clamped, std::memory_order_relaxed) != clamped
+                && notification != juce::dontSendNotification && changeSink != nullptr)
+                changeSink->parameterValueChanged (slotIndex, clamped);
+        }
+
+        /** Called by the ParameterRegistry so every change is forwarded to the audio thread. */
+        void setChangeSink (ParameterChangeSink* sink, int slot)
+        {
+            changeSink = sink;
+            slotIndex = slot;
+        }
         
         void setIsMomentary (bool momentary) { isMomentary = momentary; }
         bool getIsMomentary() const { return isMomentary; }
@@ -100,11 +128,14 @@ namespace neon
     private:
         juce::String name;
         juce::NormalisableRange<double> range;
-        float value;
+        std::atomic<float> value;
         float defaultValue;
         bool isBoolean;
         bool isMomentary = false;
         juce::String binaryOffLabel, binaryOnLabel;
         std::vector<juce::String> choices;
+
+        ParameterChangeSink* changeSink = nullptr;
+        int slotIndex = -1;
     };
 }
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <array>
+
+namespace neon
+{
+    /**
+     * ParameterEvent
+     * One parameter change placed inside an audio block: which registry slot,
+     * the new value, and the sample offset (relative to the block start) it applies from.
+     */
+    struct ParameterEvent
+    {
+        int index = -1;
+        float value = 0.0f;
+        int sampleOffset = 0;
+    };
+
+    /**
+     * ParameterEventQueue
+     * Single-producer / single-consumer lock-free FIFO of parameter changes.
+     * The producer is the message thread (cards, XY pad, ribbon, patch loads),
+     * the consumer is the audio thread. Entries carry their arrival time so the
+     * consumer can spread them across the next block instead of snapping to its start.
+     */
+    class ParameterEventQueue
+    {
+    public:
+        static constexpr int capacity = 1024;
+
+        struct Entry
+        {
+            int index = -1;
+            float value = 0.0f;
+            double timeMs = 0.0;
+        };
+
+        /** Producer only. Returns false if the queue is full. */
+        bool push (int index, float value) noexcept
+        {
+            const auto scope = fifo.write (1);
+            if (scope.blockSize1 + scope.blockSize2 == 0)
+                return false;
+
+            auto& entry = entries[(size_t)(scope.blockSize1 > 0 ? scope.startIndex1 : scope.startIndex2)];
+            entry.index = index;
+            entry.value = value;
+            entry.timeMs = juce::Time::getMillisecondCounterHiRes();
+            return true;
+        }
+
+        /** Consumer only. Hands up to maxEntries pending entries to callback, oldest first. */
+        template <typename Callback>
+        int pop (int maxEntries, Callback&& callback) noexcept
+        {
+            const auto scope = fifo.read (juce::jmin (maxEntries, fifo.getNumReady()));
+            scope.forEach ([&] (int i) { callback (entries[(size_t)i]); });
+            return scope.blockSize1 + scope.blockSize2;
+        }
+
+        /** Consumer only. Drops everything pending. */
+        void discardAll() noexcept
+        {
+            fifo.read (fifo.getNumReady());
+        }
+
+    private:
+        juce::AbstractFifo fifo { capacity };
+        std::array<Entry, capacity> entries;
+
+        JUCE_DECLARE_NON_COPYABLE (ParameterEventQueue)
+    };
+}
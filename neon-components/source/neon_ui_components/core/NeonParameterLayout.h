@@ -0,0 +1,64 @@
+#pragma once
+
+#include <juce_gui_basics/juce_gui_basics.h>
+#include "NeonParameterRegistry.h"
+
+namespace neon
+{
+    /**
+     * ParameterLayout
+     * One module's parameters, declared in the order the editor shows them. Every module
+     * has a static addParameters (ParameterLayout&, ...) that is the only place its
+     * parameters are described, so the processor can register them without an editor:
+     *
+     *     ParameterLayout osc (registry, "Oscillator 1");
+     *     OscillatorModule::addParameters (osc);
+     *
+     * ModuleBase is a ParameterLayout too; it runs the same function and adds a card for
+     * every parameter (and a blank one for every spacer). Registering is idempotent, so
+     * the editor gets back the parameters the processor already holds.
+     */
+    class ParameterLayout
+    {
+    public:
+        ParameterLayout (ParameterRegistry& parameterRegistry, const juce::String& path)
+            : registry (parameterRegistry), modulePath (path) {}
+
+        virtual ~ParameterLayout() = default;
+
+        ManagedParameter* addParameter (const juce::String& name, float min, float max, float def, bool isBool = false, float interval = 0.0f, bool isMomentary = false, bool isLinear = false)
+        {
+            auto* p = registry.getOrCreateParameter (modulePath, name, min, max, def, isBool, interval, isMomentary, isLinear);
+            parameterAdded (*p);
+            return p;
+        }
+
+        ManagedParameter* addChoiceParameter (const juce::String& name, const std::vector<juce::String>& choices, int defaultIndex)
+        {
+            auto* p = registry.getOrCreateChoiceParameter (modulePath, name, choices, defaultIndex);
+            parameterAdded (*p);
+            return p;
+        }
+
+        /** Registered without a card, e.g. the cells of a step grid the module draws itself. */
+        ManagedParameter* addHiddenParameter (const juce::String& name, float min, float max, float def, bool isBool = false)
+        {
+            return registry.getOrCreateParameter (modulePath, name, min, max, def, isBool);
+        }
+
+        /** A blank card in the editor, to line up the rows; nothing is registered. */
+        void addSpacer() { spacerAdded(); }
+
+        const juce::String& getModulePath() const noexcept { return modulePath; }
+
+    protected:
+        virtual void parameterAdded (ManagedParameter&) {}
+        virtual void spacerAdded() {}
+
+    private:
+        ParameterRegistry& registry;
+        const juce::String modulePath;
+
+        JUCE_DECLARE_NON_COPYABLE (ParameterLayout)
+    };
+}
@@ -2,39 +2,92 @@
 
 #include <juce_gui_basics/juce_gui_basics.h>
 #include <map>
+#include <array>
+#include <atomic>
+#include <cstdint>
 #include "NeonManagedParameter.h"
+#include "NeonParameterEventQueue.h"
 
 namespace neon
 {
+    /**
+     * ParameterHandle
+     * A dense index into the ParameterRegistry's flat slot table.
+     * Resolve once (constructor / message thread), then read from the audio thread
+     * without building strings or walking the path map.
+     */
+    struct ParameterHandle
+    {
+        int index = -1;
+        bool isValid() const noexcept { return index >= 0; }
+    };
+
+    /**
+     * ParameterGroupWatch
+     * Tracks the last change generation an engine consumed for one module group
+     * (e.g. "Amp Env", "FX"). Starts dirty so the first poll always applies.
+     */
+    struct ParameterGroupWatch
+    {
+        int group = -1;
+        uint32_t lastSeen = 0;
+        bool dirty = true;
+
+        void invalidate() noexcept { dirty = true; }
+    };
+
     /**
      * ParameterRegistry
-     * A central singleton-style registry for all parameters in the synth.
-     * Allows debug views and the (future) audio engine to access any parameter by name.
+     * The registry for all parameters of one plugin instance (owned by its NeonInstance).
+     * Allows debug views and the audio engine to access any parameter by name,
+     * or by ParameterHandle on the audio thread.
+     *
+     * Value changes made on the message thread travel to the audio thread through a
+     * ParameterEventQueue and are applied at their position inside the block:
+     *
+     *     registry.beginAudioBlock (numSamples, sampleRate);
+     *     for (int pos = 0; pos < numSamples;)
+     *     {
+     *         int next = registry.applyParameterEvents (pos);
+     *         updateParams();
+     *         render (pos, next - pos);
+     *         pos = next;
+     *     }
      */
-    class ParameterRegistry
+    class ParameterRegistry : private ParameterChangeSink
     {
     public:
-        static ParameterRegistry& getInstance();
+        ParameterRegistry() = default;
+
+        // Upper bound on distinct parameter paths; the slot table never reallocates
+        // so the audio thread can index it while the UI is still registering parameters.
+        static constexpr int maxParameters = 2048;
+        static constexpr int maxGroups = 256;
 
         // Registry becomes the owner of the parameters to ensure they outlive the UI
         ManagedParameter* getOrCreateParameter (const juce::String& modulePath, const juce::String& name, float min, float max, float def, bool isBool = false, float interval = 0.0f, bool isMomentary = false, bool isLinear = false)
         {
             auto fullPath = modulePath + "/" + name;
+            const juce::ScopedLock sl (pathLock);
             if (parameters.count (fullPath))
                 return parameters[fullPath].get();
-            
+
+            jassert (! layoutComplete); // missing from the processor's layout: not saved while the editor is closed
+
             auto param = std::make_unique<ManagedParameter> (name, min, max, def, isBool, isLinear);
             param->setInterval (interval);
             param->setIsMomentary (isMomentary);
             auto* ptr = param.get();
             parameters[fullPath] = std::move (param);
+            registerParameter (modulePath, fullPath, ptr);
             return ptr;
         }
 
         ManagedParameter* getOrCreateChoiceParameter (const juce::String& modulePath, const juce::String& name, const std::vector<juce::String>& choices, int defaultIndex)
         {
             auto fullPath = modulePath + "/" + name;
-            
+            const juce::ScopedLock sl (pathLock);
+
             // If it exists, update it if the name contains "Target" to ensure target lists stay sync'd
             if (parameters.count (fullPath))
             {
@@ -43,14 +96,23 @@ namespace neon
                     existing->setChoices (choices);
                 return existing;
             }
-            
+
+            jassert (! layoutComplete); // missing from the processor's layout: not saved while the editor is closed
+
             auto param = std::make_unique<ManagedParameter> (name, 0.0f, (float)(choices.size() - 1), (float)defaultIndex, false);
             param->setChoices (choices);
             auto* ptr = param.get();
             parameters[fullPath] = std::move (param);
+            registerParameter (modulePath, fullPath, ptr);
             return ptr;
         }
 
+        /**
+         * Called by the processor once its whole layout is registered; any parameter created
+         * after that asserts in debug builds, because it only exists while an editor is open.
+         */
+        void setLayoutComplete() noexcept { layoutComplete = true; }
+
         ManagedParameter* getParameter (const juce::String& fullPath)
         {
             if (parameters.count (fullPath))
@@ -63,10 +125,282 @@ namespace neon
             return parameters;
         }
 
+        // -------- Handle API (resolve off the audio thread, read on it) --------
+
+        /**
+         * Resolve a path to a handle. The parameter does not need to exist yet: the
+         * slot is bound as soon as it is registered (processors register their layout
+         * at construction). Until then getValue() returns fallback.
+         * Call off the audio thread.
+         */
+        ParameterHandle getHandle (const juce::String& modulePath, const juce::String& name, float fallback = 0.0f)
+        {
+            return getHandle (modulePath + "/" + name, fallback);
+        }
+
+        ParameterHandle getHandle (const juce::String& fullPath, float fallback = 0.0f)
+        {
+            const juce::ScopedLock sl (pathLock);
+            return { findOrAllocateSlot (fullPath, fallback) };
+        }
+
+        /**
+         * Safe from background threads (the patch loader): the handle of a parameter a
+         * module has already registered, or an invalid handle. Never allocates a slot.
+         */
+        ParameterHandle findRegisteredHandle (const juce::String& fullPath) const
+        {
+            const juce::ScopedLock sl (pathLock);
+            auto it = slotIndices.find (fullPath);
+            if (it == slotIndices.end() || slots[(size_t)it->second].parameter.load (std::memory_order_acquire) == nullptr)
+                return {};
+            return { it->second };
+        }
+
+        /** Safe from background threads: appends (handle, default) for every registered parameter. */
+        void getRegisteredDefaults (std::vector<std::pair<ParameterHandle, float>>& dest) const
+        {
+            const juce::ScopedLock sl (pathLock);
+            for (int i = 0; i < numSlots; ++i)
+                if (auto* p = slots[(size_t)i].parameter.load (std::memory_order_acquire))
+                    dest.push_back ({ { i }, p->getDefaultValue() });
+        }
+
+        /**
+         * Audio thread: the value as of the last applied event (or the fallback while
+         * unbound). Realtime-safe: no allocation, no locking, no string work.
+         */
+        float getValue (ParameterHandle handle) const noexcept
+        {
+            if (! handle.isValid())
+                return 0.0f;
+            return slots[(size_t)handle.index].audioValue.load (std::memory_order_relaxed);
+        }
+
+        /** True once a module has registered the parameter behind this handle. */
+        bool isBound (ParameterHandle handle) const noexcept
+        {
+            return getParameter (handle) != nullptr;
+        }
+
+        ManagedParameter* getParameter (ParameterHandle handle) const noexcept
+        {
+            if (! handle.isValid())
+                return nullptr;
+            return slots[(size_t)handle.index].parameter.load (std::memory_order_acquire);
+        }
+
+        // -------- Change generations --------
+
+        /** Resolve a watch for a module group. Call off the audio thread. */
+        ParameterGroupWatch watchGroup (const juce::String& modulePath)
+        {
+            ParameterGroupWatch watch;
+            watch.group = findOrAllocateGroup (modulePath);
+            return watch;
+        }
+
+        /**
+         * Realtime-safe: returns true if any parameter in the group changed (or was
+         * registered) since the last call with this watch, then marks it consumed.
+         */
+        bool consumeChanges (ParameterGroupWatch& watch) const noexcept
+        {
+            if (watch.group < 0)
+                return false;
+
+            auto gen = groupGenerations[(size_t)watch.group].load (std::memory_order_acquire);
+            bool changed = watch.dirty || gen != watch.lastSeen;
+            watch.lastSeen = gen;
+            watch.dirty = false;
+            return changed;
+        }
+
+        /** Bumped on every parameter change in any group; cheap early-out for simple engines. */
+        uint32_t getGeneration() const noexcept { return globalGeneration.load (std::memory_order_acquire); }
+
+        // -------- Parameter events (audio thread) --------
+
+        /**
+         * Call once at the top of every audio block. Pulls the changes queued since the
+         * previous block and places each one at the sample offset matching its arrival time.
+         */
+        void beginAudioBlock (int numSamples, double sampleRate) noexcept
+        {
+            const auto now = juce::Time::getMillisecondCounterHiRes();
+            const auto blockMs = 1000.0 * numSamples / juce::jmax (1.0, sampleRate);
+            const auto windowStart = juce::jmax (lastBlockTimeMs, now - blockMs);
+            const auto windowMs = now - windowStart;
+            lastBlockTimeMs = now;
+
+            blockSize = numSamples;
+            numScheduled = 0;
+            nextScheduled = 0;
+
+            // Writes from other threads can't use the queue; pick them up wholesale.
+            // Anything still queued is older than the values being copied, so drop it.
+            if (resyncRequested.exchange (false, std::memory_order_acquire))
+            {
+                eventQueue.discardAll();
+                resyncFromParameters();
+                return;
+            }
+
+            eventQueue.pop (ParameterEventQueue::capacity, [&] (const ParameterEventQueue::Entry& e)
+            {
+                int offset = 0;
+                if (windowMs > 0.0)
+                    offset = (int)((e.timeMs - windowStart) / windowMs * numSamples);
+
+                scheduled[(size_t)numScheduled++] = { e.index, e.value, juce::jlimit (0, juce::jmax (0, numSamples - 1), offset) };
+            });
+        }
+
+        /**
+         * Applies every scheduled event at or before sampleOffset and returns the offset
+         * of the next one, or the block size when none are left.
+         */
+        int applyParameterEvents (int sampleOffset) noexcept
+        {
+            while (nextScheduled < numScheduled && scheduled[(size_t)nextScheduled].sampleOffset <= sampleOffset)
+            {
+                const auto& e = scheduled[(size_t)nextScheduled++];
+                setAudioValue (slots[(size_t)e.index], e.value);
+            }
+
+            return nextScheduled < numScheduled ? scheduled[(size_t)nextScheduled].sampleOffset : blockSize;
+        }
+
+        /**
+         * Audio thread, between blocks: set a registered parameter directly, e.g. from a
+         * prepared patch snapshot. The UI value follows without a trip through the queue.
+         */
+        void setValueFromAudioThread (ParameterHandle handle, float value) noexcept
+        {
+            if (auto* p = getParameter (handle))
+            {
+                p->setValue (value, juce::dontSendNotification);
+                setAudioValue (slots[(size_t)handle.index], p->getValue());
+            }
+        }
+
     private:
-        ParameterRegistry() = default;
+        struct Slot
+        {
+            std::atomic<ManagedParameter*> parameter { nullptr };
+            std::atomic<float> audioValue { 0.0f };
+            float fallback = 0.0f;
+            int group = -1;
+        };
+
+        void parameterValueChanged (int slotIndex, float newValue) override
+        {
+            // The queue has a single producer: the message thread. Host state restores
+            // from other threads resync at the next block instead.
+            if (juce::MessageManager::existsAndIsCurrentThread() && eventQueue.push (slotIndex, newValue))
+                return;
+
+            resyncRequested.store (true, std::memory_order_release);
+        }
+
+        void setAudioValue (Slot& slot, float newValue) noexcept
+        {
+            if (slot.audioValue.exchange (newValue, std::memory_order_relaxed) == newValue)
+                return;
+
+            if (slot.group >= 0)
+                groupGenerations[(size_t)slot.group].fetch_add (1, std::memory_order_release);
+            globalGeneration.fetch_add (1, std::memory_order_release);
+        }
+
+        void resyncFromParameters() noexcept
+        {
+            for (auto& slot : slots)
+                if (auto* p = slot.parameter.load (std::memory_order_acquire))
+                    setAudioValue (slot, p->getValue());
+        }
+
+        int findOrAllocateSlot (const juce::String& fullPath, float fallback)
+        {
+            auto it = slotIndices.find (fullPath);
+            if (it != slotIndices.end())
+                return it->second;
+
+            if (numSlots >= maxParameters)
+            {
+                jassertfalse; // Raise maxParameters
+                return -1;
+            }
+
+            int index = numSlots++;
+            slots[(size_t)index].fallback = fallback;
+            slots[(size_t)index].audioValue.store (fallback, std::memory_order_relaxed);
+            slotIndices[fullPath] = index;
+            return index;
+        }
+
+        // Caller holds pathLock
+        void registerParameter (const juce::String& modulePath, const juce::String& fullPath, ManagedParameter* param)
+        {
+            int group = findOrAllocateGroup (modulePath);
+            int index = findOrAllocateSlot (fullPath, param->getValue());
+
+            if (index >= 0)
+            {
+                // Group and value must be in place before the pointer is published
+                auto& slot = slots[(size_t)index];
+                slot.group = group;
+                slot.audioValue.store (param->getValue(), std::memory_order_relaxed);
+                slot.parameter.store (param, std::memory_order_release);
+                param->setChangeSink (this, index);
+            }
+
+            // A newly bound slot stops reading its fallback, so treat registration as a change
+            if (group >= 0)
+                groupGenerations[(size_t)group].fetch_add (1, std::memory_order_release);
+            globalGeneration.fetch_add (1, std::memory_order_release);
+        }
+
+        int findOrAllocateGroup (const juce::String& modulePath)
+        {
+            auto it = groupIndices.find (modulePath);
+            if (it != groupIndices.end())
+                return it->second;
+
+            if (numGroups >= maxGroups)
+            {
+                jassertfalse; // Raise maxGroups
+                return -1;
+            }
+
+            int index = numGroups++;
+            groupIndices[modulePath] = index;
+            return index;
+        }
+
+        // Guards the path maps against the patch loader thread; never taken on the audio thread
+        juce::CriticalSection pathLock;
+
         std::map<juce::String, std::unique_ptr<ManagedParameter>> parameters;
-        
+        bool layoutComplete = false;
+
+        std::map<juce::String, int> slotIndices;
+        std::array<Slot, maxParameters> slots;
+        int numSlots = 0;
+
+        std::map<juce::String, int> groupIndices;
+        std::array<std::atomic<uint32_t>, maxGroups> groupGenerations {};
+        std::atomic<uint32_t> globalGeneration { 0 };
+        int numGroups = 0;
+
+        ParameterEventQueue eventQueue;
+        std::atomic<bool> resyncRequested { false };
+
+        // Audio thread only: this block's events, in offset order
+        std::array<ParameterEvent, ParameterEventQueue::capacity> scheduled;
+        int numScheduled = 0, nextScheduled = 0, blockSize = 0;
+        double lastBlockTimeMs = 0.0;
+
         JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (ParameterRegistry)
     };
 }
@@ -0,0 +1,173 @@
+#pragma once
+
+#include <juce_gui_basics/juce_gui_basics.h>
+#include <array>
+#include <atomic>
+#include <memory>
+#include <vector>
+#include "NeonParameterRegistry.h"
+#include "NeonBankFile.h"
+
+namespace neon
+{
+    /**
+     * PatchLoader
+     * Background thread behind MIDI Program Change and Bank Select. The audio thread only
+     * posts the request; the loader reads the patch from its BankFile, resolves every value
+     * to a ParameterHandle and hands the finished snapshot back through a lock-free
+     * triple buffer. The audio thread applies it whole at the next block boundary, so the
+     * callback never touches the filesystem or allocates.
+     */
+    class PatchLoader : private juce::Thread
+    {
+    public:
+        explicit PatchLoader (ParameterRegistry& parameterRegistry)
+            : juce::Thread ("Neon Patch Loader"), registry (parameterRegistry)
+        {
+            for (auto& s : snapshots)
+                s.values.reserve ((size_t)ParameterRegistry::maxParameters);
+        }
+
+        ~PatchLoader() override { stop(); }
+
+        void start() { startThread(); }
+        void stop() { stopThread (1000); }
+
+        /** Message thread: where patches live and which bank Program Changes address. */
+        void setBanks (const std::vector<std::shared_ptr<BankFile>>& newBanks, int currentBankIndex)
+        {
+            const juce::ScopedLock sl (lock);
+            banks = newBanks;
+            bankIndex = currentBankIndex;
+        }
+
+        // -------- Audio thread --------
+
+        /** Realtime-safe: load patch `index` of the current bank. */
+        void requestProgram (int index) noexcept { requestedProgram.store (index, std::memory_order_release); }
+
+        /** Realtime-safe: switch bank and load its first patch, like PatchManager::selectBank(). */
+        void requestBank (int index) noexcept { requestedBank.store (index, std::memory_order_release); }
+
+        /** Realtime-safe: applies the newest finished snapshot, if any. Returns true if one was applied. */
+        bool applyPendingSnapshot() noexcept
+        {
+            if ((sharedIndex.load (std::memory_order_acquire) & freshBit) == 0)
+                return false;
+
+            frontIndex = sharedIndex.exchange (frontIndex, std::memory_order_acq_rel) & indexMask;
+
+            for (auto& [handle, value] : snapshots[(size_t)frontIndex].values)
+                registry.setValueFromAudioThread (handle, value);
+
+            return true;
+        }
+
+        // -------- Message thread --------
+
+        struct LoadedPatch
+        {
+            int bankIndex = -1;
+            int patchIndex = -1;
+            juce::String name;
+        };
+
+        /** The patch most recently handed to the audio thread. */
+        LoadedPatch getLastLoaded() const
+        {
+            const juce::ScopedLock sl (lock);
+            return lastLoaded;
+        }
+
+    private:
+        struct Snapshot
+        {
+            std::vector<std::pair<ParameterHandle, float>> values;
+        };
+
+        void run() override
+        {
+            while (! threadShouldExit())
+            {
+                // Poll rather than notify(): signalling a WaitableEvent takes a lock
+                wait (10);
+
+                int bank = requestedBank.exchange (-1, std::memory_order_acquire);
+                int program = requestedProgram.exchange (-1, std::memory_order_acquire);
+
+                if (bank >= 0 || program >= 0)
+                    load (bank, program);
+            }
+        }
+
+        void load (int bank, int program)
+        {
+            std::shared_ptr<BankFile> bankFile;
+            LoadedPatch info;
+            {
+                const juce::ScopedLock sl (lock);
+
+                if (juce::isPositiveAndBelow (bank, (int)banks.size()))
+                {
+                    bankIndex = bank;
+                    if (program < 0)
+                        program = 0;
+                }
+
+                if (! juce::isPositiveAndBelow (program, BankFile::numPatches) || ! juce::isPositiveAndBelow (bankIndex, (int)banks.size()))
+                    return;
+
+                bankFile = banks[(size_t)bankIndex];
+                info.bankIndex = bankIndex;
+                info.patchIndex = program;
+            }
+
+            auto& values = snapshots[(size_t)backIndex].values;
+            values.clear();
+
+            // Another process may have rebuilt the bank since it was mapped
+            bankFile->reopenIfReplaced();
+
+            int numStored = bankFile->readPatch (program, info.name, [&] (const juce::String& id, float value)
+            {
+                auto handle = registry.findRegisteredHandle (id);
+                if (handle.isValid())
+                    values.push_back ({ handle, value });
+            });
+
+            // An empty slot is effectively an INIT patch
+            if (numStored == 0)
+                registry.getRegisteredDefaults (values);
+
+            {
+                const juce::ScopedLock sl (lock);
+                lastLoaded = info;
+            }
+
+            backIndex = sharedIndex.exchange (backIndex | freshBit, std::memory_order_acq_rel) & indexMask;
+        }
+
+        // Triple buffer: the loader fills back, the audio thread reads front, and the
+        // middle one is swapped through sharedIndex (fresh bit = not yet picked up).
+        static constexpr int indexMask = 3;
+        static constexpr int freshBit = 4;
+
+        ParameterRegistry& registry;
+
+        std::array<Snapshot, 3> snapshots;
+        std::atomic<int> sharedIndex { 1 };
+        int backIndex = 0;   // loader thread
+        int frontIndex = 2;  // audio thread
+
+        std::atomic<int> requestedProgram { -1 };
+        std::atomic<int> requestedBank { -1 };
+
+        // Loader <-> message thread only
+        juce::CriticalSection lock;
+        std::vector<std::shared_ptr<BankFile>> banks;
+        int bankIndex = 0;
+        LoadedPatch lastLoaded;
+
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (PatchLoader)
+    };
+}
@@ -3,21 +3,37 @@
 #include <juce_gui_basics/juce_gui_basics.h>
 #include "NeonParameterRegistry.h"
 #include "NeonRegistry.h"
+#include "NeonBankFile.h"
+#include "NeonPatchLoader.h"
 
 namespace neon
 {
     /**
      * PatchManager
-     * Handles filesystem operations for banks and patches.
+     * Handles filesystem operations for banks and patches. Each bank is one
+     * memory-mapped BankFile; older banks stored as folders of JSON patches are
+     * imported the first time they are scanned.
      * Manages current patch state and MIDI integration.
+     * One per plugin instance; operates on that instance's registries.
+     *
+     * Everything here runs on the message thread except the MIDI section, which the
+     * processor calls from processBlock and which defers the file work to a PatchLoader.
      */
-    class PatchManager
+    class PatchManager : private juce::AsyncUpdater
     {
     public:
-        static PatchManager& getInstance()
+        // Sub-folder of the root where users drop their own wavetables; never a bank
+        static constexpr const char* wavetableFolderName = "Wavetables";
+
+        PatchManager (ParameterRegistry& parameterRegistry, NeonRegistry& neonRegistry)
+            : registry (parameterRegistry), uiRegistry (neonRegistry), loader (parameterRegistry)
         {
-            static PatchManager instance;
-            return instance;
+        }
+
+        ~PatchManager() override
+        {
+            loader.stop();
+            cancelPendingUpdate();
         }
 
         void initialize (const juce::String& appName)
@@ -41,38 +57,54 @@ namespace neon
             if (!rootDir.exists())
                 rootDir.createDirectory();
 
+            getWavetableDirectory().createDirectory();
+
             scanBanks();
             
             // 2. Deployment Safety
             // If "Factory" bank is missing, create it. 
             // If it exists, we DON'T touch it to avoid overwriting user changes to factory sounds.
-            if (!rootDir.getChildFile ("Factory").exists())
+            if (! bankNames.contains ("Factory"))
                 createNewBank ("Factory");
             
             if (bankNames.isEmpty())
                 scanBanks();
 
             selectBank (0);
+            loader.start();
         }
 
         void scanBanks()
         {
             bankNames.clear();
-            if (!rootDir.exists()) return;
+            std::vector<std::shared_ptr<BankFile>> scanned;
 
-            auto banks = rootDir.findChildFiles (juce::File::findDirectories, false);
-            for (auto& b : banks)
-                bankNames.add (b.getFileName());
-            bankNames.sort (true);
+            if (rootDir.exists())
+            {
+                // Banks from before the .neonbank format: a folder of patch_N.neon files
+                for (auto& dir : rootDir.findChildFiles (juce::File::findDirectories, false))
+                    if (auto bankFile = getBankFile (dir.getFileName()); ! bankFile.exists() && dir != getWavetableDirectory())
+                        BankFile::importJsonBank (dir, bankFile);
+
+                for (auto& f : rootDir.findChildFiles (juce::File::findFiles, false, juce::String ("*") + BankFile::fileExtension))
+                    bankNames.add (f.getFileNameWithoutExtension());
+                bankNames.sort (true);
+
+                // One mapping per bank, shared with every other instance in the process
+                for (auto& name : bankNames)
+                    scanned.push_back (BankFile::getShared (getBankFile (name)));
+            }
+
+            banks = std::move (scanned);
+            loader.setBanks (banks, currentBankIndex);
         }
 
         void createNewBank (const juce::String& bankName)
         {
-            auto bankDir = rootDir.getChildFile (bankName);
-            if (!bankDir.exists())
-                bankDir.createDirectory();
+            auto bankFile = getBankFile (bankName);
+            if (! bankFile.exists())
+                BankFile::createEmpty (bankFile);
 
-            ensureInitPatches (bankDir);
             scanBanks();
             
             int newIdx = bankNames.indexOf (bankName);
@@ -84,106 +116,108 @@ namespace neon
             if (index < 0 || index >= bankNames.size()) return;
             currentBankIndex = index;
             currentBank = bankNames[index];
+            loader.setBanks (banks, currentBankIndex);
             scanPatches();
             loadPatch (0);
         }
 
         void scanPatches()
         {
-            patchNames.clear();
-            auto bankDir = rootDir.getChildFile (currentBank);
-            
-            auto indexFile = bankDir.getChildFile ("index.txt");
-            if (indexFile.exists())
-            {
-                patchNames.addLines (indexFile.loadFileAsString());
-            }
-            
+            reopenCurrentBankIfReplaced();
+
+            if (auto* bank = getCurrentBank())
+                patchNames = bank->getPatchNames();
+            else
+                patchNames.clear();
+
             // Ensure we have 128 entries
-            while (patchNames.size() < 128)
+            while (patchNames.size() < BankFile::numPatches)
                 patchNames.add ("INIT PATCH");
-            
-            if (patchNames.size() > 128)
-                patchNames.removeRange (128, patchNames.size() - 128);
-        }
-
-        void updateIndexFile()
-        {
-            auto bankDir = rootDir.getChildFile (currentBank);
-            auto indexFile = bankDir.getChildFile ("index.txt");
-            indexFile.replaceWithText (patchNames.joinIntoString ("\n"));
         }
 
         void loadPatch (int index)
         {
             if (index < 0 || index >= 128) return;
             currentPatchIndex = index;
-            
-            juce::String filename = juce::String ("patch_") + juce::String (index + 1) + ".neon";
-            auto file = rootDir.getChildFile (currentBank).getChildFile (filename);
-            
-            if (file.exists())
-            {
-                auto json = juce::JSON::parse (file);
-                if (json.isObject())
-                {
-                    auto patchName = json.getProperty ("name", "INIT PATCH").toString();
-                    NeonRegistry::setCurrentPatchName (patchName);
 
-                    auto paramsObj = json.getProperty ("parameters", juce::var());
-                    if (paramsObj.isObject())
-                    {
-                        auto& registry = ParameterRegistry::getInstance();
-                        auto* dynamicObj = paramsObj.getDynamicObject();
-                        for (auto& it : dynamicObj->getProperties())
-                        {
-                            if (auto* p = registry.getParameter (it.name.toString()))
-                                p->setValue ((float)it.value);
-                        }
-                    }
-                }
-            }
-            else
+            reopenCurrentBankIfReplaced();
+            auto* bank = getCurrentBank();
+            if (bank == nullptr)
             {
-                // If file doesn't exist, it's effectively an INIT patch
                 initPatch();
-                NeonRegistry::setCurrentPatchName ("INIT PATCH");
+                return;
             }
+
+            juce::String patchName;
+            int numStored = bank->readPatch (index, patchName, [this] (const juce::String& id, float value)
+            {
+                if (auto* p = registry.getParameter (id))
+                    p->setValue (value);
+            });
+
+            // An empty slot is effectively an INIT patch
+            if (numStored == 0)
+                initPatch();
+
+            uiRegistry.setCurrentPatchName (patchName);
         }
 
-        void savePatch (const juce::String& name, int index = -1)
+        /** Returns false if nothing was written, so the librarian can say so. */
+        bool savePatch (const juce::String& name, int index = -1)
         {
             int targetIndex = (index == -1) ? currentPatchIndex : index;
-            if (targetIndex < 0 || targetIndex >= 128) return;
-
-            juce::String filename = juce::String ("patch_") + juce::String (targetIndex + 1) + ".neon";
-            auto bankDir = rootDir.getChildFile (currentBank);
-            if (!bankDir.exists()) bankDir.createDirectory();
-            
-            auto file = bankDir.getChildFile (filename);
+            if (targetIndex < 0 || targetIndex >= 128) return false;
 
-            juce::DynamicObject::Ptr obj = new juce::DynamicObject();
-            obj->setProperty ("name", name);
-            
-            juce::DynamicObject::Ptr params = new juce::DynamicObject();
-            auto& registry = ParameterRegistry::getInstance();
-            for (auto& pair : registry.getParameters())
-            {
-                // Don't save Librarian navigation parameters into the patch
-                if (pair.first.contains ("Librarian"))
-                    continue;
+            auto* bank = getCurrentBank();
+            if (bank == nullptr || ! bank->writePatch (targetIndex, name, collectPatchValues()))
+                return false;
 
-                params->setProperty (pair.first, pair.second->getValue());
-            }
-            obj->setProperty ("parameters", juce::var(params));
-
-            file.replaceWithText (juce::JSON::toString (juce::var(obj)));
-            
             if (targetIndex == currentPatchIndex)
-                NeonRegistry::setCurrentPatchName (name);
+                uiRegistry.setCurrentPatchName (name);
 
             patchNames.set (targetIndex, name);
-            updateIndexFile();
+            return true;
+        }
+
+        // -------- JSON import / export --------
+
+        /** Imports a folder of patch_N.neon files as a new bank named after the folder. */
+        bool importJsonBank (const juce::File& sourceDir)
+        {
+            auto bankFile = getBankFile (sourceDir.getFileName());
+            if (bankFile.exists() || ! BankFile::importJsonBank (sourceDir, bankFile))
+                return false;
+
+            scanBanks();
+            selectBank (bankNames.indexOf (sourceDir.getFileName()));
+            return true;
+        }
+
+        /** Exports the current bank as patch_N.neon files plus index.txt. */
+        bool exportJsonBank (const juce::File& destDir) const
+        {
+            auto* bank = getCurrentBank();
+            return bank != nullptr && bank->exportJsonBank (destDir);
+        }
+
+        /** Imports a single .neon JSON patch into a slot of the current bank and loads it. */
+        bool importJsonPatch (const juce::File& jsonFile, int index)
+        {
+            juce::String name ("INIT PATCH");
+            BankFile::PatchValues values;
+            auto* bank = getCurrentBank();
+            if (bank == nullptr || ! BankFile::readJsonPatch (jsonFile, name, values) || ! bank->writePatch (index, name, values))
+                return false;
+
+            patchNames.set (index, name);
+            loadPatch (index);
+            return true;
+        }
+
+        /** Exports the current parameter state as a .neon JSON patch. */
+        bool exportJsonPatch (const juce::File& jsonFile) const
+        {
+            return BankFile::writeJsonPatch (jsonFile, uiRegistry.getCurrentPatchName(), collectPatchValues());
         }
 
         int findFirstEmptySlot()
@@ -198,12 +232,11 @@ namespace neon
 
         void initPatch()
         {
-            auto& registry = ParameterRegistry::getInstance();
             for (auto& pair : registry.getParameters())
             {
                 pair.second->setValue (pair.second->getDefaultValue());
             }
-            NeonRegistry::setCurrentPatchName ("INIT PATCH");
+            uiRegistry.setCurrentPatchName ("INIT PATCH");
         }
 
         void nextBank()
@@ -234,15 +267,19 @@ namespace neon
             loadPatch (prevIndex);
         }
 
-        void renameBank (const juce::String& newName)
+        bool renameBank (const juce::String& newName)
         {
-            auto oldDir = rootDir.getChildFile (currentBank);
-            auto newDir = rootDir.getChildFile (newName);
-            if (oldDir.moveFileTo (newDir))
-            {
-                scanBanks();
-                selectBank (bankNames.indexOf (newName));
-            }
+            auto* bank = getCurrentBank();
+            auto newFile = getBankFile (newName);
+            if (bank != nullptr && newFile == bank->getFile())
+                return true;
+
+            if (bank == nullptr || newFile.exists() || ! bank->moveTo (newFile))
+                return false;
+
+            scanBanks();
+            selectBank (bankNames.indexOf (newName));
+            return true;
         }
 
         juce::StringArray getBankNames() const { return bankNames; }
@@ -250,61 +287,137 @@ namespace neon
         juce::String getCurrentBankName() const { return currentBank; }
         int getCurrentBankIndex() const { return currentBankIndex; }
         int getCurrentPatchIndex() const { return currentPatchIndex; }
+        juce::File getWavetableDirectory() const { return rootDir.getChildFile (wavetableFolderName); }
+
+        // -------- MIDI Program Change / Bank Select (audio thread) --------
+
+        /** Realtime-safe: queue a Program Change; the patch is read on the loader thread. */
+        void requestProgramChange (int index) noexcept { loader.requestProgram (index); }
+
+        /** Realtime-safe: queue a Bank Select (CC 0 / 32); loads the bank's first patch. */
+        void requestBankSelect (int index) noexcept { loader.requestBank (index); }
+
+        /**
+         * Realtime-safe: call at the top of processBlock, before the engine reads parameters.
+         * Applies a patch the loader has finished since the last block.
+         */
+        void applyPendingProgramChange() noexcept
+        {
+            if (loader.applyPendingSnapshot())
+                triggerAsyncUpdate();
+        }
 
         // -------- Host-managed state (DAW save/restore, called from AudioProcessor) --------
 
-        /** Serialize the full ParameterRegistry into a MemoryBlock for the host to persist. */
+        /**
+         * Serialize the ParameterRegistry into a compact binary chunk for the host to persist:
+         *
+         *     "NSTA", version, flags, patch name, bank name, bank index, patch index,
+         *     parameter count, parameter-id table (zero-terminated UTF-8), packed floats
+         *
+         * Only values that differ from their default are written; loading resets the rest.
+         */
         void saveStateToMemory (juce::MemoryBlock& destData) const
         {
-            juce::DynamicObject::Ptr obj = new juce::DynamicObject();
-            obj->setProperty ("name", NeonRegistry::getCurrentPatchName());
-            obj->setProperty ("bank", currentBank);
-            obj->setProperty ("bankIndex", currentBankIndex);
-            obj->setProperty ("patchIndex", currentPatchIndex);
-
-            juce::DynamicObject::Ptr params = new juce::DynamicObject();
-            auto& registry = ParameterRegistry::getInstance();
+            juce::StringArray ids;
+            std::vector<float> values;
             for (auto& pair : registry.getParameters())
             {
                 if (pair.first.contains ("Librarian"))
                     continue;
-                params->setProperty (pair.first, pair.second->getValue());
+
+                auto value = pair.second->getValue();
+                if (value == pair.second->getDefaultValue())
+                    continue;
+
+                ids.add (pair.first);
+                values.push_back (value);
             }
-            obj->setProperty ("parameters", juce::var (params));
 
-            auto json = juce::JSON::toString (juce::var (obj));
-            destData.reset();
-            destData.append (json.toRawUTF8(), json.getNumBytesAsUTF8());
+            juce::MemoryOutputStream out (destData, false);
+            out.writeInt (stateMagic);
+            out.writeInt (stateVersion);
+            out.writeByte ((char)stateOnlyNonDefaults);
+            out.writeString (uiRegistry.getCurrentPatchName());
+            out.writeString (currentBank);
+            out.writeInt (currentBankIndex);
+            out.writeInt (currentPatchIndex);
+
+            out.writeInt (ids.size());
+            for (auto& id : ids)
+                out.writeString (id);
+            for (auto v : values)
+                out.writeFloat (v);
         }
 
-        /** Restore parameters previously written by saveStateToMemory. */
+        /** Restore parameters written by saveStateToMemory, or by the older JSON format. */
         void loadStateFromMemory (const void* data, int sizeInBytes)
         {
             if (data == nullptr || sizeInBytes <= 0)
                 return;
 
-            auto json = juce::String::fromUTF8 (static_cast<const char*> (data), sizeInBytes);
-            auto parsed = juce::JSON::parse (json);
-            if (! parsed.isObject())
+            juce::MemoryInputStream in (data, (size_t)sizeInBytes, false);
+            if (sizeInBytes < 8 || in.readInt() != stateMagic)
+            {
+                loadJsonState (data, sizeInBytes);
+                return;
+            }
+
+            if (in.readInt() > stateVersion)
                 return;
 
-            auto patchName = parsed.getProperty ("name", "INIT PATCH").toString();
-            NeonRegistry::setCurrentPatchName (patchName);
+            auto flags = (juce::uint8)in.readByte();
+            auto patchName = in.readString();
+            auto bank = in.readString();
+            in.readInt(); // bank index: resolved from the name, indices shift as banks are added
+            restoreLibrarianState (patchName, bank, in.readInt());
 
-            if (auto bankProp = parsed.getProperty ("bank", juce::var()); bankProp.isString())
+            auto numValues = in.readInt();
+            if (numValues < 0 || numValues > ParameterRegistry::maxParameters)
+                return;
+
+            std::vector<ManagedParameter*> targets ((size_t)numValues);
+            for (auto& target : targets)
+                target = registry.getParameter (in.readString());
+
+            if (in.getNumBytesRemaining() < (juce::int64)numValues * (juce::int64)sizeof (float))
+                return;
+
+            // Anything not in a sparse chunk was at its default when saved
+            if ((flags & stateOnlyNonDefaults) != 0)
+                for (auto& pair : registry.getParameters())
+                    if (! pair.first.contains ("Librarian"))
+                        pair.second->setValue (pair.second->getDefaultValue());
+
+            for (auto* target : targets)
             {
-                int idx = bankNames.indexOf (bankProp.toString());
-                if (idx >= 0)
-                    currentBankIndex = idx;
-                currentBank = bankProp.toString();
+                auto value = in.readFloat();
+                if (target != nullptr)
+                    target->setValue (value);
             }
-            if (auto pIdx = parsed.getProperty ("patchIndex", juce::var()); pIdx.isInt())
-                currentPatchIndex = (int) pIdx;
+        }
+
+    private:
+        static constexpr int stateMagic = 0x4154534e; // "NSTA"
+        static constexpr int stateVersion = 1;
+        static constexpr juce::uint8 stateOnlyNonDefaults = 1;
+
+        // Host state saved before the binary chunk existed
+        void loadJsonState (const void* data, int sizeInBytes)
+        {
+            auto json = juce::String::fromUTF8 (static_cast<const char*> (data), sizeInBytes);
+            auto parsed = juce::JSON::parse (json);
+            if (! parsed.isObject())
+                return;
+
+            auto pIdx = parsed.getProperty ("patchIndex", juce::var());
+            restoreLibrarianState (parsed.getProperty ("name", "INIT PATCH").toString(),
+                                   parsed.getProperty ("bank", juce::var()).toString(),
+                                   pIdx.isInt() ? (int)pIdx : currentPatchIndex);
 
             auto paramsObj = parsed.getProperty ("parameters", juce::var());
             if (paramsObj.isObject())
             {
-                auto& registry = ParameterRegistry::getInstance();
                 if (auto* dynamicObj = paramsObj.getDynamicObject())
                 {
                     for (auto& it : dynamicObj->getProperties())
@@ -316,42 +429,84 @@ namespace neon
             }
         }
 
-    private:
-        PatchManager() = default;
+        void restoreLibrarianState (const juce::String& patchName, const juce::String& bank, int patchIndex)
+        {
+            uiRegistry.setCurrentPatchName (patchName);
+
+            if (bank.isNotEmpty())
+            {
+                int idx = bankNames.indexOf (bank);
+                if (idx >= 0)
+                    currentBankIndex = idx;
+                currentBank = bank;
+                loader.setBanks (banks, currentBankIndex);
+            }
 
-        void ensureInitPatches (const juce::File& bankDir)
+            currentPatchIndex = patchIndex;
+        }
+
+        // A MIDI-requested patch is now live: bring the librarian state in line with it
+        void handleAsyncUpdate() override
         {
-            juce::StringArray names;
-            for (int i = 0; i < 128; ++i)
+            auto loaded = loader.getLastLoaded();
+
+            if (loaded.bankIndex != currentBankIndex && juce::isPositiveAndBelow (loaded.bankIndex, bankNames.size()))
             {
-                juce::String filename = juce::String ("patch_") + juce::String (i + 1) + ".neon";
-                auto file = bankDir.getChildFile (filename);
-                if (!file.exists())
-                {
-                    juce::DynamicObject::Ptr obj = new juce::DynamicObject();
-                    obj->setProperty ("name", "INIT PATCH");
-                    file.replaceWithText (juce::JSON::toString (juce::var(obj)));
-                }
-                names.add (getPatchNameFromFile(file));
+                currentBankIndex = loaded.bankIndex;
+                currentBank = bankNames[loaded.bankIndex];
+                scanPatches();
             }
 
-            auto indexFile = bankDir.getChildFile ("index.txt");
-            if (!indexFile.exists())
-                indexFile.replaceWithText (names.joinIntoString ("\n"));
+            if (loaded.patchIndex >= 0)
+                currentPatchIndex = loaded.patchIndex;
+
+            uiRegistry.setCurrentPatchName (loaded.name);
+        }
+
+        juce::File getBankFile (const juce::String& bankName) const
+        {
+            return rootDir.getChildFile (bankName + BankFile::fileExtension);
+        }
+
+        void reopenCurrentBankIfReplaced()
+        {
+            if (juce::isPositiveAndBelow (currentBankIndex, (int)banks.size()))
+                banks[(size_t)currentBankIndex]->reopenIfReplaced();
         }
 
-        juce::String getPatchNameFromFile (const juce::File& file)
+        BankFile* getCurrentBank() const
         {
-            auto json = juce::JSON::parse (file);
-            return json.getProperty ("name", "INIT PATCH").toString();
+            if (juce::isPositiveAndBelow (currentBankIndex, (int)banks.size()) && banks[(size_t)currentBankIndex]->isValid())
+                return banks[(size_t)currentBankIndex].get();
+            return nullptr;
+        }
+
+        BankFile::PatchValues collectPatchValues() const
+        {
+            BankFile::PatchValues values;
+            for (auto& pair : registry.getParameters())
+            {
+                // Don't save Librarian navigation parameters into the patch
+                if (pair.first.contains ("Librarian"))
+                    continue;
+
+                values.push_back ({ pair.first, pair.second->getValue() });
+            }
+            return values;
         }
 
+        ParameterRegistry& registry;
+        NeonRegistry& uiRegistry;
+
         juce::File rootDir;
         juce::String currentBank;
         int currentBankIndex = 0;
         int currentPatchIndex = 0;
         juce::StringArray bankNames;
         juce::StringArray patchNames;
+        std::vector<std::shared_ptr<BankFile>> banks;
+
+        PatchLoader loader;
 
         JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (PatchManager)
     };
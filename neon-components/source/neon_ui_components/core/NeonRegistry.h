@@ -3,6 +3,7 @@
 #include <juce_audio_basics/juce_audio_basics.h>
 #include <vector>
 #include <map>
+#include <memory>
 
 #include "NeonColors.h"
 
@@ -12,50 +13,19 @@ namespace neon
      * NeonRegistry
      * A central place for the host application to register its modulation targets, 
      * control sources, filter types, and wavetables.
+     * One per plugin instance (see NeonInstance); the lists themselves are immutable
+     * and can be shared between instances.
      */
     class NeonRegistry
     {
     public:
-        // Theme
-        static void setTheme(const Theme& theme) { get().theme = theme; }
-        static Theme getTheme() { return get().theme; }
-
-        // Modulation Targets
-        static void setTargetNames(const std::vector<juce::String>& names) { get().targetNames = names; }
-        static std::vector<juce::String> getTargetNames() { return get().targetNames; }
-
-        // Control Sources
-        static void setSourceNames(const std::vector<juce::String>& names) { get().sourceNames = names; }
-        static std::vector<juce::String> getSourceNames() { return get().sourceNames; }
-
-        // Filter Types
-        static void setFilterTypes(const std::vector<juce::String>& types) { get().filterTypes = types; }
-        static std::vector<juce::String> getFilterTypes() { return get().filterTypes; }
-
-        // Wavetables
-        static void setWaveformNames(const std::vector<juce::String>& names) { get().waveNames = names; }
-        static std::vector<juce::String> getWaveformNames() { return get().waveNames; }
-
-        static void setWaveformBuffer(int index, juce::AudioBuffer<float>* buffer) { get().waveBuffers[index] = buffer; }
-        static juce::AudioBuffer<float>* getWaveformBuffer(int index) { 
-            if (get().waveBuffers.count(index)) return get().waveBuffers[index];
-            return nullptr;
-        }
-
-        static void setCurrentPatchName(const juce::String& name) { get().patchName = name; }
-        static juce::String getCurrentPatchName() { return get().patchName; }
-
-    private:
-        static NeonRegistry& get() {
-            static NeonRegistry instance;
-            return instance;
-        }
+        using StringList = std::shared_ptr<const std::vector<juce::String>>;
 
         NeonRegistry() {
-            targetNames = { "None" };
-            sourceNames = { "None" };
-            filterTypes = { "LP", "HP", "BP" };
-            waveNames = { "Sine" };
+            targetNames = makeList ({ "None" });
+            sourceNames = makeList ({ "None" });
+            filterTypes = makeList ({ "LP", "HP", "BP" });
+            waveNames = makeList ({ "Sine" });
 
             // Initialize theme from default Colors
             theme.background = Colors::background;
@@ -73,18 +43,46 @@ namespace neon
             theme.indicator = Colors::indicator;
         }
 
+        static StringList makeList (std::vector<juce::String> names) { return std::make_shared<const std::vector<juce::String>> (std::move (names)); }
+
+        // Theme
+        void setTheme(const Theme& newTheme) { theme = newTheme; }
+        const Theme& getTheme() const { return theme; }
+
+        // Modulation Targets
+        void setTargetNames(StringList names) { targetNames = std::move (names); }
+        const std::vector<juce::String>& getTargetNames() const { return *targetNames; }
+
+        // Control Sources
+        void setSourceNames(StringList names) { sourceNames = std::move (names); }
+        const std::vector<juce::String>& getSourceNames() const { return *sourceNames; }
+
+        // Filter Types
+        void setFilterTypes(StringList types) { filterTypes = std::move (types); }
+        const std::vector<juce::String>& getFilterTypes() const { return *filterTypes; }
+
+        // Wavetables
+        void setWaveformNames(StringList names) { waveNames = std::move (names); }
+        const std::vector<juce::String>& getWaveformNames() const { return *waveNames; }
+
+        void setWaveformBuffer(int index, const juce::AudioBuffer<float>* buffer) { waveBuffers[index] = buffer; }
+        const juce::AudioBuffer<float>* getWaveformBuffer(int index) const { 
+            auto it = waveBuffers.find (index);
+            return it != waveBuffers.end() ? it->second : nullptr;
+        }
+
+        void setCurrentPatchName(const juce::String& name) { patchName = name; }
+        juce::String getCurrentPatchName() const { return patchName; }
+
+    private:
         Theme theme;
-        std::vector<juce::String> targetNames;
-        std::vector<juce::String> sourceNames;
-        std::vector<juce::String> filterTypes;
-        std::vector<juce::String> waveNames;
-        std::map<int, juce::AudioBuffer<float>*> waveBuffers;
+        StringList targetNames;
+        StringList sourceNames;
+        StringList filterTypes;
+        StringList waveNames;
+        std::map<int, const juce::AudioBuffer<float>*> waveBuffers;
         juce::String patchName = "INIT PATCH";
-    };
 
-    /**
-     * Helper functions to keep existing UI code working or provide shorter access.
-     */
-    static inline std::vector<juce::String> getModTargetNames() { return NeonRegistry::getTargetNames(); }
-    static inline std::vector<juce::String> getCtrlSourceNames() { return NeonRegistry::getSourceNames(); }
+        JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (NeonRegistry)
+    };
 }
@@ -0,0 +1,184 @@
+#pragma once
+
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <cmath>
+
+namespace neon
+{
+    /**
+     * Adaa
+     * Antiderivative anti-aliasing for memoryless shapers. Rather than f (x[n]), the output
+     * is the average of f over the segment the input travelled since the last sample,
+     * computed from closed-form antiderivatives. That removes most of the aliasing that
+     * drive, folding and bit reduction generate, without oversampling the voice:
+     *
+     *     Adaa::History history;                                      // one per lane and stage
+     *     y = Adaa::process (Adaa::Fold(), Adaa::firstOrder, history, x);
+     *
+     * First order costs one extra antiderivative per sample and delays by half a sample,
+     * second order is cleaner, costs more and delays by a whole sample. Both switch to
+     * f at the midpoint when the input barely moves, so the divisions stay well
+     * conditioned. The arithmetic is in double for the same reason.
+     *
+     * A shaper is any type with f, F1 and F2 (the function and its first two antiderivatives).
+     */
+    struct Adaa
+    {
+        enum Order { off, firstOrder, secondOrder };
+
+        /** The previous two inputs of one shaper lane. */
+        struct History
+        {
+            double x1 = 0.0, x2 = 0.0;
+        };
+
+        /** fastmath::softClip, the engines' drive curve: a 3/2 Pade of tanh, flat past +-3. */
+        struct SoftClip
+        {
+            static double f (double x) noexcept
+            {
+                const double c = juce::jlimit (-3.0, 3.0, x);
+                return c * (27.0 + c * c) / (27.0 + 9.0 * c * c);
+            }
+
+            // Inside +-3: f = x / 9 + (8 / 3) * x / (x^2 + 3)
+            static double F1 (double x) noexcept
+            {
+                const double a = std::abs (x);
+                if (a <= 3.0)
+                    return x * x / 18.0 + (4.0 / 3.0) * std::log ((x * x + 3.0) / 3.0);
+
+                return F1at3 + (a - 3.0);
+            }
+
+            static double F2 (double x) noexcept
+            {
+                const double a = std::abs (x);
+                if (a <= 3.0)
+                    return inner (x);
+
+                const double d = a - 3.0;
+                const double p = F2at3 + F1at3 * d + 0.5 * d * d; // F2 is odd
+                return x < 0.0 ? -p : p;
+            }
+
+        private:
+            static double inner (double x) noexcept
+            {
+                constexpr double root3 = 1.7320508075688772;
+                return x * x * x / 54.0
+                     + (4.0 / 3.0) * (x * std::log ((x * x + 3.0) / 3.0) - 2.0 * x + 2.0 * root3 * std::atan (x / root3));
+            }
+
+            static constexpr double F1at3 = 0.5 + (4.0 / 3.0) * 1.3862943611198906; // 1/2 + 4/3 ln 4
+            static inline const double F2at3 = inner (3.0);
+        };
+
+        /** The oscillators' single wavefold: the signal reflects off +-1. */
+        struct Fold
+        {
+            static double f (double x) noexcept
+            {
+                return x > 1.0 ? 2.0 - x : (x < -1.0 ? -2.0 - x : x);
+            }
+
+            static double F1 (double x) noexcept
+            {
+                const double a = std::abs (x);
+                return a <= 1.0 ? 0.5 * x * x : 2.0 * a - 0.5 * x * x - 1.0;
+            }
+
+            static double F2 (double x) noexcept
+            {
+                const double a = std::abs (x);
+                if (a <= 1.0)
+                    return x * x * x / 6.0;
+
+                const double p = a * a - a * a * a / 6.0 - a + 1.0 / 3.0; // F2 is odd
+                return x < 0.0 ? -p : p;
+            }
+        };
+
+        /** Rounds to the nearest of 'steps' levels per unit (the bit reduction stage). */
+        struct Quantize
+        {
+            double steps = 16.0;
+
+            double f (double x) const noexcept { return std::floor (x * steps + 0.5) / steps; }
+
+            // With u = x * steps and k = round (u), the integral of round() from 0 to u is k u - k^2 / 2
+            double F1 (double x) const noexcept
+            {
+                const double u = x * steps;
+                const double k = std::floor (u + 0.5);
+                return (k * u - 0.5 * k * k) / (steps * steps);
+            }
+
+            // ... and that integrated again is k^3 / 6 - k / 24 + k u^2 / 2 - k^2 u / 2
+            double F2 (double x) const noexcept
+            {
+                const double u = x * steps;
+                const double k = std::floor (u + 0.5);
+                return (k * k * k / 6.0 - k / 24.0 + 0.5 * k * u * u - 0.5 * k * k * u) / (steps * steps * steps);
+            }
+        };
+
+        template <typename Shaper>
+        static float process (const Shaper& shaper, Order order, History& h, float input) noexcept
+        {
+            const double x0 = input;
+            double y;
+
+            if (order == secondOrder)
+                y = secondOrderStep (shaper, x0, h.x1, h.x2);
+            else if (order == firstOrder)
+                y = firstOrderStep (shaper, x0, h.x1);
+            else
+                y = shaper.f (x0);
+
+            h.x2 = h.x1;
+            h.x1 = x0;
+            return (float)y;
+        }
+
+    private:
+        static constexpr double tolerance = 1.0e-5;
+
+        template <typename Shaper>
+        static double firstOrderStep (const Shaper& shaper, double x0, double x1) noexcept
+        {
+            const double dx = x0 - x1;
+            if (std::abs (dx) < tolerance)
+                return shaper.f (0.5 * (x0 + x1));
+
+            return (shaper.F1 (x0) - shaper.F1 (x1)) / dx;
+        }
+
+        /** Mean of F1 between a and b, i.e. the divided difference of F2. */
+        template <typename Shaper>
+        static double meanF1 (const Shaper& shaper, double a, double b) noexcept
+        {
+            const double d = a - b;
+            if (std::abs (d) < tolerance)
+                return shaper.F1 (0.5 * (a + b));
+
+            return (shaper.F2 (a) - shaper.F2 (b)) / d;
+        }
+
+        template <typename Shaper>
+        static double secondOrderStep (const Shaper& shaper, double x0, double x1, double x2) noexcept
+        {
+            const double span = x0 - x2;
+            if (std::abs (span) >= tolerance)
+                return 2.0 / span * (meanF1 (shaper, x0, x1) - meanF1 (shaper, x1, x2));
+
+            // x0 and x2 coincide: expand around their midpoint instead
+            const double mid = 0.5 * (x0 + x2);
+            const double delta = mid - x1;
+            if (std::abs (delta) < tolerance)
+                return shaper.f (0.5 * (mid + x1));
+
+            return 2.0 / delta * (shaper.F1 (mid) + (shaper.F2 (x1) - shaper.F2 (mid)) / delta);
+        }
+    };
+}
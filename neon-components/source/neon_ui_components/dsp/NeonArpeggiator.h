@@ -0,0 +1,256 @@
+#pragma once
+
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstdint>
+
+namespace neon
+{
+    /**
+     * Arpeggiator
+     * Held-note arpeggiator with its steps scheduled on the sample grid. All storage is
+     * fixed-size and it never reads the clock, so it is safe on the audio thread, and RANDOM
+     * plays the same order every time the same chord is started from silence.
+     *
+     * The engine treats steps like parameter events: fire what is due at the start of a
+     * segment, render no further than the next event, then advance:
+     *
+     *     arp.setTiming (samplesPerStep, gate);                       // tempo, per segment
+     *     arp.fireDueEvents (startNote, stopNote);                    // (note, velocity), (note)
+     *     int length = juce::jmin (remaining, arp.getSamplesToNextEvent());
+     *     render (length);
+     *     arp.advance (length);
+     *
+     * A step lands on the first sample at or after its exact position and the fraction
+     * carries over, so the pattern does not drift against the tempo.
+     */
+    class Arpeggiator
+    {
+    public:
+        enum Mode { up, down, upDown, random };
+
+        static constexpr int maxOctaves = 4;
+        static constexpr int maxSteps = 2 * 128 * maxOctaves; // UP/DOWN over every key and octave
+
+        void reset() noexcept
+        {
+            held.fill (false);
+            keysDown = 0;
+            numSteps = 0;
+            nextStep = 0;
+            timer = 0.0;
+            sounding = -1;
+            gateOpen = false;
+            randomState = randomSeed;
+        }
+
+        void setMode (int newMode) noexcept
+        {
+            if (newMode != mode)
+            {
+                mode = newMode;
+                rebuild();
+            }
+        }
+
+        void setOctaves (int newOctaves) noexcept
+        {
+            newOctaves = juce::jlimit (1, maxOctaves, newOctaves);
+            if (newOctaves != octaves)
+            {
+                octaves = newOctaves;
+                rebuild();
+            }
+        }
+
+        /** Turning latch off with no keys down lets the latched chord go. */
+        void setLatch (bool shouldLatch) noexcept
+        {
+            if (latch && ! shouldLatch && keysDown == 0)
+                clearHeld();
+
+            latch = shouldLatch;
+        }
+
+        /** Step length in samples (fractional) and the gate as a share of it, 0 .. 1. */
+        void setTiming (double samplesPerStep, float gate) noexcept
+        {
+            stepLength = juce::jmax (1.0, samplesPerStep);
+            gateLength = stepLength * (double)juce::jlimit (0.0f, 1.0f, gate);
+        }
+
+        void noteOn (int note, float velocity) noexcept
+        {
+            if (! juce::isPositiveAndBelow (note, 128))
+                return;
+
+            // A new chord after a latched one replaces it
+            if (latch && keysDown == 0)
+                clearHeld();
+
+            ++keysDown;
+
+            held[(size_t)note] = true;
+            velocities[(size_t)note] = velocity;
+
+            // Starting from silence: the first step plays right away, in a repeatable order
+            const bool starting = ! isRunning();
+            if (starting)
+            {
+                randomState = randomSeed;
+                timer = stepLength;
+                nextStep = 0;
+            }
+
+            rebuild();
+        }
+
+        void noteOff (int note) noexcept
+        {
+            keysDown = juce::jmax (0, keysDown - 1);
+
+            if (latch || ! juce::isPositiveAndBelow (note, 128) || ! held[(size_t)note])
+                return;
+
+            held[(size_t)note] = false;
+            rebuild();
+        }
+
+        /** True while there is a pattern to play (keys held or latched). */
+        bool isRunning() const noexcept { return numSteps > 0; }
+
+        /** Calls startNote (note, velocity) / stopNote (note) for every event due at the current sample. */
+        template <typename StartFn, typename StopFn>
+        void fireDueEvents (StartFn&& startNote, StopFn&& stopNote)
+        {
+            if (! isRunning())
+            {
+                if (sounding != -1)
+                    stopNote (sounding);
+
+                sounding = -1;
+                gateOpen = false;
+                return;
+            }
+
+            if (timer >= stepLength)
+            {
+                timer -= stepLength;
+
+                if (sounding != -1)
+                    stopNote (sounding);
+
+                const auto& step = steps[(size_t)nextStep];
+                nextStep = (nextStep + 1) % numSteps;
+
+                sounding = step.note;
+                gateOpen = true;
+                startNote (step.note, step.velocity);
+            }
+            else if (gateOpen && timer >= gateLength)
+            {
+                gateOpen = false;
+                if (sounding != -1)
+                    stopNote (sounding);
+                sounding = -1;
+            }
+        }
+
+        /** Samples from now to the next step or gate end, at least 1. */
+        int getSamplesToNextEvent() const noexcept
+        {
+            const double nextEvent = gateOpen && gateLength < stepLength ? gateLength : stepLength;
+            return juce::jmax (1, (int)std::ceil (nextEvent - timer));
+        }
+
+        void advance (int numSamples) noexcept
+        {
+            if (isRunning())
+                timer += numSamples;
+        }
+
+        /** Releases the sounding note and forgets the held keys, e.g. when the arp is switched off. */
+        template <typename StopFn>
+        void stop (StopFn&& stopNote)
+        {
+            if (sounding != -1)
+                stopNote (sounding);
+
+            reset();
+        }
+
+    private:
+        struct Step
+        {
+            int note = 0;
+            float velocity = 0.0f;
+        };
+
+        static constexpr uint32_t randomSeed = 0x2545f491;
+
+        void clearHeld() noexcept
+        {
+            held.fill (false);
+            rebuild();
+        }
+
+        void rebuild() noexcept
+        {
+            // Held keys ascending over the octave range; the key array is already sorted
+            numSteps = 0;
+            for (int o = 0; o < octaves; ++o)
+                for (int n = 0; n < 128; ++n)
+                    if (held[(size_t)n] && n + o * 12 <= 127)
+                        steps[(size_t)numSteps++] = { n + o * 12, velocities[(size_t)n] };
+
+            if (mode == down)
+            {
+                std::reverse (steps.begin(), steps.begin() + numSteps);
+            }
+            else if (mode == upDown)
+            {
+                // Back down without repeating the top and bottom notes
+                const int top = numSteps;
+                for (int i = top - 2; i > 0; --i)
+                    steps[(size_t)numSteps++] = steps[(size_t)i];
+            }
+            else if (mode == random)
+            {
+                for (int i = numSteps - 1; i > 0; --i)
+                    std::swap (steps[(size_t)i], steps[(size_t)nextRandom ((uint32_t)i + 1)]);
+            }
+
+            if (nextStep >= numSteps)
+                nextStep = 0;
+        }
+
+        /** xorshift32, reduced to 0 .. range - 1. */
+        int nextRandom (uint32_t range) noexcept
+        {
+            randomState ^= randomState << 13;
+            randomState ^= randomState >> 17;
+            randomState ^= randomState << 5;
+            return (int)(randomState % range);
+        }
+
+        std::array<bool, 128> held {};
+        std::array<float, 128> velocities {};
+        std::array<Step, (size_t)maxSteps> steps {};
+        int keysDown = 0;
+        int numSteps = 0;
+        int nextStep = 0;
+
+        int mode = up;
+        int octaves = 1;
+        bool latch = false;
+
+        double stepLength = 1.0;
+        double gateLength = 0.8;
+        double timer = 0.0;
+        int sounding = -1;
+        bool gateOpen = false;
+        uint32_t randomState = randomSeed;
+    };
+}
@@ -0,0 +1,134 @@
+#pragma once
+
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <atomic>
+#include <cstdint>
+
+namespace neon
+{
+    /**
+     * CpuGovernor
+     * Measures each block's render time against its deadline and, when the engine runs over
+     * its budget, steps through cheaper ways of rendering instead of letting the host drop
+     * out. Each level adds to the one before:
+     *
+     *     1  slowerControlRate     modulation / filter coefficients every 16 samples, not 8
+     *     2  releaseUnison         releasing voices play a single unison voice
+     *     3  stealQuietReleases    releasing voices below -48 dB are freed early
+     *     4  optionalStagesOff     filter saturation and modulation FX bypassed
+     *
+     * Levels go up quickly and come down slowly so the engine does not flap around the limit:
+     * a level is added after 4 consecutive blocks over budget and removed after 200 consecutive
+     * blocks under 60% of it. A single spike or a single light block changes nothing.
+     *
+     *     { CpuGovernor::ScopedMeasurement m (governor, numSamples); render(); }   // processBlock
+     *     if (governor.isDegraded (CpuGovernor::releaseUnison)) ...                // engine
+     *     CpuGovernor::describe (governor.getDegradations());                      // UI timer
+     */
+    class CpuGovernor
+    {
+    public:
+        enum Degradation : uint32_t
+        {
+            slowerControlRate  = 1 << 0,
+            releaseUnison      = 1 << 1,
+            stealQuietReleases = 1 << 2,
+            optionalStagesOff  = 1 << 3
+        };
+
+        static constexpr int maxLevel = 4;
+
+        void prepare (double sampleRate, int maximumBlockSize)
+        {
+            measurer.reset (sampleRate, maximumBlockSize);
+            level.store (0);
+            overBudgetBlocks = 0;
+            underBudgetBlocks = 0;
+        }
+
+        /** Share of the callback deadline the engine may use, 0.1 .. 1. */
+        void setBudget (float fractionOfDeadline) noexcept { budget.store (juce::jlimit (0.1f, 1.0f, fractionOfDeadline)); }
+        float getBudget() const noexcept { return budget.load(); }
+
+        /** Times one processBlock and re-evaluates the level when it ends. */
+        struct ScopedMeasurement
+        {
+            ScopedMeasurement (CpuGovernor& g, int numSamples)
+                : governor (g), timer (g.measurer, numSamples) {}
+
+            ~ScopedMeasurement() { governor.pendingUpdate = true; }
+
+            CpuGovernor& governor;
+            juce::AudioProcessLoadMeasurer::ScopedTimer timer;
+        };
+
+        /** Audio thread, once per block before rendering: folds in the last measurement. */
+        void update() noexcept
+        {
+            if (! pendingUpdate)
+                return;
+
+            pendingUpdate = false;
+
+            const float load = (float)measurer.getLoadAsProportion();
+            const float limit = budget.load();
+            int current = level.load();
+
+            // Each run of blocks restarts as soon as one block breaks it
+            overBudgetBlocks = load > limit ? overBudgetBlocks + 1 : 0;
+            underBudgetBlocks = load < limit * 0.6f ? underBudgetBlocks + 1 : 0;
+
+            if (overBudgetBlocks >= blocksToDegrade && current < maxLevel)
+            {
+                level.store (++current);
+                overBudgetBlocks = 0;
+            }
+            else if (underBudgetBlocks >= blocksToRecover && current > 0)
+            {
+                level.store (--current);
+                underBudgetBlocks = 0;
+            }
+
+            lastLoad.store (load);
+        }
+
+        bool isDegraded (Degradation d) const noexcept { return (getDegradations() & d) != 0; }
+
+        /** Samples between control-rate updates for an engine whose normal interval is baseInterval. */
+        int getControlInterval (int baseInterval) const noexcept
+        {
+            return isDegraded (slowerControlRate) ? baseInterval * 2 : baseInterval;
+        }
+
+        // -------- Any thread (UI) --------
+
+        int getLevel() const noexcept { return level.load(); }
+        float getLoad() const noexcept { return lastLoad.load(); }
+        uint32_t getDegradations() const noexcept { return (1u << level.load()) - 1u; }
+
+        static juce::String describe (uint32_t degradations)
+        {
+            if (degradations == 0)
+                return "FULL QUALITY";
+
+            juce::StringArray parts;
+            if (degradations & slowerControlRate)  parts.add ("CTRL RATE/2");
+            if (degradations & releaseUnison)      parts.add ("REL UNISON 1");
+            if (degradations & stealQuietReleases) parts.add ("REL STEAL");
+            if (degradations & optionalStagesOff)  parts.add ("FX/FILTER LITE");
+            return parts.joinIntoString (", ");
+        }
+
+    private:
+        static constexpr int blocksToDegrade = 4;   // consecutive blocks over budget
+        static constexpr int blocksToRecover = 200; // consecutive blocks under 60% of the budget
+
+        juce::AudioProcessLoadMeasurer measurer;
+        std::atomic<float> budget { 0.8f };
+        std::atomic<float> lastLoad { 0.0f };
+        std::atomic<int> level { 0 };
+        int overBudgetBlocks = 0;
+        int underBudgetBlocks = 0;
+        bool pendingUpdate = false;
+    };
+}
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+
+namespace neon
+{
+    /**
+     * fastmath
+     * Float approximations for the per-sample paths of the engines: pitch and cutoff
+     * conversions, sine oscillators, filter prewarping and saturation. Everything is
+     * straight-line arithmetic, min/max and bit casts, so a loop over an array of inputs
+     * vectorises (GCC wants -fno-trapping-math before it will if-convert the clamps).
+     *
+     *     float ratio = fastmath::semitonesToRatio (bend + detune / 100.0f);
+     *     float osc   = fastmath::sin2pi (phase);                // phase in cycles
+     *     float g     = fastmath::tan (juce::MathConstants<float>::pi * cutoff / sampleRate);
+     *     float y     = fastmath::softClip (x * drive);
+     *
+     * Measured against the double-precision libm result (float inputs, 1M points per range,
+     * "log" ranges spaced evenly in log2 x; neon-components/tools/FastMathAccuracy.cpp):
+     *
+     *     function      range                       max abs error    max rel error
+     *     exp2          [-24, 24]                   -                1.8e-7
+     *     exp           [-20, 20]                   -                1.1e-6
+     *     log2          [2^-20, 2^20] log           1.3e-6           -
+     *     sin2pi        [-8, 8] cycles              2.0e-7           -
+     *     sin2pi        [2^-24, 0.25] cycles log    -                1.8e-7
+     *     cos2pi        [-8, 8] cycles              3.0e-6           -
+     *     sin / cos     [-50, 50] rad               6.4e-6           -
+     *     tan           [0, 0.49 pi]                -                6.5e-6
+     *     tan           [2^-24, 0.49 pi] log        -                5.9e-6
+     *     tanh          [-10, 10]                   1.3e-7           -
+     *     softClip      [-10, 10]                   2.4e-2           -    (the engines' drive curve)
+     *
+     * sin and cos lose accuracy with the size of the argument only through the float
+     * rounding of x / 2pi; keep phases in cycles (sin2pi) where you can.
+     */
+    namespace fastmath
+    {
+        /** 2^x, clamped to the normal float range. */
+        inline float exp2 (float x) noexcept
+        {
+            x = std::min (std::max (x, -126.0f), 126.0f);
+
+            // Nearest integer by the 1.5 * 2^23 trick: read back as bits, so fast-math cannot fold it
+            const auto whole = std::bit_cast<int32_t> (x + 12582912.0f) - 0x4b400000;
+            const float f = x - (float)whole; // [-0.5, 0.5]
+
+            // Fit of 2^f - 1 on [-0.5, 0.5], weighted for relative error
+            const float p = 1.0f + f * (0.693146856f + f * (0.24022238f + f * (0.0555089295f
+                                      + f * (0.00967169794f + f * 0.00132186725f))));
+
+            return p * std::bit_cast<float> ((uint32_t)(whole + 127) << 23);
+        }
+
+        /** log2 (x) for positive, normal x. */
+        inline float log2 (float x) noexcept
+        {
+            const auto bits = std::bit_cast<uint32_t> (x);
+            const float exponent = (float)((int32_t)((bits >> 23) & 0xff) - 127);
+            const float m = std::bit_cast<float> ((bits & 0x007fffffu) | 0x3f800000u) - 1.0f; // mantissa - 1, [0, 1)
+
+            const float p = m * (1.44266405f + m * (-0.720515553f + m * (0.473113591f + m * (-0.324617109f
+                                  + m * (0.19238614f + m * (-0.0781590071f + m * 0.0151281463f))))));
+            return exponent + p;
+        }
+
+        inline float exp (float x) noexcept { return exp2 (x * 1.44269504f); }
+
+        inline float semitonesToRatio (float semitones) noexcept { return exp2 (semitones * (1.0f / 12.0f)); }
+        inline float centsToRatio (float cents) noexcept { return exp2 (cents * (1.0f / 1200.0f)); }
+
+        /** sin (2 pi * phase) for a phase in cycles; any value with |phase| < 2^22. */
+        inline float sin2pi (float phase) noexcept
+        {
+            // Nearest whole cycle away, then fold onto the first quarter: u in [0, 0.25].
+            // Both branches are exact, so small phases keep their relative precision.
+            const float r = phase - (float)(int32_t)(phase + std::copysign (0.5f, phase));
+            const float u = std::min (std::abs (r), 0.5f - std::abs (r));
+
+            const float u2 = u * u;
+            const float s = u * (6.28318529f + u2 * (-41.3416823f + u2 * (81.6025335f
+                                   + u2 * (-76.5816945f + u2 * 39.7596297f))));
+            return std::copysign (s, r);
+        }
+
+        inline float cos2pi (float phase) noexcept { return sin2pi (phase + 0.25f); }
+
+        inline float sin (float x) noexcept { return sin2pi (x * 0.159154943f); }
+        inline float cos (float x) noexcept { return cos2pi (x * 0.159154943f); }
+
+        /** tan (x) for |x| < pi / 2, e.g. the prewarped gain of a TPT filter. */
+        inline float tan (float x) noexcept
+        {
+            const float phase = x * 0.159154943f;
+            return sin2pi (phase) / cos2pi (phase);
+        }
+
+        /** tanh (x), accurate to float rounding; use softClip where the curve only has to sound right. */
+        inline float tanh (float x) noexcept
+        {
+            x = std::min (std::max (x, -9.0f), 9.0f);
+            const float e = exp2 (x * 2.88539008f); // e^(2x)
+            return (e - 1.0f) / (e + 1.0f);
+        }
+
+        /** Cheap 3/2 Pade of tanh that reaches +-1 at +-3. The saturation curve of all the engines. */
+        inline float softClip (float x) noexcept
+        {
+            x = std::min (std::max (x, -3.0f), 3.0f);
+            const float x2 = x * x;
+            return x * (27.0f + x2) / (27.0f + 9.0f * x2);
+        }
+    }
+}
@@ -0,0 +1,219 @@
+#pragma once
+
+#include <juce_audio_basics/juce_audio_basics.h>
+#include "NeonFastMath.h"
+#include <array>
+
+namespace neon
+{
+    /**
+     * LadderFilter
+     * Four-pole zero-delay-feedback ladder: four TPT one-poles with the resonance loop solved
+     * per sample instead of delayed by one, so it stays in tune and stable up to
+     * self-oscillation. It runs NumLanes channels side by side (a stereo voice is two lanes,
+     * voices that share a setting can be more) through the same straight-line loop, which
+     * the compiler keeps in one vector register.
+     *
+     * With saturation on, the feedback sum goes through softClip: the resonance compresses
+     * and growls like a transistor ladder instead of running away. LP/HP/BP at 12 or 24 dB
+     * are mixed from the stage outputs, always with the feedback taken from the last stage.
+     *
+     *     LadderFilter<2> filter;
+     *     filter.prepare (sampleRate);
+     *     filter.setMode (LadderFilter<2>::lowpass, true);        // on parameter change
+     *     filter.setDrive (gain, gain > 1.1f);
+     *     filter.setCutoff (hz);                                  // control rate
+     *     filter.setResonance (res);
+     *
+     *     float frame[] = { left, right };
+     *     filter.process (frame);                                 // per sample, in place
+     */
+    template <int NumLanes>
+    class LadderFilter
+    {
+    public:
+        enum Mode { lowpass, highpass, bandpass };
+
+        // Loop gain at full resonance. 4 is the edge of self-oscillation, so only the
+        // saturating ladder may go past it; the linear one stops just short.
+        static constexpr float maxFeedback = 4.2f;
+        static constexpr float maxLinearFeedback = 3.9f;
+
+        void prepare (double newSampleRate) noexcept
+        {
+            sampleRate = (float)newSampleRate;
+            reset();
+            setCutoff (cutoffHz);
+        }
+
+        void reset() noexcept
+        {
+            for (auto& s : state)
+                s.fill (0.0f);
+        }
+
+        /** Output taps; lowpass is gain-compensated so resonance does not thin out the level. */
+        void setMode (int mode, bool is24dB) noexcept
+        {
+            switch (mode)
+            {
+                case highpass: mix = is24dB ? Taps { 1.0f, -4.0f, 6.0f, -4.0f, 1.0f } : Taps { 1.0f, -2.0f, 1.0f, 0.0f, 0.0f }; break;
+                case bandpass: mix = is24dB ? Taps { 0.0f, 0.0f, 4.0f, -8.0f, 4.0f } : Taps { 0.0f, 2.0f, -2.0f, 0.0f, 0.0f }; break;
+                default:       mix = is24dB ? Taps { 0.0f, 0.0f, 0.0f, 0.0f, 1.0f }  : Taps { 0.0f, 0.0f, 1.0f, 0.0f, 0.0f };  break;
+            }
+
+            compensation = mode == highpass || mode == bandpass ? 0.0f : 1.0f;
+            for (int l = 0; l < NumLanes; ++l)
+                updateLane (l);
+        }
+
+        /** Input gain; saturate switches the soft clipper in the feedback path. */
+        void setDrive (float gain, bool saturate) noexcept
+        {
+            drive = gain;
+            if (saturate != saturating)
+            {
+                saturating = saturate;
+                for (int l = 0; l < NumLanes; ++l)
+                    updateLane (l);
+            }
+        }
+
+        void setCutoff (float hz) noexcept
+        {
+            cutoffHz = hz;
+            const float G = getStageGain (hz);
+            for (int l = 0; l < NumLanes; ++l)
+            {
+                lanes.G[(size_t)l] = G;
+                updateLane (l);
+            }
+        }
+
+        void setCutoff (int lane, float hz) noexcept
+        {
+            lanes.G[(size_t)lane] = getStageGain (hz);
+            updateLane (lane);
+        }
+
+        /** 0 .. 1, self-oscillating near the top with saturation on. */
+        void setResonance (float amount) noexcept
+        {
+            for (int l = 0; l < NumLanes; ++l)
+            {
+                resonance[(size_t)l] = amount;
+                updateLane (l);
+            }
+        }
+
+        void setResonance (int lane, float amount) noexcept
+        {
+            resonance[(size_t)lane] = amount;
+            updateLane (lane);
+        }
+
+        /** One sample per lane, in place. */
+        void process (float* frame) noexcept
+        {
+            if (saturating)
+                process<true> (frame);
+            else
+                process<false> (frame);
+        }
+
+        /** As process(), with the saturation that setDrive() chose known at compile time. */
+        template <bool Saturating>
+        void process (float* frame) noexcept
+        {
+            jassert (Saturating == saturating);
+
+            auto& s0 = state[0];
+            auto& s1 = state[1];
+            auto& s2 = state[2];
+            auto& s3 = state[3];
+
+            for (int i = 0; i < NumLanes; ++i)
+            {
+                const auto l = (size_t)i;
+                const float G = lanes.G[l];
+                const float x = frame[i] * drive;
+
+                // Solve the loop: y4 = G^4 * u + (what the states contribute), u = a * x - k * y4
+                const float stateSum = lanes.c0[l] * s0[l] + lanes.c1[l] * s1[l] + lanes.c2[l] * s2[l] + lanes.c3[l] * s3[l];
+                const float y4Estimate = (lanes.inputGain[l] * x + stateSum) * lanes.invDenominator[l];
+
+                float u = lanes.compensatedInput[l] * x - lanes.k[l] * y4Estimate;
+                if constexpr (Saturating)
+                    u = fastmath::softClip (u);
+
+                float v = (u - s0[l]) * G;
+                const float y1 = v + s0[l];
+                s0[l] = y1 + v;
+
+                v = (y1 - s1[l]) * G;
+                const float y2 = v + s1[l];
+                s1[l] = y2 + v;
+
+                v = (y2 - s2[l]) * G;
+                const float y3 = v + s2[l];
+                s2[l] = y3 + v;
+
+                v = (y3 - s3[l]) * G;
+                const float y4 = v + s3[l];
+                s3[l] = y4 + v;
+
+                frame[i] = mix[0] * u + mix[1] * y1 + mix[2] * y2 + mix[3] * y3 + mix[4] * y4;
+            }
+        }
+
+    private:
+        using LaneArray = std::array<float, (size_t)NumLanes>;
+        using Taps = std::array<float, 5>;
+
+        float getStageGain (float hz) const noexcept
+        {
+            const float limited = juce::jlimit (20.0f, sampleRate * 0.45f, hz);
+            const float g = fastmath::tan (juce::MathConstants<float>::pi * limited / sampleRate);
+            return g / (1.0f + g);
+        }
+
+        void updateLane (int lane) noexcept
+        {
+            const auto l = (size_t)lane;
+            const float G = lanes.G[l];
+            const float k = juce::jlimit (0.0f, 1.0f, resonance[l]) * (saturating ? maxFeedback : maxLinearFeedback);
+            const float G2 = G * G;
+            const float G4 = G2 * G2;
+            const float a = 1.0f + compensation * k;
+
+            // A TPT one-pole outputs G * in + (1 - G) * state; chained four times
+            const float beta = 1.0f - G;
+            lanes.c0[l] = beta * G2 * G;
+            lanes.c1[l] = beta * G2;
+            lanes.c2[l] = beta * G;
+            lanes.c3[l] = beta;
+
+            lanes.k[l] = k;
+            lanes.compensatedInput[l] = a;
+            lanes.inputGain[l] = G4 * a;
+            lanes.invDenominator[l] = 1.0f / (1.0f + k * G4);
+        }
+
+        // Per-lane coefficients, laid out as arrays so process() reads them as vectors
+        struct Lanes
+        {
+            LaneArray G {}, k {}, c0 {}, c1 {}, c2 {}, c3 {};
+            LaneArray compensatedInput {}, inputGain {}, invDenominator {};
+        };
+
+        Lanes lanes;
+        LaneArray resonance {};
+        std::array<LaneArray, 4> state {};
+        Taps mix { 0.0f, 0.0f, 0.0f, 0.0f, 1.0f };
+        float compensation = 1.0f;
+        float drive = 1.0f;
+        bool saturating = false;
+        float sampleRate = 44100.0f;
+        float cutoffHz = 20000.0f;
+    };
+}
@@ -0,0 +1,157 @@
+#pragma once
+
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <cmath>
+#include <cstdint>
+
+namespace neon
+{
+    /**
+     * Lfo
+     * Per-voice LFO clocked only by the samples it renders. Delay and fade are counted in
+     * samples from note-on and S&H draws from the voice's own xorshift generator, so the
+     * audio thread never reads the system clock or a shared RNG and offline bounces match
+     * realtime playback exactly.
+     *
+     *     Lfo::Settings s;                                   // once per block
+     *     s.phaseIncrement = Lfo::getRateHz (sync, hz, noteIdx, bpm) / sampleRate;
+     *
+     *     voice.lfo.noteOn (s.phaseStart, keySync);          // note-on
+     *     float v = voice.lfo.advance (s, 8);                 // control rate: value, then step 8 samples
+     *     voice.lfo.renderBlock (s, dest, numSamples);        // or one value per sample
+     */
+    class Lfo
+    {
+    public:
+        enum Shape { triangle, rampUp, rampDown, square, sampleHold, sine };
+
+        struct Settings
+        {
+            int shape = triangle;
+            double phaseIncrement = 0.0; // cycles per sample
+            float phaseStart = 0.0f;
+            int delaySamples = 0;        // silent after note-on
+            int fadeSamples = 0;         // then ramps in over this long
+        };
+
+        /** Cycles per second for a free rate, or for a tempo-synced division (1/64 .. 4/1). */
+        static double getRateHz (bool syncMode, float rateHz, int rateNoteIdx, double bpm) noexcept
+        {
+            if (! syncMode)
+                return rateHz;
+
+            // One cycle lasts 'div' beats
+            static constexpr double divs[] = { 0.0625, 0.125, 0.25, 0.5, 1.0, 2.0, 4.0, 8.0, 16.0 };
+            return (bpm / 60.0) / divs[juce::jlimit (0, 8, rateNoteIdx)];
+        }
+
+        static int msToSamples (float ms, double sampleRate) noexcept
+        {
+            return ms > 0.01f ? (int)std::lround (ms * 0.001 * sampleRate) : 0;
+        }
+
+        /** Give each voice its own sequence; 0 is not a valid xorshift state. */
+        void setSeed (uint32_t seed) noexcept { rng = seed != 0 ? seed : 0x9e3779b9u; }
+
+        /** Restarts delay and fade; with key sync the phase jumps to startPhase too. */
+        void noteOn (float startPhase, bool keySync) noexcept
+        {
+            if (keySync)
+            {
+                phase = startPhase;
+                holdValid = false;
+            }
+
+            elapsed = 0;
+            lastOutput = 0.0f;
+        }
+
+        void reset() noexcept
+        {
+            phase = 0.0;
+            elapsed = 0;
+            holdValid = false;
+            lastOutput = 0.0f;
+        }
+
+        /** Value at the current position, then steps the LFO numSamples ahead. */
+        float advance (const Settings& s, int numSamples) noexcept
+        {
+            lastOutput = shapeAtPhase (s) * getGain (s);
+            step (s, numSamples);
+            return lastOutput;
+        }
+
+        /** One value per sample. */
+        void renderBlock (const Settings& s, float* dest, int numSamples) noexcept
+        {
+            for (int i = 0; i < numSamples; ++i)
+                dest[i] = advance (s, 1);
+        }
+
+        float getLastOutput() const noexcept { return lastOutput; }
+
+    private:
+        float getGain (const Settings& s) const noexcept
+        {
+            if (elapsed < s.delaySamples)
+                return 0.0f;
+
+            const int64_t fadePos = elapsed - s.delaySamples;
+            if (fadePos >= s.fadeSamples)
+                return 1.0f;
+
+            return (float)fadePos / (float)s.fadeSamples;
+        }
+
+        float shapeAtPhase (const Settings& s) noexcept
+        {
+            const float p = (float)phase;
+
+            switch (s.shape)
+            {
+                case triangle: return p < 0.5f ? p * 4.0f - 1.0f : 3.0f - p * 4.0f;
+                case rampUp:   return p * 2.0f - 1.0f;
+                case rampDown: return 1.0f - p * 2.0f;
+                case square:   return p < 0.5f ? 1.0f : -1.0f;
+                case sampleHold:
+                    if (! holdValid)
+                    {
+                        held = nextRandom();
+                        holdValid = true;
+                    }
+                    return held;
+                default:
+                    return std::sin (p * juce::MathConstants<float>::twoPi);
+            }
+        }
+
+        void step (const Settings& s, int numSamples) noexcept
+        {
+            elapsed += numSamples;
+
+            phase += s.phaseIncrement * numSamples;
+            if (phase >= 1.0)
+            {
+                phase -= std::floor (phase);
+                holdValid = false; // S&H takes a new value every cycle
+            }
+        }
+
+        /** xorshift32, scaled to [-1, 1). */
+        float nextRandom() noexcept
+        {
+            rng ^= rng << 13;
+            rng ^= rng >> 17;
+            rng ^= rng << 5;
+            return (float)(int32_t)rng * (1.0f / 2147483648.0f);
+        }
+
+        double phase = 0.0;
+        int64_t elapsed = 0;
+        float held = 0.0f;
+        float lastOutput = 0.0f;
+        bool holdValid = false;
+        uint32_t rng = 0x9e3779b9u;
+    };
+}
@@ -0,0 +1,43 @@
+#pragma once
+
+#include <juce_audio_basics/juce_audio_basics.h>
+
+namespace neon
+{
+    /**
+     * renderSplitAtMidi
+     * Renders one host block in stretches between its MIDI events, so a note starts on
+     * its own sample rather than at the top of the block and timing no longer depends
+     * on the buffer size.
+     *
+     *     engine.beginBlock (numSamples);
+     *     renderSplitAtMidi (midi, numSamples,
+     *                        [&] (int start, int num) { engine.renderRange (block, start, num); },
+     *                        [&] (const juce::MidiMessage& m) { handleMidiMessage (m); });
+     *
+     * Dense MIDI (controller sweeps) would otherwise chop the block into tiny pieces:
+     * after maxSubBlocks splits the remaining events are applied where rendering stopped.
+     */
+    template <typename RenderFn, typename EventFn>
+    void renderSplitAtMidi (const juce::MidiBuffer& midi, int numSamples, RenderFn&& render, EventFn&& handle, int maxSubBlocks = 64)
+    {
+        int pos = 0;
+        int numSplits = 0;
+
+        for (const auto metadata : midi)
+        {
+            const int eventPos = juce::jlimit (0, numSamples, metadata.samplePosition);
+            if (eventPos > pos && numSplits < maxSubBlocks)
+            {
+                render (pos, eventPos - pos);
+                pos = eventPos;
+                ++numSplits;
+            }
+
+            handle (metadata.getMessage());
+        }
+
+        if (pos < numSamples)
+            render (pos, numSamples - pos);
+    }
+}
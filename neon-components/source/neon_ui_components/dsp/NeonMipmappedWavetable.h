@@ -0,0 +1,149 @@
+#pragma once
+
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <juce_dsp/juce_dsp.h>
+#include "NeonFastMath.h"
+#include <cmath>
+#include <vector>
+
+namespace neon
+{
+    /**
+     * MipmappedWavetable
+     * A single-cycle waveform resampled to 2048 points and band-limited per octave at
+     * load time (FFT, drop the harmonics, inverse FFT). Level k keeps the harmonics up
+     * to 1024 >> k, so the top level is a pure sine.
+     *
+     * select() picks the first level that cannot alias at the given phase increment and
+     * crossfades towards the next one, so sweeping the pitch never steps audibly:
+     *
+     *     auto levels = table.select (phaseInc);
+     *     float s = levels.read (phase);
+     */
+    class MipmappedWavetable
+    {
+    public:
+        static constexpr int tableOrder = 11;
+        static constexpr int tableSize = 1 << tableOrder;
+        static constexpr int numLevels = tableOrder;
+
+        MipmappedWavetable (const float* source, int sourceLength)
+            : levels ((size_t)(numLevels * stride), 0.0f)
+        {
+            if (source == nullptr || sourceLength <= 0)
+                return;
+
+            // Resample to the FFT size (linear; source cycles are usually 2048 already)
+            std::vector<float> spectrum ((size_t)tableSize * 2, 0.0f);
+            for (int i = 0; i < tableSize; ++i)
+            {
+                double pos = (double)i * sourceLength / tableSize;
+                int i1 = (int)pos;
+                float frac = (float)(pos - i1);
+                spectrum[(size_t)i] = source[i1 % sourceLength] * (1.0f - frac) + source[(i1 + 1) % sourceLength] * frac;
+            }
+
+            juce::dsp::FFT fft (tableOrder);
+            fft.performRealOnlyForwardTransform (spectrum.data(), true);
+
+            std::vector<float> work (spectrum.size());
+            for (int level = 0; level < numLevels; ++level)
+            {
+                const int maxHarmonic = (tableSize / 2) >> level;
+
+                // Keep bins 0..maxHarmonic (interleaved re/im), zero everything above
+                std::fill (work.begin(), work.end(), 0.0f);
+                std::copy (spectrum.begin(), spectrum.begin() + (maxHarmonic + 1) * 2, work.begin());
+                fft.performRealOnlyInverseTransform (work.data());
+
+                auto* dest = levels.data() + (size_t)(level * stride);
+                std::copy (work.begin(), work.begin() + tableSize, dest);
+                dest[tableSize] = dest[0]; // guard sample: interpolation never wraps
+            }
+        }
+
+        struct Selection
+        {
+            const float* lower = nullptr;
+            const float* upper = nullptr;
+            float mix = 0.0f;
+
+            /** Linear-interpolated read at phase [0, 1), crossfaded between the two levels. */
+            float read (double phase) const noexcept
+            {
+                double pos = phase * tableSize;
+                int idx = juce::jlimit (0, tableSize - 1, (int)pos);
+                float frac = (float)(pos - idx);
+
+                float a = lower[idx] + (lower[idx + 1] - lower[idx]) * frac;
+                if (mix <= 0.0f)
+                    return a;
+
+                float b = upper[idx] + (upper[idx + 1] - upper[idx]) * frac;
+                return a + (b - a) * mix;
+            }
+
+            /** Reads n table positions (0 .. tableSize) at once, for UnisonKernel. */
+            void readLanes (const float* pos, float* out, int n) const noexcept
+            {
+                for (int i = 0; i < n; ++i)
+                {
+                    const int idx = juce::jlimit (0, tableSize - 1, (int)pos[i]);
+                    const float frac = pos[i] - (float)idx;
+                    out[i] = lower[idx] + (lower[idx + 1] - lower[idx]) * frac;
+                }
+
+                if (mix > 0.0f)
+                {
+                    for (int i = 0; i < n; ++i)
+                    {
+                        const int idx = juce::jlimit (0, tableSize - 1, (int)pos[i]);
+                        const float frac = pos[i] - (float)idx;
+                        const float b = upper[idx] + (upper[idx + 1] - upper[idx]) * frac;
+                        out[i] += (b - out[i]) * mix;
+                    }
+                }
+            }
+        };
+
+        /** Levels for a phase increment in cycles per sample. */
+        Selection select (double phaseIncrement) const noexcept
+        {
+            float mix = 0.0f;
+            const int level = chooseLevel (phaseIncrement, mix);
+
+            Selection s;
+            s.lower = getLevel (level);
+            s.upper = getLevel (juce::jmin (level + 1, numLevels - 1));
+            s.mix = mix;
+            return s;
+        }
+
+        /** The level select() reads for a phase increment, and how far to fade towards the next one. */
+        static int chooseLevel (double phaseIncrement, float& mixToNext) noexcept
+        {
+            // Level k is alias-free while tableSize * inc <= 2^k; below 2^-1 it is level 0 anyway
+            const float x = fastmath::log2 (juce::jmax (0.5f, (float)(phaseIncrement * tableSize)));
+            int level = (int)x; // x >= -1, so truncating and stepping up is ceil
+            if ((float)level < x)
+                ++level;
+            float mix = x - (float)level + 1.0f;
+
+            if (level < 0)
+            {
+                level = 0;
+                mix = 0.0f;
+            }
+
+            mixToNext = juce::jlimit (0.0f, 1.0f, mix);
+            return juce::jmin (level, numLevels - 1);
+        }
+
+        const float* getLevel (int level) const noexcept { return levels.data() + (size_t)(level * stride); }
+
+    private:
+        static constexpr int stride = tableSize + 1;
+
+        std::vector<float> levels;
+    };
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <array>
+#include <cmath>
+
+namespace neon
+{
+    /**
+     * ModRouting
+     * A modulation matrix compiled down to the routes that actually do something.
+     * Engines rebuild it whenever a slot target or amount changes and the voice loop
+     * then runs one multiply-accumulate per live route, so an empty matrix costs
+     * nothing and a full one no longer pays for the target switch.
+     *
+     *     routing.clear();
+     *     routing.addRoute (srcLfo1, (int)ModTarget::FilterCutoff, amount);     // on param change
+     *
+     *     float sources[] = { modEnv, lfo1, lfo2 };
+     *     routing.apply (sources, voiceMods.data());                           // control rate
+     *
+     * A route may also read another destination as extra depth (the LFO "amount" targets):
+     * dest += source * (scale + dests[depthDest] * depthScale). Destination 0 is treated as
+     * "None" and must stay at zero, so routes without one point there.
+     */
+    template <int NumSources, int NumDestinations, int MaxRoutes>
+    class ModRouting
+    {
+    public:
+        void clear() noexcept { numRoutes = 0; }
+
+        /** Adds a route unless it is a no-op; applied in the order added. */
+        void addRoute (int source, int dest, float scale, int depthDest = 0, float depthScale = 0.0f) noexcept
+        {
+            jassert (juce::isPositiveAndBelow (source, NumSources));
+            jassert (juce::isPositiveAndBelow (depthDest, NumDestinations));
+
+            if (! juce::isPositiveAndBelow (dest, NumDestinations) || dest == 0 || numRoutes >= MaxRoutes)
+                return;
+
+            if (! std::isfinite (scale) || (scale == 0.0f && (depthDest == 0 || depthScale == 0.0f)))
+                return;
+
+            routes[(size_t)numRoutes++] = { source, dest, depthDest, scale, depthScale };
+        }
+
+        int getNumRoutes() const noexcept { return numRoutes; }
+
+        /** True if any live route writes to dest; engines use it to skip stages nothing can open. */
+        bool isRouted (int dest) const noexcept
+        {
+            for (int i = 0; i < numRoutes; ++i)
+                if (routes[(size_t)i].dest == dest)
+                    return true;
+
+            return false;
+        }
+
+        void apply (const float* sources, float* dests) const noexcept
+        {
+            for (int i = 0; i < numRoutes; ++i)
+            {
+                const auto& r = routes[(size_t)i];
+                dests[r.dest] += sources[r.source] * (r.scale + dests[r.depthDest] * r.depthScale);
+            }
+        }
+
+    private:
+        struct Route
+        {
+            int source, dest, depthDest;
+            float scale, depthScale;
+        };
+
+        std::array<Route, (size_t)MaxRoutes> routes {};
+        int numRoutes = 0;
+    };
+}
@@ -0,0 +1,1313 @@
+#pragma once
+
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <juce_dsp/juce_dsp.h>
+#include "../core/NeonInstance.h"
+#include "NeonArpeggiator.h"
+#include "NeonCpuGovernor.h"
+#include "NeonLadderFilter.h"
+#include "NeonLfo.h"
+#include "NeonModRouting.h"
+#include "NeonRenderPool.h"
+#include "NeonRenderQuality.h"
+#include "NeonSmoothingBank.h"
+#include "NeonVoiceEngine.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <vector>
+
+namespace neon
+{
+    /**
+     * PolySignalPath
+     * The engine of the subtractive poly synths (Neon Jr and Neon 777) minus their
+     * oscillators: voice allocation, mono and glide, the arpeggiator, envelopes, LFOs, the
+     * mod matrix, the ladder filter and amp (through VoiceEngine), parameter smoothing, the
+     * FX chain, the render pool, the CPU governor and the quality tiers. A synth derives
+     * from it, names itself and its oscillator section, and supplies only what differs:
+     *
+     *     struct WavetableSection
+     *     {
+     *         using Target = ModTarget;            // the synth's modulation targets
+     *         static constexpr int numSmoothed;    // oscillator values that glide (volume, pan, ...)
+     *         struct VoiceState { void reset(); }; // per-voice oscillator state, Voice::osc
+     *     };
+     *
+     *     class SignalPath : public PolySignalPath<SignalPath, WavetableSection>
+     *     {
+     *         void bindOscillators();                        // handles and watches, from the constructor
+     *         void updateOscillators();                      // polls them, sets smoothing targets
+     *         void applySmoothedOscillators();               // reads smoothers from numSharedSmoothed on
+     *         void startOscillators (VoiceState&, float hz); // note on: frequency, key-synced phases
+     *         Oscillators getOscillators() const;            // the VoiceEngine policy, per control span: copy what glides
+     *         static float getModUnitScale (ModTarget);      // route units: 12 for pitch, 100 for detune
+     *         void beginOscillatorBlock();                   // optional, once per host block
+     *     };
+     *
+     * The derived constructor calls bindParameters() once its own members exist.
+     * The target enum needs None, Count, SubLevel, SubPitch, FilterCutoff, FilterRes and
+     * Lfo1Amount1 .. Lfo2Amount4 in order; the Osc targets are the synth's business.
+     */
+    template <typename Synth, typename Section>
+    class PolySignalPath : public juce::AudioSource
+    {
+    public:
+        using Target = typename Section::Target;
+        using VoiceState = typename Section::VoiceState;
+
+        explicit PolySignalPath (NeonInstance& instance)
+            : registry (instance.getParameterRegistry())
+        {
+            renderPool = RenderPool::getShared();
+        }
+
+        void prepareToPlay (int samplesPerBlockExpected, double sr) override
+        {
+            sampleRate = sr;
+            voiceBuffers.setSize (numVoices * 2, samplesPerBlockExpected);
+            governor.prepare (sr, samplesPerBlockExpected);
+
+            juce::dsp::ProcessSpec spec;
+            spec.sampleRate = sr;
+            spec.maximumBlockSize = (juce::uint32)samplesPerBlockExpected;
+            spec.numChannels = 2;
+
+            chorus.prepare (spec);
+            phaser.prepare (spec);
+            reverb.prepare (spec);
+            delay.prepare (spec);
+
+            uint32_t lfoSeed = 1;
+            for (auto& v : voices)
+            {
+                v.filter.prepare (sr);
+                v.ampEnv.setSampleRate (sr);
+                v.filterEnv.setSampleRate (sr);
+                v.pitchEnv.setSampleRate (sr);
+                v.modEnv.setSampleRate (sr);
+
+                for (auto& l : v.lfos)
+                    l.setSeed (lfoSeed++ * 0x9e3779b9u);
+            }
+
+            // Delay length and filter coefficients depend on the sample rate
+            watches.invalidate();
+            smoothers.prepare (sr);
+        }
+
+        void getNextAudioBlock (const juce::AudioSourceChannelInfo& bufferToFill) override
+        {
+            beginBlock (bufferToFill.numSamples);
+            renderRange (bufferToFill, 0, bufferToFill.numSamples);
+        }
+
+        void releaseResources() override {}
+
+        // Sample-accurate MIDI: beginBlock() once per host block, then renderRange() for each
+        // stretch between events. start is the offset inside the block.
+        void beginBlock (int numSamples)
+        {
+            registry.beginAudioBlock (numSamples, sampleRate);
+            governor.update();
+            synth().beginOscillatorBlock();
+        }
+
+        void renderRange (const juce::AudioSourceChannelInfo& block, int start, int numSamples)
+        {
+            // Render in segments split at parameter events so UI changes land sample-accurately
+            const int end = start + numSamples;
+
+            for (int pos = start; pos < end;)
+            {
+                int next = juce::jmin (end, registry.applyParameterEvents (pos));
+                updateParams();
+
+                // Arp steps split the block like parameter events
+                next = handleArp (pos, next);
+
+                // Gliding values step inside renderBlock; only bound the segment by its span table
+                if (smoothers.isSmoothing())
+                    next = juce::jmin (next, pos + maxControlSpans * controlSpanSize);
+
+                renderBlock ({ block.buffer, block.startSample + pos, next - pos });
+                arp.advance (next - pos);
+                pos = next;
+            }
+        }
+
+        void noteOn (int midiNote, float velocity)
+        {
+            if (arpSettings.enabled)
+            {
+                // Keys only feed the pattern; the arp starts the voices on its own steps
+                arp.noteOn (midiNote, velocity);
+                if (arp.isRunning())
+                    return;
+            }
+
+            // Mono Mode: Kill other voices and track held notes
+            if (isMonoMode)
+            {
+                // Add to held notes list
+                monoHeldNotes.push_back (midiNote);
+
+                for (auto& v : voices)
+                {
+                    if (v.isActive)
+                    {
+                        v.startAmpRelease();
+                        v.filterEnv.noteOff();
+                        v.pitchEnv.noteOff();
+                        v.modEnv.noteOff();
+                    }
+                }
+            }
+
+            startVoice (midiNote, velocity);
+        }
+
+        void noteOff (int midiNote)
+        {
+            if (arpSettings.enabled)
+            {
+                arp.noteOff (midiNote);
+                if (arp.isRunning())
+                    return;
+            }
+
+            releaseVoices (midiNote);
+
+            // If Mono, remove from held notes and retrigger previous note if any remain
+            if (isMonoMode)
+            {
+                monoHeldNotes.erase (std::remove (monoHeldNotes.begin(), monoHeldNotes.end(), midiNote), monoHeldNotes.end());
+                if (!monoHeldNotes.empty())
+                {
+                    noteOn (monoHeldNotes.back(), 0.8f);
+                }
+            }
+        }
+
+        void setPolyAftertouch (int midiNote, float value)
+        {
+            for (auto& v : voices)
+            {
+                if (v.isActive && v.midiNote == midiNote)
+                    v.aftertouch = value;
+            }
+        }
+
+        void setChannelAftertouch (float value)
+        {
+            for (auto& v : voices)
+            {
+                if (v.isActive)
+                    v.aftertouch = value;
+            }
+        }
+
+        void setPitchWheel (float value) { pitchWheel = value; }
+        void setModWheel (float value) { modWheel = value; }
+        void setBpm (double newBpm) { bpm = newBpm; }
+
+        /** Set from processBlock with isNonRealtime(). Live, the Control "Quality" choice picks the tier; a bounce renders at OFFLINE. */
+        void setNonRealtime (bool isNonRealtime) { nonRealtime.store (isNonRealtime); }
+        RenderQuality::Tier getRenderQuality() const { return RenderQuality::resolve (chosenQuality.load(), nonRealtime.load()); }
+
+        float getPitchWheel() const { return pitchWheel; }
+        float getModWheel() const { return modWheel; }
+
+        CpuGovernor& getCpuGovernor() { return governor; }
+        const CpuGovernor& getCpuGovernor() const { return governor; }
+
+        int getActiveVoicesCount() const
+        {
+            int count = 0;
+            for (auto& v : voices) if (v.isActive.load()) count++;
+            return count;
+        }
+
+        struct LfoSettings
+        {
+            int shape = 0; // Tri, RampUp, RampDn, Sq, S&H
+            bool syncMode = false; // false=Hz, true=Note
+            float rateHz = 1.0f;
+            int rateNoteIdx = 4;
+            bool keySync = true;
+            float phaseStart = 0.0f;
+            float delayMs = 0.0f;
+            float fadeMs = 0.0f;
+
+            struct ModSlot { float target = 0.0f; float amount = 0.0f; };
+            ModSlot slots[4];
+        };
+
+        struct Voice
+        {
+            int midiNote = -1;
+            float velocity = 0.0f;
+            float aftertouch = 0.0f; // Poly aftertouch per voice
+            std::atomic<bool> isActive { false };
+            double noteOnTime = 0.0; // For voice stealing
+
+            // Portamento/glide state
+            float targetFrequency = 440.0f;
+            float currentGlideFreq = 440.0f;
+
+            VoiceState osc; // the synth's oscillator section
+            std::array<Lfo, 2> lfos;
+            juce::ADSR ampEnv, filterEnv, pitchEnv, modEnv;
+            LadderFilter<2> filter; // L/R lanes
+
+            // XORshift noise generator state (ultra-cheap CPU)
+            uint32_t noiseState = 0x12345678;
+
+            std::array<float, (size_t)Target::Count> mods {}; // Summed modulation per target, in target units
+            int decimationCounter = 0;
+            bool releasing = false; // amp envelope past note-off, a candidate for the governor
+
+            float mod (Target t) const noexcept { return mods[(size_t)t]; }
+
+            void startAmpRelease() { ampEnv.noteOff(); releasing = true; }
+
+            void reset()
+            {
+                osc.reset();
+                for (auto& l : lfos) l.reset();
+
+                ampEnv.reset();
+                releasing = false;
+                filterEnv.reset();
+                pitchEnv.reset();
+                modEnv.reset();
+                filter.reset();
+
+                mods.fill (0.0f);
+
+                noiseState = 0x12345678 + (uint32_t)(midiNote * 997);
+                isActive.store (false);
+                midiNote = -1;
+            }
+        };
+
+        struct ArpSettings
+        {
+            bool enabled = false;
+            int rateNoteIdx = 2;
+            int mode = 0;
+            int octaves = 1;
+            float gate = 0.8f;
+            bool latch = false;
+        };
+
+        struct FxSettings
+        {
+            int modType = 0; // 0=Off, 1=Chorus, 2=Phaser, 3=Flanger
+            float modRate = 1.0f;
+            float modDepth = 0.5f;
+            float modFeedback = 0.0f;
+            float modMix = 0.0f;
+
+            float dlyTime = 400.0f;
+            int dlyNoteIdx = 4; // note division index when synced
+            float dlyFeedback = 0.3f;
+            float dlyMix = 0.0f;
+            bool dlySync = false;
+
+            float rvbTime = 2.0f; // decay time, mapped to room size
+            float rvbSize = 0.5f;
+            float rvbDamp = 0.5f;
+            float rvbPredelay = 0.0f; // ms
+            float rvbMix = 0.0f;
+        };
+
+    protected:
+        // Continuous parameters glide through one bank: updateParams() sets targets and
+        // applySmoothedParams() copies the current values into the caches below (the FX mixes
+        // are kept per ControlSpan). The synth's own oscillator values follow from
+        // numSharedSmoothed on.
+        enum SharedSmoothedParam
+        {
+            smSubLevel, smNoiseVolume,
+            smFilterCutoff, // octaves above 20 Hz
+            smFilterRes, smFilterDrive, smAmpLevel,
+            smModMix, smDlyTime, smDlyFeedback, smDlyMix, smRvbMix,
+            numSharedSmoothed
+        };
+
+        static constexpr int numSmoothedParams = numSharedSmoothed + Section::numSmoothed;
+
+        // Mod Env, Control and LFO slots compiled to their live routes
+        enum ModSource { modSrcEnv, modSrcLfo1, modSrcLfo2, numModSources };
+        using Routing = ModRouting<numModSources, (int)Target::Count, 4 + 16 + 2 * 4>;
+
+        /** Resolves every registry handle; the derived constructor calls it once its own members exist. */
+        void bindParameters()
+        {
+            synth().bindOscillators();
+
+            auto bindLfo = [this] (LfoHandles& h, const juce::String& name) {
+                h.shape    = registry.getHandle (name, "Shape", 0.0f);
+                h.sync     = registry.getHandle (name, "Sync", 0.0f);
+                h.rateHz   = registry.getHandle (name, "Rate Hz", 1.0f);
+                h.rateNote = registry.getHandle (name, "Rate Note", 4.0f);
+                h.keySync  = registry.getHandle (name, "KeySync", 1.0f);
+                h.phase    = registry.getHandle (name, "Phase", 0.0f);
+                h.delay    = registry.getHandle (name, "Delay", 0.0f);
+                h.fade     = registry.getHandle (name, "Fade", 0.0f);
+
+                for (int i = 0; i < 4; ++i)
+                {
+                    h.slotTarget[i] = registry.getHandle (name, "Slot " + juce::String (i + 1) + " Target", 0.0f);
+                    h.slotAmount[i] = registry.getHandle (name, "Slot " + juce::String (i + 1) + " Amount", 0.0f);
+                }
+            };
+
+            auto bindEnv = [this] (EnvHandles& h, const juce::String& name) {
+                h.attack  = registry.getHandle (name, "Attack", 10.0f);
+                h.decay   = registry.getHandle (name, "Decay", 500.0f);
+                h.sustain = registry.getHandle (name, "Sustain", 0.7f);
+                h.release = registry.getHandle (name, "Release", 500.0f);
+            };
+
+            handles.subVolume   = registry.getHandle ("Sub Osc", "Volume", 0.0f);
+            handles.subOctave   = registry.getHandle ("Sub Osc", "Octave", 1.0f);
+            handles.noiseVolume = registry.getHandle ("Noise", "Volume", 0.0f);
+
+            bindLfo (handles.lfos[0], "LFO 1");
+            bindLfo (handles.lfos[1], "LFO 2");
+
+            handles.filterType       = registry.getHandle ("Ladder Filter", "Type", 0.0f);
+            handles.filterCutoff     = registry.getHandle ("Ladder Filter", "Cutoff", 20000.0f);
+            handles.filterRes        = registry.getHandle ("Ladder Filter", "Res", 0.0f);
+            handles.filterDrive      = registry.getHandle ("Ladder Filter", "Drive", 1.0f);
+            handles.filterKeyTrack   = registry.getHandle ("Ladder Filter", "KeyTrack", 0.5f);
+            handles.filterSlope      = registry.getHandle ("Ladder Filter", "Slope", 1.0f);
+            handles.filterVelocity   = registry.getHandle ("Ladder Filter", "Velocity", 0.0f);
+            handles.filterAftertouch = registry.getHandle ("Ladder Filter", "Aftertouch", 0.0f);
+
+            bindEnv (handles.ampEnv, "Amp Env");
+            bindEnv (handles.filterEnv, "Filter Env");
+            bindEnv (handles.pitchEnv, "Pitch Env");
+            bindEnv (handles.modEnv, "Mod Env");
+
+            handles.filterEnvAmount     = registry.getHandle ("Filter Env", "Amount", 0.0f);
+            handles.filterEnvTarget     = registry.getHandle ("Filter Env", "Target", 2.0f);
+            handles.filterEnvVelocity   = registry.getHandle ("Filter Env", "V.Amount", 0.0f);
+            handles.filterEnvAftertouch = registry.getHandle ("Filter Env", "AT.Amount", 0.0f);
+            handles.filterEnvVelAttack  = registry.getHandle ("Filter Env", "V.Attack", 0.0f);
+
+            handles.pitchEnvAmount     = registry.getHandle ("Pitch Env", "Amount", 0.0f);
+            handles.pitchEnvTarget     = registry.getHandle ("Pitch Env", "Target", 2.0f);
+            handles.pitchEnvVelocity   = registry.getHandle ("Pitch Env", "V.Amount", 0.0f);
+            handles.pitchEnvAftertouch = registry.getHandle ("Pitch Env", "AT.Amount", 0.0f);
+            handles.pitchEnvVelAttack  = registry.getHandle ("Pitch Env", "V.Attack", 0.0f);
+
+            for (int i = 0; i < 4; ++i)
+            {
+                handles.modSlotTarget[i] = registry.getHandle ("Mod Env", "Slot " + juce::String (i + 1) + " Target", 0.0f);
+                handles.modSlotAmount[i] = registry.getHandle ("Mod Env", "Slot " + juce::String (i + 1) + " Amount", 0.0f);
+            }
+
+            for (int i = 0; i < 16; ++i)
+            {
+                handles.ctrlSlotTarget[i] = registry.getHandle ("Mod", "Slot " + juce::String (i + 1) + " Target", 0.0f);
+                handles.ctrlSlotAmount[i] = registry.getHandle ("Mod", "Slot " + juce::String (i + 1) + " Amount", 0.0f);
+            }
+
+            handles.pbRange   = registry.getHandle ("Control", "PB Range", 2.0f);
+            handles.voiceMode = registry.getHandle ("Control", "Mode", 0.0f);
+            handles.tempo     = registry.getHandle ("Control", "Tempo", 120.0f);
+            handles.tempoSync = registry.getHandle ("Control", "Tempo Sync", 1.0f);
+            handles.portaOn   = registry.getHandle ("Control", "Porta On", 0.0f);
+            handles.portaTime = registry.getHandle ("Control", "Porta Time", 100.0f);
+            handles.cpuBudget = registry.getHandle ("Control", "CPU Budget", 80.0f);
+            handles.quality   = registry.getHandle ("Control", "Quality", (float)RenderQuality::realtime);
+            handles.portaMode = registry.getHandle ("Control", "Porta Mode", 0.0f);
+
+            handles.ampLevel      = registry.getHandle ("Amp Output", "Level", 0.8f);
+            handles.ampVelocity   = registry.getHandle ("Amp Output", "Velocity", 0.5f);
+            handles.ampAftertouch = registry.getHandle ("Amp Output", "Aftertouch", 0.0f);
+
+            handles.arpOn       = registry.getHandle ("Arp", "Arp On", 0.0f);
+            handles.arpRateNote = registry.getHandle ("Arp", "Rate Note", 2.0f);
+            handles.arpMode     = registry.getHandle ("Arp", "Mode", 0.0f);
+            handles.arpOctave   = registry.getHandle ("Arp", "Octave", 1.0f);
+            handles.arpGate     = registry.getHandle ("Arp", "Gate", 80.0f);
+            handles.arpLatch    = registry.getHandle ("Arp", "Latch", 0.0f);
+
+            handles.fxModType     = registry.getHandle ("FX", "Mod Type", 1.0f);
+            handles.fxModRate     = registry.getHandle ("FX", "Mod Rate", 1.0f);
+            handles.fxModDepth    = registry.getHandle ("FX", "Mod Depth", 0.5f);
+            handles.fxModFeedback = registry.getHandle ("FX", "Mod Feedback", 0.0f);
+            handles.fxModMix      = registry.getHandle ("FX", "Mod Mix", 0.0f);
+            handles.fxDlyTime     = registry.getHandle ("FX", "Dly Time", 400.0f);
+            handles.fxDlyNote     = registry.getHandle ("FX", "Dly Note", 4.0f);
+            handles.fxDlyFeedback = registry.getHandle ("FX", "Dly FB", 0.3f);
+            handles.fxDlyMix      = registry.getHandle ("FX", "Dly Mix", 0.0f);
+            handles.fxDlySync     = registry.getHandle ("FX", "Dly Sync", 0.0f);
+            handles.fxRvbTime     = registry.getHandle ("FX", "Rvb Time", 2.0f);
+            handles.fxRvbSize     = registry.getHandle ("FX", "Rvb Size", 0.5f);
+            handles.fxRvbDamp     = registry.getHandle ("FX", "Rvb Damp", 0.5f);
+            handles.fxRvbPredelay = registry.getHandle ("FX", "Rvb Predelay", 0.0f);
+            handles.fxRvbMix      = registry.getHandle ("FX", "Rvb Mix", 0.0f);
+
+            watches.subOsc    = registry.watchGroup ("Sub Osc");
+            watches.noise     = registry.watchGroup ("Noise");
+            watches.lfos[0]   = registry.watchGroup ("LFO 1");
+            watches.lfos[1]   = registry.watchGroup ("LFO 2");
+            watches.filter    = registry.watchGroup ("Ladder Filter");
+            watches.ampEnv    = registry.watchGroup ("Amp Env");
+            watches.filterEnv = registry.watchGroup ("Filter Env");
+            watches.pitchEnv  = registry.watchGroup ("Pitch Env");
+            watches.modEnv    = registry.watchGroup ("Mod Env");
+            watches.mod       = registry.watchGroup ("Mod");
+            watches.control   = registry.watchGroup ("Control");
+            watches.ampOutput = registry.watchGroup ("Amp Output");
+            watches.arp       = registry.watchGroup ("Arp");
+            watches.fx        = registry.watchGroup ("FX");
+        }
+
+        /** Optional hook, once per host block before any rendering. */
+        void beginOscillatorBlock() {}
+
+        Synth& synth() noexcept { return static_cast<Synth&> (*this); }
+        const Synth& synth() const noexcept { return static_cast<const Synth&> (*this); }
+
+        ParameterRegistry& registry;
+        SmoothingBank<numSmoothedParams> smoothers;
+        Routing modRouting;
+
+        // Polyphony
+        static constexpr int numVoices = 16;
+        std::array<Voice, numVoices> voices;
+
+        double sampleRate = 44100.0;
+        double bpm = 120.0;
+
+        // Read by the oscillator sections
+        float globalSubOctave = -1.0f; // -2, -1, or -0.5 octaves
+        float pitchEnvAmount = 0.0f;
+        float pitchEnvVelocity = 0.0f;
+        float pitchEnvAftertouch = 0.0f;
+
+        uint32_t degradations = 0; // governor level, latched per block
+        int controlInterval = 8;   // samples between modulation updates, doubled by the governor
+        RenderQuality::Settings quality; // getRenderQuality(), latched per block
+
+    private:
+        // While anything glides, renderBlock steps the smoothers once per control span. A
+        // segment holds at most maxControlSpans of them, 512 samples: long enough that the
+        // voices still fill a parallel batch (RenderPool::minSamplesPerJob).
+        static constexpr int controlSpanSize = SmoothingBank<numSmoothedParams>::controlBlockSize;
+        static constexpr int maxControlSpans = 16;
+
+        struct ControlSpan
+        {
+            int start = 0;
+            int length = 0;
+            VoiceEngine::Block voice;
+
+            // FX mixes, applied when the FX reach the span
+            float modMix = 0.0f;
+            float dlyTime = 0.0f; // ms
+            float dlyFeedback = 0.0f;
+            float dlyMix = 0.0f;
+            float rvbMix = 0.0f;
+        };
+
+        void updateParams()
+        {
+            auto getVal = [this] (ParameterHandle h) { return registry.getValue (h); };
+
+            synth().updateOscillators();
+
+            // Sub Osc
+            if (registry.consumeChanges (watches.subOsc))
+            {
+                smoothers.setTarget (smSubLevel, getVal (handles.subVolume));
+                int octaveChoice = (int)getVal (handles.subOctave);
+                if (octaveChoice == 0) globalSubOctave = -2.0f;
+                else if (octaveChoice == 1) globalSubOctave = -1.0f;
+                else globalSubOctave = -0.5f;
+            }
+
+            // Noise
+            if (registry.consumeChanges (watches.noise))
+                smoothers.setTarget (smNoiseVolume, getVal (handles.noiseVolume));
+
+            // LFOs
+            auto updateGlobalLfo = [&](LfoSettings& settings, const LfoHandles& h) {
+                settings.shape = (int)std::round (getVal (h.shape));
+                settings.syncMode = getVal (h.sync) > 0.5f;
+                settings.rateHz = getVal (h.rateHz) * 5.0f; // Compensate for skew
+                settings.rateNoteIdx = (int)std::round (getVal (h.rateNote));
+                settings.keySync = getVal (h.keySync) > 0.5f;
+                settings.phaseStart = getVal (h.phase) / 360.0f;
+                settings.delayMs = getVal (h.delay);
+                settings.fadeMs = getVal (h.fade);
+
+                for (int i = 0; i < 4; ++i)
+                {
+                    settings.slots[i].target = getVal (h.slotTarget[i]);
+                    settings.slots[i].amount = getVal (h.slotAmount[i]);
+                }
+            };
+
+            bool routingChanged = false;
+            for (int i = 0; i < 2; ++i)
+            {
+                if (registry.consumeChanges (watches.lfos[i]))
+                {
+                    updateGlobalLfo (globalLfos[(size_t)i], handles.lfos[(size_t)i]);
+                    routingChanged = true;
+                }
+            }
+
+            // Filter
+            const bool filterChanged = registry.consumeChanges (watches.filter);
+            if (filterChanged)
+            {
+                filterType = (int)getVal (handles.filterType);
+                smoothers.setTarget (smFilterCutoff, std::log2 (juce::jmax (20.0f, getVal (handles.filterCutoff)) / 20.0f));
+                smoothers.setTarget (smFilterRes, getVal (handles.filterRes));
+                smoothers.setTarget (smFilterDrive, getVal (handles.filterDrive));
+                filterKeyTrack = getVal (handles.filterKeyTrack);
+                filterIs24dB = getVal (handles.filterSlope) > 0.5f;
+                filterVelocity = getVal (handles.filterVelocity);
+                filterAftertouch = getVal (handles.filterAftertouch);
+            }
+
+            // Env - Update ADSR from DAHDSR params
+            auto getEnvParams = [&] (const EnvHandles& h) {
+                float sustain = getVal (h.sustain);
+                // Fix: Ensure sustain is never exactly 0 to preserve release behavior
+                if (sustain < 0.001f) sustain = 0.001f;
+
+                return juce::ADSR::Parameters ({
+                    getVal (h.attack) / 1000.0f,
+                    getVal (h.decay) / 1000.0f,
+                    sustain,
+                    getVal (h.release) / 1000.0f
+                });
+            };
+
+            bool envChanged = false;
+
+            if (registry.consumeChanges (watches.ampEnv))
+            {
+                ampParams = getEnvParams (handles.ampEnv);
+                envChanged = true;
+            }
+
+            if (registry.consumeChanges (watches.filterEnv))
+            {
+                filterParams = getEnvParams (handles.filterEnv);
+                filterEnvAmount = getVal (handles.filterEnvAmount);
+                filterEnvTarget = (int)getVal (handles.filterEnvTarget);
+                filterEnvVelocity = getVal (handles.filterEnvVelocity);
+                filterEnvAftertouch = getVal (handles.filterEnvAftertouch);
+                filterEnvVelAttack = getVal (handles.filterEnvVelAttack);
+                envChanged = true;
+            }
+
+            if (registry.consumeChanges (watches.pitchEnv))
+            {
+                pitchParams = getEnvParams (handles.pitchEnv);
+                pitchEnvAmount = getVal (handles.pitchEnvAmount);
+                pitchEnvTarget = (int)getVal (handles.pitchEnvTarget);
+                pitchEnvVelocity = getVal (handles.pitchEnvVelocity);
+                pitchEnvAftertouch = getVal (handles.pitchEnvAftertouch);
+                pitchEnvVelAttack = getVal (handles.pitchEnvVelAttack);
+                envChanged = true;
+            }
+
+            if (registry.consumeChanges (watches.modEnv))
+            {
+                modParams = getEnvParams (handles.modEnv);
+                for (int i = 0; i < 4; ++i)
+                {
+                    modSlots[i].target = getVal (handles.modSlotTarget[i]);
+                    modSlots[i].amount = getVal (handles.modSlotAmount[i]);
+                }
+                envChanged = true;
+                routingChanged = true;
+            }
+
+            if (registry.consumeChanges (watches.mod))
+            {
+                // Mod Env is the implicit source of every Control slot
+                for (int i = 0; i < 16; ++i)
+                {
+                    ctrlSlots[(size_t)i].target = getVal (handles.ctrlSlotTarget[i]);
+                    ctrlSlots[(size_t)i].amount = getVal (handles.ctrlSlotAmount[i]);
+                }
+                routingChanged = true;
+            }
+
+            if (routingChanged)
+                rebuildModRouting();
+
+            if (registry.consumeChanges (watches.control))
+            {
+                pbRange = getVal (handles.pbRange);
+                isMonoMode = (int)getVal (handles.voiceMode) == 1;
+
+                internalBpm = getVal (handles.tempo);
+                useHostBpm = getVal (handles.tempoSync) > 0.5f;
+
+                portaOn = getVal (handles.portaOn) > 0.5f;
+                portaTime = getVal (handles.portaTime);
+                portaMode = getVal (handles.portaMode) > 0.5f;
+
+                governor.setBudget (getVal (handles.cpuBudget) / 100.0f);
+                chosenQuality.store ((int)getVal (handles.quality));
+            }
+
+            // The host may have pushed its tempo since the last block, so this runs unconditionally
+            if (!useHostBpm)
+                bpm = internalBpm;
+
+            if (registry.consumeChanges (watches.ampOutput))
+            {
+                smoothers.setTarget (smAmpLevel, getVal (handles.ampLevel));
+                ampVelocity = getVal (handles.ampVelocity);
+                ampAftertouch = getVal (handles.ampAftertouch);
+            }
+
+            // Arp
+            if (registry.consumeChanges (watches.arp))
+            {
+                bool wasArpEnabled = arpSettings.enabled;
+                arpSettings.enabled = getVal (handles.arpOn) > 0.5f;
+
+                // Turn off the arp-triggered note and forget the pattern
+                if (wasArpEnabled && !arpSettings.enabled)
+                    arp.stop ([this] (int note) { releaseVoices (note); });
+
+                arpSettings.rateNoteIdx = (int)getVal (handles.arpRateNote);
+                arpSettings.mode = (int)getVal (handles.arpMode);
+                arpSettings.octaves = (int)getVal (handles.arpOctave);
+                arpSettings.gate = getVal (handles.arpGate) / 100.0f;
+                arpSettings.latch = getVal (handles.arpLatch) > 0.5f;
+
+                arp.setMode (arpSettings.mode);
+                arp.setOctaves (arpSettings.octaves);
+                arp.setLatch (arpSettings.latch);
+            }
+
+            // FX (synced delay also depends on tempo)
+            const bool fxChanged = registry.consumeChanges (watches.fx);
+            if (fxChanged)
+            {
+                fxSettings.modType = (int)getVal (handles.fxModType);
+                fxSettings.modRate = getVal (handles.fxModRate);
+                fxSettings.modDepth = getVal (handles.fxModDepth);
+                fxSettings.modFeedback = getVal (handles.fxModFeedback);
+                fxSettings.modMix = getVal (handles.fxModMix);
+
+                fxSettings.dlyTime = getVal (handles.fxDlyTime);
+                fxSettings.dlyNoteIdx = (int)std::round (getVal (handles.fxDlyNote));
+                fxSettings.dlyFeedback = getVal (handles.fxDlyFeedback);
+                fxSettings.dlyMix = getVal (handles.fxDlyMix);
+                fxSettings.dlySync = getVal (handles.fxDlySync) > 0.5f;
+
+                fxSettings.rvbTime = getVal (handles.fxRvbTime);
+                fxSettings.rvbSize = getVal (handles.fxRvbSize);
+                fxSettings.rvbDamp = getVal (handles.fxRvbDamp);
+                fxSettings.rvbPredelay = getVal (handles.fxRvbPredelay);
+                fxSettings.rvbMix = getVal (handles.fxRvbMix);
+            }
+
+            if (fxChanged || (fxSettings.dlySync && bpm != fxBpm))
+            {
+                fxBpm = bpm;
+                updateFxDsp();
+            }
+
+            if (envChanged || filterChanged)
+                pushVoiceParams();
+        }
+
+        void rebuildModRouting()
+        {
+            // Slot amounts are percent; targets take semitones (pitch), cents (detune) or raw 0..1 units
+            auto targetOf = [] (float slotTarget) {
+                int t = (int)std::round (slotTarget);
+                return (t > (int)Target::None && t < (int)Target::Count) ? (Target)t : Target::None;
+            };
+            auto lfoAmountTarget = [] (int lfo, int slot) { return (Target)((int)Target::Lfo1Amount1 + lfo * 4 + slot); };
+
+            modRouting.clear();
+
+            for (auto& slot : modSlots)
+            {
+                auto t = targetOf (slot.target);
+                modRouting.addRoute (modSrcEnv, (int)t, Synth::getModUnitScale (t) * slot.amount / 100.0f);
+            }
+
+            for (auto& slot : ctrlSlots)
+            {
+                auto t = targetOf (slot.target);
+                modRouting.addRoute (modSrcEnv, (int)t, Synth::getModUnitScale (t) * slot.amount / 100.0f);
+            }
+
+            // LFO slot depth can itself be a target: only wire that up when some slot drives it
+            bool depthTargeted[(size_t)Target::Count] = {};
+            auto markDepth = [&] (float slotTarget, float amount) {
+                if (amount != 0.0f)
+                    depthTargeted[(size_t)targetOf (slotTarget)] = true;
+            };
+            for (auto& slot : modSlots) markDepth (slot.target, slot.amount);
+            for (auto& slot : ctrlSlots) markDepth (slot.target, slot.amount);
+            for (auto& lfo : globalLfos)
+                for (auto& slot : lfo.slots) markDepth (slot.target, slot.amount);
+
+            for (int l = 0; l < 2; ++l)
+            {
+                for (int i = 0; i < 4; ++i)
+                {
+                    auto& slot = globalLfos[(size_t)l].slots[i];
+                    auto t = targetOf (slot.target);
+                    auto depth = lfoAmountTarget (l, i);
+                    bool hasDepth = depthTargeted[(size_t)depth];
+                    const float scale = Synth::getModUnitScale (t);
+
+                    modRouting.addRoute (modSrcLfo1 + l, (int)t, scale * slot.amount / 100.0f,
+                                         hasDepth ? (int)depth : 0, hasDepth ? scale : 0.0f);
+                }
+            }
+        }
+
+        void updateFxDsp()
+        {
+            chorus.setRate (fxSettings.modRate);
+            chorus.setDepth (fxSettings.modDepth);
+            chorus.setFeedback (fxSettings.modFeedback);
+            chorus.setCentreDelay (fxSettings.modType == 3 ? 7.0f : 20.0f); // Flanger uses shorter delay
+
+            phaser.setRate (fxSettings.modRate);
+            phaser.setDepth (fxSettings.modDepth);
+            phaser.setFeedback (fxSettings.modFeedback);
+
+            smoothers.setTarget (smModMix, fxSettings.modMix);
+            smoothers.setTarget (smDlyFeedback, fxSettings.dlyFeedback);
+            smoothers.setTarget (smDlyMix, fxSettings.dlyMix);
+            float actualDlyTime = fxSettings.dlyTime;
+            if (fxSettings.dlySync) {
+                // Use note divisions for tempo-synced delay
+                static constexpr float divs[] = { 0.0625f, 0.125f, 0.25f, 0.5f, 1.0f, 2.0f, 4.0f, 8.0f, 16.0f };
+                int idx = juce::jlimit (0, 8, fxSettings.dlyNoteIdx);
+                double beatsPerSec = bpm / 60.0;
+                double secPerBeat = 1.0 / beatsPerSec;
+                actualDlyTime = (float)(secPerBeat * divs[idx] * 1000.0); // Convert to ms
+            }
+            smoothers.setTarget (smDlyTime, actualDlyTime);
+
+            reverbParams.roomSize = juce::jmap (fxSettings.rvbTime, 0.0f, 10.0f, 0.0f, 1.0f); // Map time to room size
+            reverbParams.damping = fxSettings.rvbDamp;
+            reverbParams.width = 1.0f; // Use full stereo width
+            smoothers.setTarget (smRvbMix, fxSettings.rvbMix);
+            // Note: Predelay would require a separate delay line, skipping for now
+
+        }
+
+        void applySmoothedParams()
+        {
+            synth().applySmoothedOscillators();
+
+            globalSubLevel = smoothers.get (smSubLevel);
+            globalNoiseVolume = smoothers.get (smNoiseVolume);
+
+            baseFilterCutoff = 20.0f * std::exp2 (smoothers.get (smFilterCutoff));
+            baseFilterRes = smoothers.get (smFilterRes);
+            baseFilterDrive = smoothers.get (smFilterDrive);
+            ampLevel = smoothers.get (smAmpLevel);
+        }
+
+        void applySmoothedFx (const ControlSpan& span)
+        {
+            // The mod type may have switched between chorus and phaser
+            chorus.setMix (fxSettings.modType == 2 ? 0.0f : span.modMix); // Phaser uses its own mix
+            phaser.setMix (fxSettings.modType == 2 ? span.modMix : 0.0f);
+
+            delay.feedback = span.dlyFeedback;
+            delay.mix = span.dlyMix;
+            delay.delaySamples = span.dlyTime * (float)sampleRate / 1000.0f;
+
+            float rvbMix = span.rvbMix;
+            reverbParams.wetLevel = rvbMix;
+            reverbParams.dryLevel = 1.0f - (rvbMix * 0.5f);
+            reverb.setParameters (reverbParams);
+        }
+
+        void pushVoiceParams()
+        {
+            // Only runs when an envelope or filter group changed, so idle voices are
+            // refreshed too rather than waiting for the next edit after they start.
+            for (auto& v : voices)
+            {
+                v.ampEnv.setParameters (ampParams);
+                v.filterEnv.setParameters (filterParams);
+                v.pitchEnv.setParameters (pitchParams);
+                v.modEnv.setParameters (modParams);
+
+                v.filter.setMode (filterType, filterIs24dB); // 0 = LP, 1 = HP, 2 = BP
+            }
+        }
+
+        void startVoice (int midiNote, float velocity)
+        {
+            // 1. Find a voice to use (including voice stealing)
+            Voice* voiceToUse = nullptr;
+            double oldestNoteTime = std::numeric_limits<double>::max();
+            Voice* oldestVoice = nullptr;
+
+            for (auto& v : voices)
+            {
+                if (!v.isActive.load() || (v.midiNote == midiNote && v.ampEnv.isActive()))
+                {
+                    voiceToUse = &v;
+                    break;
+                }
+                if (v.noteOnTime < oldestNoteTime)
+                {
+                    oldestNoteTime = v.noteOnTime;
+                    oldestVoice = &v;
+                }
+            }
+
+            if (voiceToUse == nullptr)
+                voiceToUse = oldestVoice;
+
+            if (voiceToUse != nullptr)
+            {
+                voiceToUse->reset();
+                voiceToUse->midiNote = midiNote;
+                voiceToUse->velocity = velocity;
+                voiceToUse->isActive.store (true);
+                voiceToUse->noteOnTime = juce::Time::getMillisecondCounterHiRes();
+                voiceToUse->decimationCounter = juce::Random::getSystemRandom().nextInt (8);
+                voiceToUse->noiseState = 0x12345678 + (uint32_t)(midiNote * 997) + (uint32_t)(velocity * 100000);
+
+                float freq = (float)juce::MidiMessage::getMidiNoteInHertz (midiNote);
+                voiceToUse->targetFrequency = freq;
+
+                // Portamento: if enabled and we have a previous note, start glide from that frequency
+                if (portaOn && lastMonoNote >= 0 && lastMonoNote != midiNote)
+                {
+                    voiceToUse->currentGlideFreq = currentPortaFreq;
+                }
+                else
+                {
+                    voiceToUse->currentGlideFreq = freq;
+                }
+
+                // Update global portamento state
+                currentPortaFreq = freq;
+                lastMonoNote = midiNote;
+
+                synth().startOscillators (voiceToUse->osc, freq);
+
+                // LFOs KeySync
+                for (int i = 0; i < 2; ++i)
+                    voiceToUse->lfos[(size_t)i].noteOn (globalLfos[(size_t)i].phaseStart, globalLfos[(size_t)i].keySync);
+
+                // Apply global params initially
+                voiceToUse->ampEnv.setParameters (ampParams);
+                voiceToUse->filterEnv.setParameters (filterParams);
+                voiceToUse->pitchEnv.setParameters (pitchParams);
+                voiceToUse->modEnv.setParameters (modParams);
+
+                voiceToUse->ampEnv.noteOn();
+                voiceToUse->releasing = false;
+                voiceToUse->filterEnv.noteOn();
+                voiceToUse->pitchEnv.noteOn();
+                voiceToUse->modEnv.noteOn();
+            }
+        }
+
+        void releaseVoices (int midiNote)
+        {
+            for (auto& v : voices)
+            {
+                if (v.isActive && v.midiNote == midiNote)
+                {
+                    v.startAmpRelease();
+                    v.filterEnv.noteOff();
+                    v.pitchEnv.noteOff();
+                    v.modEnv.noteOff();
+                }
+            }
+        }
+
+        /** Fires the arp events due at pos; returns where the segment has to end for the next one. */
+        int handleArp (int pos, int next)
+        {
+            if (!arpSettings.enabled)
+                return next;
+
+            // Arp is always tempo synced
+            static constexpr double divs[] = { 0.0625, 0.125, 0.25, 0.5, 1.0, 2.0, 4.0, 8.0, 16.0 };
+            int idx = juce::jlimit (0, 8, arpSettings.rateNoteIdx);
+            double samplesPerStep = sampleRate * 60.0 / juce::jmax (1.0, bpm) * divs[idx];
+            arp.setTiming (samplesPerStep, arpSettings.gate);
+
+            arp.fireDueEvents ([this] (int note, float velocity) { startVoice (note, velocity); },
+                               [this] (int note) { releaseVoices (note); });
+
+            return arp.isRunning() ? juce::jmin (next, pos + arp.getSamplesToNextEvent()) : next;
+        }
+
+        void renderBlock (const juce::AudioSourceChannelInfo& bufferToFill)
+        {
+            bufferToFill.clearActiveBufferRegion();
+
+            int numSamples = bufferToFill.numSamples;
+
+            // The tier is latched per block; a bounce has no deadline for the governor to defend
+            quality = RenderQuality::get (getRenderQuality());
+            degradations = quality.allowDegradation ? governor.getDegradations() : 0;
+            controlInterval = quality.allowDegradation ? governor.getControlInterval (quality.controlInterval) : quality.controlInterval;
+
+            auto* mainOutL = bufferToFill.buffer->getWritePointer (0, bufferToFill.startSample);
+            auto* mainOutR = bufferToFill.buffer->getWritePointer (1, bufferToFill.startSample);
+
+            // LFO rates follow the tempo, so resolve them per block
+            for (size_t l = 0; l < lfoClocks.size(); ++l)
+            {
+                const auto& g = globalLfos[l];
+                auto& c = lfoClocks[l];
+                c.shape = g.shape;
+                c.phaseIncrement = Lfo::getRateHz (g.syncMode, g.rateHz, g.rateNoteIdx, bpm) / sampleRate;
+                c.phaseStart = g.phaseStart;
+                c.delaySamples = Lfo::msToSamples (g.delayMs, sampleRate);
+                c.fadeSamples = Lfo::msToSamples (g.fadeMs, sampleRate);
+            }
+
+            // Step the smoothers through the block up front, one span per control block while
+            // anything glides, and keep what each span shares: the oscillator policy, the voice
+            // settings and the FX mixes. The voices then render every span in one batch.
+            std::optional<decltype (synth().getOscillators())> oscillators[maxControlSpans];
+            int numSpans = 0;
+
+            for (int offset = 0; offset < numSamples; ++numSpans)
+            {
+                jassert (numSpans < maxControlSpans);
+                const int length = smoothers.isSmoothing() ? juce::jmin (controlSpanSize, numSamples - offset) : numSamples - offset;
+
+                if (smoothers.advance (length))
+                    applySmoothedParams();
+
+                auto& span = spans[(size_t)numSpans];
+                span.start = offset;
+                span.length = length;
+                span.voice = getVoiceBlock();
+                span.modMix = smoothers.get (smModMix);
+                span.dlyTime = smoothers.get (smDlyTime);
+                span.dlyFeedback = smoothers.get (smDlyFeedback);
+                span.dlyMix = smoothers.get (smDlyMix);
+                span.rvbMix = smoothers.get (smRvbMix);
+                oscillators[numSpans].emplace (synth().getOscillators());
+
+                offset += length;
+            }
+
+            // Voices render independently into their own buffers, in parallel where it pays off
+            int activeVoices[numVoices];
+            int numActive = 0;
+            for (int i = 0; i < numVoices; ++i)
+                if (voices[(size_t)i].isActive.load())
+                    activeVoices[numActive++] = i;
+
+            auto* const* voiceChannels = voiceBuffers.getArrayOfWritePointers(); // fetched here: AudioBuffer is not thread-safe
+            renderPool->run (numActive, numSamples, [&] (int job) {
+                const int i = activeVoices[job];
+                auto& voice = voices[(size_t)i];
+                auto* vL = voiceChannels[i * 2];
+                auto* vR = voiceChannels[i * 2 + 1];
+                juce::FloatVectorOperations::clear (vL, numSamples);
+                juce::FloatVectorOperations::clear (vR, numSamples);
+
+                for (int k = 0; k < numSpans && voice.isActive.load(); ++k)
+                {
+                    const auto& span = spans[(size_t)k];
+                    VoiceEngine::render (*oscillators[k], voice, span.voice, vL + span.start, vR + span.start, span.length);
+                }
+            });
+
+            // Sum in voice order so the result never depends on thread timing
+            for (int job = 0; job < numActive; ++job)
+            {
+                const int i = activeVoices[job];
+                juce::FloatVectorOperations::add (mainOutL, voiceChannels[i * 2], numSamples);
+                juce::FloatVectorOperations::add (mainOutR, voiceChannels[i * 2 + 1], numSamples);
+            }
+
+            // Apply Global Effects, span by span so their mixes glide with the voices
+            // Modulation FX are the first thing the governor drops
+            const bool modFxOn = (degradations & CpuGovernor::optionalStagesOff) == 0;
+            delay.cubic = quality.preciseFx;
+
+            for (int k = 0; k < numSpans; ++k)
+            {
+                const auto& span = spans[(size_t)k];
+                applySmoothedFx (span);
+
+                auto block = juce::dsp::AudioBlock<float> (*bufferToFill.buffer)
+                                 .getSubBlock ((size_t)(bufferToFill.startSample + span.start), (size_t)span.length);
+                juce::dsp::ProcessContextReplacing<float> context (block);
+
+                if (modFxOn && (fxSettings.modType == 1 || fxSettings.modType == 3))
+                    chorus.process (context);
+                else if (modFxOn && fxSettings.modType == 2)
+                    phaser.process (context);
+
+                // Smoothed mixes, so a fade to zero runs out before the effect is bypassed
+                if (delay.mix > 0.01f)
+                    delay.process (context);
+
+                if (reverbParams.wetLevel > 0.01f)
+                    reverb.process (context);
+            }
+        }
+
+        VoiceEngine::Block getVoiceBlock() const
+        {
+            VoiceEngine::Block b;
+            b.sampleRate = sampleRate;
+            b.controlInterval = controlInterval;
+            b.degradations = degradations;
+            b.lfoClocks = lfoClocks.data();
+            b.pitchBend = pitchWheel * pbRange;
+            b.portaOn = portaOn;
+            b.portaTime = portaTime;
+            b.subLevel = globalSubLevel;
+            b.subModulated = modRouting.isRouted ((int)Target::SubLevel);
+            b.noiseVolume = globalNoiseVolume;
+            b.filterCutoff = baseFilterCutoff;
+            b.filterRes = baseFilterRes;
+            b.filterDrive = baseFilterDrive;
+            b.filterKeyTrack = filterKeyTrack;
+            b.filterVelocity = filterVelocity;
+            b.filterAftertouch = filterAftertouch;
+            b.filterEnvAmount = filterEnvAmount;
+            b.filterEnvVelocity = filterEnvVelocity;
+            b.filterEnvAftertouch = filterEnvAftertouch;
+            b.ampLevel = ampLevel;
+            b.ampVelocity = ampVelocity;
+            b.ampAftertouch = ampAftertouch;
+            return b;
+        }
+
+        struct DelayBlock
+        {
+            juce::AudioBuffer<float> line; // L/R, a power of two long so positions wrap with a mask
+            int writePos = 0;
+            float delaySamples = 1.0f;
+            float feedback = 0.0f;
+            float mix = 0.0f;
+            bool cubic = false; // 4-point Hermite reads instead of linear (RenderQuality::preciseFx)
+
+            void prepare (const juce::dsp::ProcessSpec&) { line.setSize (2, 1 << 18); line.clear(); writePos = 0; } // 5.4 s at 48k
+
+            void process (juce::dsp::ProcessContextReplacing<float>& context)
+            {
+                auto& block = context.getOutputBlock();
+                auto* chL = block.getChannelPointer (0);
+                auto* chR = block.getChannelPointer (1);
+                int numSamples = (int)block.getNumSamples();
+
+                if (cubic)
+                    processLoop<true> (chL, chR, numSamples);
+                else
+                    processLoop<false> (chL, chR, numSamples);
+            }
+
+            template <bool Cubic>
+            void processLoop (float* chL, float* chR, int numSamples)
+            {
+                auto* bufL = line.getWritePointer (0);
+                auto* bufR = line.getWritePointer (1);
+                const int mask = line.getNumSamples() - 1;
+
+                // The delay only moves between blocks; the Hermite read needs one written sample on the newer side
+                const float d = juce::jlimit (2.0f, (float)(mask - 4), delaySamples);
+                const int whole = (int)d;
+                const float t = d - (float)whole; // towards the older sample
+
+                auto read = [&] (const float* buf, int newer) {
+                    const float x0 = buf[newer];
+                    const float x1 = buf[(newer - 1) & mask];
+
+                    if constexpr (Cubic)
+                    {
+                        const float xm1 = buf[(newer + 1) & mask];
+                        const float x2 = buf[(newer - 2) & mask];
+                        const float c1 = 0.5f * (x1 - xm1);
+                        const float c2 = xm1 - 2.5f * x0 + 2.0f * x1 - 0.5f * x2;
+                        const float c3 = 0.5f * (x2 - xm1) + 1.5f * (x0 - x1);
+                        return ((c3 * t + c2) * t + c1) * t + x0;
+                    }
+                    else
+                    {
+                        return x0 + (x1 - x0) * t;
+                    }
+                };
+
+                for (int s = 0; s < numSamples; ++s)
+                {
+                    float inL = chL[s];
+                    float inR = chR[s];
+
+                    const int newer = (writePos - whole) & mask;
+                    float dlyL = read (bufL, newer);
+                    float dlyR = read (bufR, newer);
+
+                    bufL[writePos] = inL + dlyL * feedback;
+                    bufR[writePos] = inR + dlyR * feedback;
+                    writePos = (writePos + 1) & mask;
+
+                    chL[s] = inL + dlyL * mix;
+                    chR[s] = inR + dlyR * mix;
+                }
+            }
+        };
+
+        // Registry handles, resolved once in bindParameters() so updateParams()
+        // reads a flat slot table instead of building path strings every block.
+        struct LfoHandles
+        {
+            ParameterHandle shape, sync, rateHz, rateNote, keySync, phase, delay, fade;
+            ParameterHandle slotTarget[4], slotAmount[4];
+        };
+
+        struct EnvHandles
+        {
+            ParameterHandle attack, decay, sustain, release;
+        };
+
+        struct ParamHandles
+        {
+            ParameterHandle subVolume, subOctave, noiseVolume;
+            std::array<LfoHandles, 2> lfos;
+
+            ParameterHandle filterType, filterCutoff, filterRes, filterDrive, filterKeyTrack, filterSlope;
+            ParameterHandle filterVelocity, filterAftertouch;
+
+            EnvHandles ampEnv, filterEnv, pitchEnv, modEnv;
+            ParameterHandle filterEnvAmount, filterEnvTarget, filterEnvVelocity, filterEnvAftertouch, filterEnvVelAttack;
+            ParameterHandle pitchEnvAmount, pitchEnvTarget, pitchEnvVelocity, pitchEnvAftertouch, pitchEnvVelAttack;
+
+            ParameterHandle modSlotTarget[4], modSlotAmount[4];
+            ParameterHandle ctrlSlotTarget[16], ctrlSlotAmount[16];
+
+            ParameterHandle pbRange, voiceMode, tempo, tempoSync, portaOn, portaTime, portaMode, cpuBudget, quality;
+            ParameterHandle ampLevel, ampVelocity, ampAftertouch;
+            ParameterHandle arpOn, arpRateNote, arpMode, arpOctave, arpGate, arpLatch;
+
+            ParameterHandle fxModType, fxModRate, fxModDepth, fxModFeedback, fxModMix;
+            ParameterHandle fxDlyTime, fxDlyNote, fxDlyFeedback, fxDlyMix, fxDlySync;
+            ParameterHandle fxRvbTime, fxRvbSize, fxRvbDamp, fxRvbPredelay, fxRvbMix;
+        };
+
+        // One watch per module group; updateParams() skips groups that haven't changed.
+        // The oscillator groups are watched by the synth.
+        struct GroupWatches
+        {
+            ParameterGroupWatch subOsc, noise;
+            ParameterGroupWatch lfos[2];
+            ParameterGroupWatch filter, ampEnv, filterEnv, pitchEnv, modEnv, mod;
+            ParameterGroupWatch control, ampOutput, arp, fx;
+
+            void invalidate()
+            {
+                for (auto* w : { &subOsc, &noise, &lfos[0], &lfos[1], &filter, &ampEnv, &filterEnv,
+                                 &pitchEnv, &modEnv, &mod, &control, &ampOutput, &arp, &fx })
+                    w->invalidate();
+            }
+        };
+
+        struct ModSlot
+        {
+            float target = 0.0f;
+            float amount = 0.0f;
+        };
+
+        ParamHandles handles;
+        GroupWatches watches;
+
+        double internalBpm = 120.0;
+        bool useHostBpm = false;
+        double fxBpm = 0.0;
+
+        ArpSettings arpSettings;
+        Arpeggiator arp;
+        FxSettings fxSettings;
+        bool isMonoMode = false;
+        std::vector<int> monoHeldNotes;
+
+        // DSP FX
+        juce::dsp::Chorus<float> chorus;
+        juce::dsp::Phaser<float> phaser;
+        juce::dsp::Reverb reverb;
+        juce::dsp::Reverb::Parameters reverbParams;
+        DelayBlock delay;
+
+        // Global Parameter Cache (shared across voices)
+        float globalSubLevel = 0.0f;
+        float globalNoiseVolume = 0.0f;
+        std::array<LfoSettings, 2> globalLfos;
+        std::array<Lfo::Settings, 2> lfoClocks; // globalLfos in samples at the current rate and tempo
+        int   filterType = 0; // 0=LP, 1=HP, 2=BP
+        float baseFilterCutoff = 20000.0f;
+        float baseFilterRes = 0.0f;
+        float baseFilterDrive = 1.0f;
+        float filterKeyTrack = 0.5f;
+        bool filterIs24dB = true;
+        float filterVelocity = 0.0f;
+        float filterAftertouch = 0.0f;
+
+        float filterEnvAmount = 0.0f;
+        int filterEnvTarget = 2; // 0=Osc1, 1=Osc2, 2=Both (for future use)
+        float filterEnvVelocity = 0.0f;
+        float filterEnvAftertouch = 0.0f;
+        float filterEnvVelAttack = 0.0f;
+
+        int pitchEnvTarget = 2; // 0=Osc1, 1=Osc2, 2=Both
+        float pitchEnvVelAttack = 0.0f;
+
+        float ampLevel = 0.8f;
+        float ampVelocity = 0.5f;
+        float ampAftertouch = 0.0f;
+
+        float pitchWheel = 0.0f;  // -1.0 to 1.0
+        float modWheel = 0.0f;    // 0.0 to 1.0
+        float pbRange = 2.0f;     // Pitch bend range in semitones
+
+        bool portaOn = false;
+        float portaTime = 100.0f; // ms
+        bool portaMode = false; // false=time, true=rate
+        float currentPortaFreq = 440.0f;
+        int lastMonoNote = -1;
+
+        juce::ADSR::Parameters ampParams, filterParams, pitchParams, modParams;
+
+        ModSlot modSlots[4];
+        std::array<ModSlot, 16> ctrlSlots; // Mod Env is the source of every slot
+
+        juce::AudioBuffer<float> voiceBuffers; // L/R pair per voice
+        std::shared_ptr<RenderPool> renderPool;
+        std::array<ControlSpan, (size_t)maxControlSpans> spans; // renderBlock's, one per control span
+        CpuGovernor governor;
+        std::atomic<int> chosenQuality { RenderQuality::realtime };
+        std::atomic<bool> nonRealtime { false };
+
+        JUCE_DECLARE_NON_COPYABLE (PolySignalPath)
+    };
+}
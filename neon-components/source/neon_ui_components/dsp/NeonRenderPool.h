@@ -0,0 +1,238 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <vector>
+
+#if JUCE_INTEL
+ #include <immintrin.h>
+#endif
+
+namespace neon
+{
+    /**
+     * RenderPool
+     * Worker threads for rendering voices in parallel, spawned once per process and shared
+     * by every plugin instance (getShared()).
+     *
+     * run() publishes a batch into one of a few fixed slots. The calling thread claims jobs
+     * alongside the workers (an atomic counter hands out the indices) and returns once all
+     * of them have finished. The audio thread never locks or allocates: workers are woken
+     * through an atomic epoch (a futex, ulock or WaitOnAddress wait underneath), and any job
+     * no worker has started by the time the caller runs out is taken over by the caller.
+     * Workers run at realtime priority, so the caller only ever waits on a job a worker is
+     * in the middle of:
+     *
+     *     renderPool->run (numActive, numSamples, [&] (int job) { renderVoice (job); });
+     *     // then sum the per-voice buffers in voice order
+     *
+     * A job may only touch its own voice. Short blocks, single jobs, a full set of slots or a
+     * single-core machine run inline on the caller.
+     */
+    class RenderPool
+    {
+    public:
+        // Below this many samples per job the wake-up costs more than the parallelism gains
+        static constexpr int minSamplesPerJob = 64;
+
+        RenderPool()
+        {
+            const int numWorkers = juce::jlimit (0, maxWorkers, juce::SystemStats::getNumCpus() - 1);
+            for (int i = 0; i < numWorkers; ++i)
+            {
+                workers.push_back (std::make_unique<Worker> (*this, i));
+
+                // The audio thread may wait on a job in flight, so a worker must never be preempted by ordinary threads
+                if (! workers.back()->startRealtimeThread (juce::Thread::RealtimeOptions().withPriority (10)))
+                    workers.back()->startThread (juce::Thread::Priority::highest);
+            }
+        }
+
+        ~RenderPool()
+        {
+            for (auto& w : workers)
+                w->signalThreadShouldExit();
+
+            epoch.fetch_add (1);
+            epoch.notify_all();
+
+            for (auto& w : workers)
+                w->stopThread (1000);
+        }
+
+        static std::shared_ptr<RenderPool> getShared()
+        {
+            // One pool per process; it lives as long as any engine holds it
+            static std::mutex lock;
+            static std::weak_ptr<RenderPool> cache;
+
+            const std::lock_guard<std::mutex> scopedLock (lock);
+            auto shared = cache.lock();
+            if (shared == nullptr)
+            {
+                shared = std::make_shared<RenderPool>();
+                cache = shared;
+            }
+            return shared;
+        }
+
+        int getNumWorkers() const noexcept { return (int)workers.size(); }
+
+        /** Realtime-safe: calls job (0 .. numJobs - 1), spread over the workers and this thread. */
+        template <typename Fn>
+        void run (int numJobs, int numSamples, Fn&& job)
+        {
+            Batch* batch = nullptr;
+            if (numJobs > 1 && numSamples >= minSamplesPerJob && ! workers.empty())
+                batch = claimBatch();
+
+            if (batch == nullptr)
+            {
+                for (int i = 0; i < numJobs; ++i)
+                    job (i);
+                return;
+            }
+
+            using FnType = std::remove_reference_t<Fn>;
+            batch->fn = [] (void* context, int index) { (*static_cast<FnType*> (context)) (index); };
+            batch->context = (void*)std::addressof (job);
+            batch->numJobs = numJobs;
+            batch->nextJob.store (0);
+            batch->pending.store (numJobs);
+            batch->state.store (open);
+
+            // Sleeping workers are only woken by a syscall when there are any; spinning ones see the epoch
+            epoch.fetch_add (1);
+            const int numToWake = juce::jmin (numJobs - 1, sleepers.load());
+            for (int i = 0; i < numToWake; ++i)
+                epoch.notify_one();
+
+            // Help out: every job no worker has started yet is claimed here, so a late or
+            // preempted wake-up costs nothing. Only jobs already running are waited for.
+            work (*batch);
+
+            for (int spin = 0; batch->pending.load() > 0 && spin < spinsBeforeSleeping; ++spin)
+                pause();
+
+            for (int left = batch->pending.load(); left > 0; left = batch->pending.load())
+                batch->pending.wait (left);
+
+            // The slot is handed out again once no worker is looking at it (claimBatch())
+            batch->state.store (idle);
+        }
+
+    private:
+        static constexpr int maxWorkers = 15;
+        static constexpr int maxBatches = 8; // concurrent run() calls, e.g. several plugin instances
+        static constexpr int spinsBeforeSleeping = 2000; // a few microseconds: back-to-back blocks find the workers awake
+
+        enum BatchState { idle, filling, open };
+
+        struct Batch
+        {
+            std::atomic<int> state { idle };
+            std::atomic<int> users { 0 };
+            std::atomic<int> nextJob { 0 };
+            std::atomic<int> pending { 0 };
+            void (*fn) (void*, int) = nullptr;
+            void* context = nullptr;
+            int numJobs = 0;
+        };
+
+        struct Worker : public juce::Thread
+        {
+            Worker (RenderPool& p, int index)
+                : juce::Thread ("Neon Render Worker " + juce::String (index + 1)), pool (p) {}
+
+            void run() override
+            {
+                while (! threadShouldExit())
+                {
+                    const uint32_t seen = pool.epoch.load();
+
+                    if (pool.drainBatches())
+                        continue;
+
+                    // Spin briefly for the next block, then sleep until run() moves the epoch on
+                    for (int spin = 0; spin < spinsBeforeSleeping && pool.epoch.load() == seen; ++spin)
+                        pause();
+
+                    pool.sleepers.fetch_add (1);
+                    if (pool.epoch.load() == seen && ! threadShouldExit())
+                        pool.epoch.wait (seen);
+                    pool.sleepers.fetch_sub (1);
+                }
+            }
+
+            RenderPool& pool;
+        };
+
+        static void pause() noexcept
+        {
+           #if JUCE_INTEL
+            _mm_pause();
+           #elif JUCE_ARM && (JUCE_CLANG || JUCE_GCC)
+            __asm__ __volatile__ ("yield");
+           #endif
+        }
+
+        Batch* claimBatch() noexcept
+        {
+            for (auto& b : batches)
+            {
+                int expected = idle;
+                if (! b.state.compare_exchange_strong (expected, filling))
+                    continue;
+
+                // A worker that saw the previous batch open may still be on its way out
+                if (b.users.load() == 0)
+                    return &b;
+
+                b.state.store (idle);
+            }
+            return nullptr;
+        }
+
+        /** Runs jobs from every open batch; returns false if there was nothing to do. */
+        bool drainBatches() noexcept
+        {
+            bool didWork = false;
+            for (auto& b : batches)
+            {
+                if (b.state.load() != open)
+                    continue;
+
+                b.users.fetch_add (1);
+                if (b.state.load() == open)
+                    didWork = work (b) || didWork;
+                b.users.fetch_sub (1);
+            }
+            return didWork;
+        }
+
+        static bool work (Batch& b) noexcept
+        {
+            bool didWork = false;
+            for (int index = b.nextJob.fetch_add (1); index < b.numJobs; index = b.nextJob.fetch_add (1))
+            {
+                b.fn (b.context, index);
+                if (b.pending.fetch_sub (1) == 1)
+                    b.pending.notify_one();
+                didWork = true;
+            }
+            return didWork;
+        }
+
+        std::array<Batch, (size_t)maxBatches> batches;
+        std::atomic<uint32_t> epoch { 0 }; // moves on with every published batch
+        std::atomic<int> sleepers { 0 };   // workers blocked on epoch
+        std::vector<std::unique_ptr<Worker>> workers;
+
+        JUCE_DECLARE_NON_COPYABLE (RenderPool)
+    };
+}
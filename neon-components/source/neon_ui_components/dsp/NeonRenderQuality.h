@@ -0,0 +1,67 @@
+#pragma once
+
+#include <juce_audio_basics/juce_audio_basics.h>
+#include "NeonAdaa.h"
+#include <vector>
+
+namespace neon
+{
+    /**
+     * RenderQuality
+     * Three tiers that trade CPU for fidelity. REALTIME is how the engines have always
+     * rendered, DRAFT is cheaper for tracking on a loaded session, and OFFLINE spends
+     * whatever it takes, because a bounce has no deadline. Engines render at OFFLINE
+     * whenever the host renders non-realtime, whatever the user picked:
+     *
+     *     signalPath.setNonRealtime (isNonRealtime());                          // processBlock
+     *     quality = RenderQuality::get (RenderQuality::resolve (chosen, offline)); // engine, per block
+     *
+     * Each engine applies the settings it has a use for; a tier that has nothing to trade in
+     * an engine renders as REALTIME there.
+     */
+    struct RenderQuality
+    {
+        enum Tier { draft, realtime, offline };
+
+        struct Settings
+        {
+            int controlInterval = 8;            // samples between modulation and filter coefficient updates
+            bool cubicInterpolation = false;    // wavetable reads through 4-point Hermite instead of linear
+            Adaa::Order antiAliasing = Adaa::firstOrder; // drive, bit reduction and fold
+            int oversampling = 1;               // oscillators that are not band-limited run at this multiple, 1, 2 or 4
+            bool preciseFx = false;             // effect delay lines read through 4-point Hermite
+            bool allowDegradation = true;       // the CpuGovernor may step in
+        };
+
+        static Settings get (Tier tier) noexcept
+        {
+            Settings s;
+
+            if (tier == draft)
+            {
+                s.controlInterval = 16;
+                s.antiAliasing = Adaa::off;
+            }
+            else if (tier == offline)
+            {
+                s.controlInterval = 2;
+                s.cubicInterpolation = true;
+                s.antiAliasing = Adaa::secondOrder;
+                s.oversampling = 4;
+                s.preciseFx = true;
+                s.allowDegradation = false; // a bounce is allowed to be slower than realtime
+            }
+
+            return s;
+        }
+
+        /** The tier to render at: the chosen one while playing live, OFFLINE when bouncing. */
+        static Tier resolve (int chosenTier, bool nonRealtime) noexcept
+        {
+            return nonRealtime ? offline : (Tier)juce::jlimit ((int)draft, (int)offline, chosenTier);
+        }
+
+        /** Labels for a "Quality" choice parameter, in Tier order. */
+        static std::vector<juce::String> getNames() { return { "DRAFT", "REALTIME", "OFFLINE" }; }
+    };
+}
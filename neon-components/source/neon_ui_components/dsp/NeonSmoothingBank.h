@@ -0,0 +1,108 @@
+#pragma once
+
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <array>
+#include <cmath>
+
+namespace neon
+{
+    /**
+     * SmoothingBank
+     * One-pole smoothing for every continuous parameter of an engine, held in one
+     * contiguous array and advanced for a whole control block in a single vectorised
+     * pass (x = target + (x - target) * decay^n), instead of one SmoothedValue per knob.
+     *
+     *     enum Smoothed { cutoff, level, numSmoothed };
+     *     SmoothingBank<numSmoothed> smoothers;
+     *
+     *     smoothers.setTarget (cutoff, newCutoff);     // whenever the parameter moves
+     *     if (smoothers.advance (numSamples))          // once per sub-block
+     *         filter.setCutoff (smoothers.get (cutoff));
+     */
+    template <int NumValues>
+    class SmoothingBank
+    {
+    public:
+        // Sub-block length engines step in while anything is still gliding
+        static constexpr int controlBlockSize = 32;
+
+        void prepare (double newSampleRate, double timeConstantMs = 15.0)
+        {
+            timeConstantSamples = juce::jmax (1.0, newSampleRate * timeConstantMs / 1000.0);
+            lastStepSize = -1;
+            reset();
+        }
+
+        /** The next advance() jumps straight to the targets (prepare, patch reset). */
+        void reset() noexcept { snapPending = true; }
+
+        void setTarget (int index, float value) noexcept
+        {
+            jassert (juce::isPositiveAndBelow (index, NumValues));
+            if (targets[(size_t)index] == value)
+                return;
+
+            targets[(size_t)index] = value;
+            remainingSamples = settleSamples();
+        }
+
+        float get (int index) const noexcept { return current[(size_t)index]; }
+        float getTarget (int index) const noexcept { return targets[(size_t)index]; }
+
+        bool isSmoothing() const noexcept { return snapPending || remainingSamples > 0; }
+
+        /** Steps every value by numSamples. Returns false if nothing moved. */
+        bool advance (int numSamples) noexcept
+        {
+            if (snapPending)
+            {
+                snapPending = false;
+                remainingSamples = 0;
+                current = targets;
+                return true;
+            }
+
+            if (remainingSamples <= 0 || numSamples <= 0)
+                return false;
+
+            remainingSamples -= numSamples;
+            if (remainingSamples <= 0)
+            {
+                // Within 0.1% of the step: land exactly and go idle
+                current = targets;
+                return true;
+            }
+
+            if (numSamples != lastStepSize)
+            {
+                lastStepSize = numSamples;
+                stepDecay = (float)std::exp (-(double)numSamples / timeConstantSamples);
+            }
+
+            juce::FloatVectorOperations::subtract (delta.data(), current.data(), targets.data(), paddedSize);
+            juce::FloatVectorOperations::multiply (delta.data(), stepDecay, paddedSize);
+            juce::FloatVectorOperations::add (current.data(), targets.data(), delta.data(), paddedSize);
+            return true;
+        }
+
+    private:
+        // Pad to a whole number of SIMD lanes so the vector ops never take a scalar tail
+        static constexpr int paddedSize = (NumValues + 7) & ~7;
+
+        int settleSamples() const noexcept
+        {
+            // e^-6.9 ~= 1e-3
+            return (int)std::ceil (timeConstantSamples * 6.9);
+        }
+
+        alignas (32) std::array<float, (size_t)paddedSize> current {};
+        alignas (32) std::array<float, (size_t)paddedSize> targets {};
+        alignas (32) std::array<float, (size_t)paddedSize> delta {};
+
+        double timeConstantSamples = 661.5;
+        float stepDecay = 1.0f;
+        int lastStepSize = -1;
+        int remainingSamples = 0;
+        bool snapPending = true;
+    };
+}
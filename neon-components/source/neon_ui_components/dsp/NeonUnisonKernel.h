@@ -0,0 +1,200 @@
+#pragma once
+
+#include <juce_audio_basics/juce_audio_basics.h>
+#include "NeonAdaa.h"
+#include "NeonFastMath.h"
+#include "NeonMipmappedWavetable.h"
+#include <cmath>
+
+namespace neon
+{
+    /**
+     * UnisonKernel
+     * Renders one sample of a unison stack (up to 16 detuned copies of the same wavetable
+     * oscillator) in lanes: the caller keeps phases, increments and pan gains as flat
+     * arrays, and every stage below is a branch-free loop over them that the compiler
+     * packs 4 (SSE/NEON) or 8 (AVX) voices at a time. Only the table read is a scalar
+     * gather.
+     *
+     *     // control rate: per-voice increment and gains, unused lanes zeroed
+     *     auto levels = table.select (maxIncrement * UnisonKernel::getWarpFactor (symmetry));
+     *     UnisonKernel::render (phases, incs, gainsL, gainsR, count, levels, shape, shapers, left, right);
+     *
+     * All voices share one mipmap selection, picked for the fastest voice in the stack.
+     * With shape.antiAliasing set, drive, bit reduction and fold run through Adaa per lane
+     * (scalar, in double), which is where the stack spends its time when they are engaged.
+     */
+    struct UnisonKernel
+    {
+        static constexpr int maxVoices = 16;
+        static constexpr int laneWidth = 4;
+
+        struct Shape
+        {
+            float symmetry = 0.5f;
+            float drive = 0.0f;
+            float bitRedux = 0.0f;
+            float fold = 0.0f;
+            float volume = 1.0f;
+            Adaa::Order antiAliasing = Adaa::off;
+        };
+
+        /**
+         * What the anti-aliased shapers remember between samples; one per stack, reset with the phases.
+         * A stage only keeps its history while it runs, so the lanes it has kept current are counted:
+         * when a stage engages, or the stack grows past them, the new lanes start from the sample
+         * they are given instead of whatever that lane last saw.
+         */
+        struct ShaperHistory
+        {
+            Adaa::History drive[maxVoices], crush[maxVoices], fold[maxVoices];
+            int driveLanes = 0, crushLanes = 0, foldLanes = 0;
+
+            void reset() noexcept { *this = {}; }
+        };
+
+        /** Voice count rounded up to whole vectors; lanes past the real count must have zero gain. */
+        static int getPaddedCount (int numVoices) noexcept
+        {
+            return juce::jmin (maxVoices, (numVoices + laneWidth - 1) & ~(laneWidth - 1));
+        }
+
+        /** The squeezed half of a warped cycle plays faster: scale the increment by this before select(). */
+        static float getWarpFactor (float symmetry) noexcept
+        {
+            float s = juce::jlimit (0.01f, 0.99f, symmetry);
+            return 0.5f / juce::jmin (s, 1.0f - s);
+        }
+
+        /**
+         * Selection is MipmappedWavetable::Selection or WavetableFamily<>::Selection (anything with readLanes).
+         * With Shaping false the drive, bit reduction and fold stages are compiled out.
+         */
+        template <bool Shaping = true, typename Selection>
+        static void render (float* phases, const float* incs, const float* gainsL, const float* gainsR,
+                            int numVoices, const Selection& levels, const Shape& shape,
+                            ShaperHistory& history, float& outL, float& outR) noexcept
+        {
+            constexpr int tableSize = MipmappedWavetable::tableSize;
+            const int n = getPaddedCount (numVoices);
+
+            alignas (32) float pos[maxVoices];
+            alignas (32) float val[maxVoices];
+
+            // 1. Symmetry warp, straight to a table position
+            const float s = juce::jlimit (0.01f, 0.99f, shape.symmetry);
+            const float riseScale = 0.5f * (float)tableSize / s;
+            const float fallScale = 0.5f * (float)tableSize / (1.0f - s);
+            const float half = 0.5f * (float)tableSize;
+
+            for (int i = 0; i < n; ++i)
+            {
+                const float p = phases[i];
+                pos[i] = p < s ? p * riseScale : half + (p - s) * fallScale;
+            }
+
+            // 2. Table read (gather)
+            levels.readLanes (pos, val, n);
+
+            // 3. Shaping (same settings for the whole stack, so the branches sit outside the lanes)
+            if constexpr (Shaping)
+                applyShaping (shape, history, val, n);
+
+            // 4. Advance phases
+            for (int i = 0; i < n; ++i)
+            {
+                const float p = phases[i] + incs[i];
+                phases[i] = p >= 1.0f ? p - 1.0f : p;
+            }
+
+            // 5. Pan and sum, one partial sum per lane so the adds stay vectorised
+            float sumL[laneWidth] = {}, sumR[laneWidth] = {};
+            for (int i = 0; i < n; i += laneWidth)
+            {
+                for (int l = 0; l < laneWidth; ++l)
+                {
+                    sumL[l] += val[i + l] * gainsL[i + l];
+                    sumR[l] += val[i + l] * gainsR[i + l];
+                }
+            }
+
+            outL = (sumL[0] + sumL[1] + sumL[2] + sumL[3]) * shape.volume;
+            outR = (sumR[0] + sumR[1] + sumR[2] + sumR[3]) * shape.volume;
+        }
+
+    private:
+        /** Seeds lanes [current, n) with the input they are about to see, so their first step is plain f (x). */
+        static void prime (Adaa::History* history, int& current, const float* input, float gain, int n) noexcept
+        {
+            for (int i = current; i < n; ++i)
+                history[i].x1 = history[i].x2 = (double)(input[i] * gain);
+
+            current = n;
+        }
+
+        static void applyShaping (const Shape& shape, ShaperHistory& history, float* val, int n) noexcept
+        {
+            const auto order = shape.antiAliasing;
+
+            // Lanes above the count, or stages that sit out this sample, lose their history
+            const bool drive = shape.drive > 0.01f, crush = shape.bitRedux > 0.05f, fold = shape.fold > 0.01f;
+            const bool adaa = order != Adaa::off;
+            history.driveLanes = adaa && drive ? juce::jmin (history.driveLanes, n) : 0;
+            history.crushLanes = adaa && crush ? juce::jmin (history.crushLanes, n) : 0;
+            history.foldLanes = adaa && fold ? juce::jmin (history.foldLanes, n) : 0;
+
+            if (drive)
+            {
+                const float gain = 1.0f + shape.drive * 4.0f;
+                if (! adaa)
+                {
+                    for (int i = 0; i < n; ++i)
+                        val[i] = fastmath::softClip (val[i] * gain);
+                }
+                else
+                {
+                    prime (history.drive, history.driveLanes, val, gain, n);
+                    for (int i = 0; i < n; ++i)
+                        val[i] = Adaa::process (Adaa::SoftClip(), order, history.drive[i], val[i] * gain);
+                }
+            }
+
+            if (crush)
+            {
+                const float steps = juce::jmap (1.0f - shape.bitRedux, 2.0f, 32.0f);
+                if (! adaa)
+                {
+                    const float invSteps = 1.0f / steps;
+                    for (int i = 0; i < n; ++i)
+                        val[i] = std::floor (val[i] * steps + 0.5f) * invSteps;
+                }
+                else
+                {
+                    prime (history.crush, history.crushLanes, val, 1.0f, n);
+                    const Adaa::Quantize quantize { steps };
+                    for (int i = 0; i < n; ++i)
+                        val[i] = Adaa::process (quantize, order, history.crush[i], val[i]);
+                }
+            }
+
+            if (fold)
+            {
+                const float gain = 1.0f + shape.fold * 3.0f;
+                if (! adaa)
+                {
+                    for (int i = 0; i < n; ++i)
+                    {
+                        const float x = val[i] * gain;
+                        val[i] = x > 1.0f ? 2.0f - x : (x < -1.0f ? -2.0f - x : x);
+                    }
+                }
+                else
+                {
+                    prime (history.fold, history.foldLanes, val, gain, n);
+                    for (int i = 0; i < n; ++i)
+                        val[i] = Adaa::process (Adaa::Fold(), order, history.fold[i], val[i] * gain);
+                }
+            }
+        }
+    };
+}
@@ -0,0 +1,234 @@
+#pragma once
+
+#include <juce_audio_basics/juce_audio_basics.h>
+#include "NeonCpuGovernor.h"
+#include "NeonFastMath.h"
+#include "NeonLfo.h"
+#include <array>
+#include <cmath>
+#include <cstdint>
+#include <utility>
+
+namespace neon
+{
+    /**
+     * VoiceEngine
+     * The per-voice render loop of the subtractive engines: envelopes, control-rate
+     * modulation, glide, sub and noise, the ladder filter and the amp. The oscillator section,
+     * which is what tells the synths apart, comes in as a policy. The features a voice uses
+     * are resolved once per block and dispatched to a loop specialised for them, so a patch
+     * without glide, sub, noise, shaping or filter saturation never tests for them per sample:
+     *
+     *     VoiceEngine::Block block = getVoiceBlock();              // shared values, latched per block
+     *     const WavetableOscillators oscillators { ... };         // the engine's policy, per block
+     *     VoiceEngine::render (oscillators, voice, block, left, right, numSamples);
+     *
+     * An oscillator policy provides:
+     *
+     *     using Target = ModTarget;                               // with Osc1Pitch, SubLevel, SubPitch, FilterCutoff, FilterRes
+     *     static constexpr float mixGain;                         // oscillators + sub + noise into the filter
+     *     bool isShaping() const;                                 // drive / fold / crush may be engaged this block
+     *     void applyPitchBend (Voice&, float semitones) const;    // seeds the pitch targets before routing
+     *     void routeModulation (const float* sources, float* mods) const;
+     *     void setFrequency (Voice&, float hz) const;             // where glide lands
+     *     template <bool Shaping>
+     *     void render (Voice&, int sample, float pitchEnv, float& left, float& right) const;
+     *     float renderSub (Voice&, float level) const;
+     *
+     * Modulation sources are the mod envelope and the two LFOs, in that order. The voice is
+     * the engine's own struct; it needs the envelopes, LFOs, filter, mods and glide state the
+     * two engines already share. Policies are const and shared by every voice of the block,
+     * so voices can render on several threads.
+     */
+    struct VoiceEngine
+    {
+        /** What the voices share for one block. */
+        struct Block
+        {
+            double sampleRate = 44100.0;
+            int controlInterval = 8;
+            uint32_t degradations = 0;
+            const Lfo::Settings* lfoClocks = nullptr; // LFO 1 and 2
+
+            float pitchBend = 0.0f; // semitones
+            bool portaOn = false;
+            float portaTime = 100.0f; // ms
+
+            float subLevel = 0.0f;
+            bool subModulated = false; // a route targets the sub level, so it may open from zero
+            float noiseVolume = 0.0f;
+
+            float filterCutoff = 20000.0f;
+            float filterRes = 0.0f;
+            float filterDrive = 1.0f;
+            float filterKeyTrack = 0.5f;
+            float filterVelocity = 0.0f;
+            float filterAftertouch = 0.0f;
+            float filterEnvAmount = 0.0f;
+            float filterEnvVelocity = 0.0f;
+            float filterEnvAftertouch = 0.0f;
+
+            float ampLevel = 0.8f;
+            float ampVelocity = 0.5f;
+            float ampAftertouch = 0.0f;
+        };
+
+        enum Feature : uint32_t
+        {
+            glide      = 1 << 0,
+            sub        = 1 << 1,
+            noise      = 1 << 2,
+            shaping    = 1 << 3,
+            saturation = 1 << 4
+        };
+
+        template <typename Oscillators, typename Voice>
+        static void render (const Oscillators& oscillators, Voice& v, const Block& block, float* outL, float* outR, int numSamples)
+        {
+            // Governor state is read once per block so every voice renders at the same level
+            const bool saturate = block.filterDrive > 1.1f && (block.degradations & CpuGovernor::optionalStagesOff) == 0;
+
+            // Drive pushes the ladder's feedback into its soft clipper (aggressive gain multiplier)
+            v.filter.setDrive (1.0f + (block.filterDrive - 1.0f) * 3.0f, saturate);
+
+            // Glide targets only move on note events, which end the block
+            uint32_t features = 0;
+            if (block.portaOn && v.currentGlideFreq != v.targetFrequency)  features |= glide;
+            if (block.subLevel > 0.0001f || block.subModulated)             features |= sub;
+            if (block.noiseVolume > 0.0001f)                                features |= noise;
+            if (oscillators.isShaping())                                    features |= shaping;
+            if (saturate)                                                   features |= saturation;
+
+            static constexpr auto loops = makeLoops<Oscillators, Voice> (std::make_index_sequence<numVariants>());
+            loops[features] (oscillators, v, block, outL, outR, numSamples);
+        }
+
+    private:
+        static constexpr size_t numVariants = 1 << 5;
+
+        template <typename Oscillators, typename Voice>
+        using Loop = void (*) (const Oscillators&, Voice&, const Block&, float*, float*, int);
+
+        template <typename Oscillators, typename Voice, size_t... Features>
+        static constexpr auto makeLoops (std::index_sequence<Features...>)
+        {
+            return std::array<Loop<Oscillators, Voice>, sizeof... (Features)> { &renderLoop<(uint32_t)Features, Oscillators, Voice>... };
+        }
+
+        template <uint32_t Features, typename Oscillators, typename Voice>
+        static void renderLoop (const Oscillators& oscillators, Voice& v, const Block& block, float* outL, float* outR, int numSamples)
+        {
+            using Target = typename Oscillators::Target;
+
+            const int interval = block.controlInterval;
+            const float nyquistLimit = (float)block.sampleRate * 0.45f;
+
+            // A released voice below -48 dB is not worth its CPU under load; otherwise the floor never triggers
+            const float stealFloor = v.releasing && (block.degradations & CpuGovernor::stealQuietReleases) != 0 ? 0.004f : -1.0f;
+
+            // Linear glide, at least 1 ms long
+            const float glideRate = 1.0f / ((juce::jmax (1.0f, block.portaTime) / 1000.0f) * (float)block.sampleRate);
+
+            const float midInOctaves = std::log2 (juce::jlimit (20.0f, nyquistLimit, block.filterCutoff) / 20.0f);
+            const float kTrackOctaves = ((v.midiNote - 60.0f) / 12.0f) * block.filterKeyTrack;
+
+            // Velocity and aftertouch are fixed for the block
+            const float velocityMod = (v.velocity - 0.5f) * 2.0f * block.filterVelocity * 3.0f; // +-3 octaves max
+            const float aftertouchMod = v.aftertouch * block.filterAftertouch * 3.0f;           // +3 octaves max
+            const float scaledFilterEnvAmt = block.filterEnvAmount * (1.0f + v.velocity * block.filterEnvVelocity + v.aftertouch * block.filterEnvAftertouch);
+
+            const float velocityGain = 1.0f + (v.velocity - 1.0f) * block.ampVelocity;
+            const float aftertouchGain = 1.0f + v.aftertouch * block.ampAftertouch;
+            const float ampScale = velocityGain * aftertouchGain * block.ampLevel;
+
+            for (int s = 0; s < numSamples; ++s)
+            {
+                const float envA = v.ampEnv.getNextSample();
+                const float envF = v.filterEnv.getNextSample();
+                const float envP = v.pitchEnv.getNextSample();
+                const float rawMod = v.modEnv.getNextSample();
+
+                // Voice lifecycle: stay active as long as the Amp or Filter envelopes are running
+                if ((envA < 0.00001f && ! v.ampEnv.isActive() && ! v.filterEnv.isActive()) || envA < stealFloor)
+                {
+                    v.isActive.store (false);
+                    break;
+                }
+
+                // Modulation and filter coefficients only move every control interval
+                const bool controlTick = v.decimationCounter++ % interval == 0;
+
+                if (controlTick)
+                {
+                    v.mods.fill (0.0f);
+                    oscillators.applyPitchBend (v, block.pitchBend);
+
+                    const float sources[] = { rawMod,
+                                              v.lfos[0].advance (block.lfoClocks[0], interval),
+                                              v.lfos[1].advance (block.lfoClocks[1], interval) };
+                    oscillators.routeModulation (sources, v.mods.data());
+                }
+
+                if constexpr ((Features & glide) != 0)
+                {
+                    if (v.currentGlideFreq != v.targetFrequency)
+                    {
+                        const float diff = v.targetFrequency - v.currentGlideFreq;
+                        v.currentGlideFreq += diff * glideRate;
+
+                        // Snap to target if very close
+                        if (std::abs (diff) < 0.01f)
+                            v.currentGlideFreq = v.targetFrequency;
+
+                        oscillators.setFrequency (v, v.currentGlideFreq);
+                    }
+                }
+
+                // 1. Oscillators, sub and noise
+                float oscL = 0.0f, oscR = 0.0f;
+                oscillators.template render<(Features & shaping) != 0> (v, s, envP, oscL, oscR);
+
+                float extra = 0.0f;
+
+                if constexpr ((Features & sub) != 0)
+                {
+                    const float level = juce::jlimit (0.0f, 1.0f, block.subLevel + v.mod (Target::SubLevel));
+                    if (level > 0.0001f)
+                        extra += oscillators.renderSub (v, level);
+                }
+
+                if constexpr ((Features & noise) != 0)
+                {
+                    // XORshift32, ultra-cheap
+                    v.noiseState ^= v.noiseState << 13;
+                    v.noiseState ^= v.noiseState >> 17;
+                    v.noiseState ^= v.noiseState << 5;
+                    extra += (float)(int)v.noiseState * (1.0f / 2147483648.0f) * block.noiseVolume;
+                }
+
+                float frame[] = { (oscL + extra) * Oscillators::mixGain, (oscR + extra) * Oscillators::mixGain };
+
+                // 2. Filter (ZDF ladder, both channels in one pass)
+                if (controlTick)
+                {
+                    const float totalOctaves = midInOctaves + kTrackOctaves + (envF * scaledFilterEnvAmt / 10.0f)
+                                             + (v.mod (Target::FilterCutoff) * 5.0f) + velocityMod + aftertouchMod;
+                    const float modulatedHz = juce::jlimit (20.0f, nyquistLimit, 20.0f * fastmath::exp2 (totalOctaves));
+
+                    if (std::isfinite (modulatedHz))
+                    {
+                        v.filter.setCutoff (modulatedHz);
+                        v.filter.setResonance (block.filterRes + v.mod (Target::FilterRes));
+                    }
+                }
+
+                v.filter.template process<(Features & saturation) != 0> (frame);
+
+                // 3. Amp
+                const float ampGain = envA * ampScale;
+                outL[s] = frame[0] * ampGain;
+                outR[s] = frame[1] * ampGain;
+            }
+        }
+    };
+}
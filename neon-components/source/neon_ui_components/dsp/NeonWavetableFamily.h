@@ -0,0 +1,226 @@
+#pragma once
+
+#include <juce_audio_basics/juce_audio_basics.h>
+#include "NeonMipmappedWavetable.h"
+#include <cmath>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace neon
+{
+    /**
+     * WavetableFamily
+     * The numbered frames of one wavetable ("Aura 1" .. "Aura 8") in a single allocation, laid
+     * out level by level: every frame of a mipmap level sits next to the others, so a voice
+     * scanning across frames at a given pitch reads one small contiguous block that all
+     * voices of the engine share. Sample may be float or int16_t; 16-bit storage is scaled
+     * to the family's peak and halves the footprint again.
+     *
+     * select() takes a fractional frame position and returns the two mipmap levels of the
+     * two neighbouring frames; reads crossfade both ways, so a modulated scan morphs
+     * smoothly instead of stepping from table to table:
+     *
+     *     WavetableFamily<int16_t> family (frames);                 // MipmappedWavetable per frame
+     *     auto levels = family.select (phaseInc, 2.4f);              // 40% of the way from frame 2 to 3
+     *     UnisonKernel::render (..., levels, ...);
+     */
+    template <typename Sample>
+    class WavetableFamily
+    {
+    public:
+        static_assert (std::is_same_v<Sample, float> || std::is_same_v<Sample, int16_t>, "float or 16-bit frames");
+
+        static constexpr int tableSize = MipmappedWavetable::tableSize;
+        static constexpr int numLevels = MipmappedWavetable::numLevels;
+
+        explicit WavetableFamily (const std::vector<const MipmappedWavetable*>& frames)
+            : numFrames (juce::jmax (1, (int)frames.size())),
+              samples ((size_t)(numLevels * numFrames * stride), Sample {})
+        {
+            if (frames.empty())
+                return;
+
+            if constexpr (std::is_same_v<Sample, int16_t>)
+            {
+                float peak = 1.0e-6f;
+                for (auto* frame : frames)
+                    for (int level = 0; level < numLevels; ++level)
+                        for (int i = 0; i < stride; ++i)
+                            peak = juce::jmax (peak, std::abs (frame->getLevel (level)[i]));
+
+                gain = peak / 32767.0f;
+            }
+
+            for (int level = 0; level < numLevels; ++level)
+            {
+                for (int f = 0; f < numFrames; ++f)
+                {
+                    const float* source = frames[(size_t)f]->getLevel (level);
+                    Sample* dest = samples.data() + offsetOf (level, f);
+
+                    for (int i = 0; i < stride; ++i)
+                    {
+                        if constexpr (std::is_same_v<Sample, int16_t>)
+                            dest[i] = (int16_t)juce::roundToInt (source[i] / gain);
+                        else
+                            dest[i] = source[i];
+                    }
+                }
+            }
+        }
+
+        int getNumFrames() const noexcept { return numFrames; }
+
+        struct Selection
+        {
+            const Sample* lowerA = nullptr; // frame below the position, lower / upper level
+            const Sample* lowerB = nullptr; // frame above it
+            const Sample* upperA = nullptr;
+            const Sample* upperB = nullptr;
+            float frameMix = 0.0f;
+            float levelMix = 0.0f;
+            float gain = 1.0f;
+            bool cubic = false; // 4-point Hermite between samples instead of linear (RenderQuality)
+
+            /** Reads n table positions (0 .. tableSize) at once, for UnisonKernel. */
+            void readLanes (const float* pos, float* out, int n) const noexcept
+            {
+                if (cubic)
+                    readLevels<true> (pos, out, n);
+                else
+                    readLevels<false> (pos, out, n);
+            }
+
+            /** Single read at phase [0, 1), e.g. for a preview. */
+            float read (double phase) const noexcept
+            {
+                const float pos = (float)(phase * tableSize);
+                float out;
+                readLanes (&pos, &out, 1);
+                return out;
+            }
+
+        private:
+            static constexpr int maxLanes = 16;
+
+            template <bool Cubic>
+            void readLevels (const float* pos, float* out, int n) const noexcept
+            {
+                auto level = [&] (const Sample* a, const Sample* b, float* dest) {
+                    if constexpr (Cubic)
+                        readLevelCubic (a, b, pos, dest, n);
+                    else
+                        readLevel (a, b, pos, dest, n);
+                };
+
+                level (lowerA, lowerB, out);
+
+                if (levelMix > 0.0f)
+                {
+                    alignas (32) float upper[maxLanes];
+                    level (upperA, upperB, upper);
+                    for (int i = 0; i < n; ++i)
+                        out[i] += (upper[i] - out[i]) * levelMix;
+                }
+            }
+
+            void readLevel (const Sample* a, const Sample* b, const float* pos, float* out, int n) const noexcept
+            {
+                // Gather the four neighbours of every lane (scalar), then blend them in lanes
+                alignas (32) float a0[maxLanes], a1[maxLanes], b0[maxLanes], b1[maxLanes], frac[maxLanes];
+
+                for (int i = 0; i < n; ++i)
+                {
+                    const int idx = juce::jlimit (0, tableSize - 1, (int)pos[i]);
+                    frac[i] = pos[i] - (float)idx;
+                    a0[i] = (float)a[idx];
+                    a1[i] = (float)a[idx + 1];
+                }
+
+                if (frameMix > 0.0f)
+                {
+                    for (int i = 0; i < n; ++i)
+                    {
+                        const int idx = juce::jlimit (0, tableSize - 1, (int)pos[i]);
+                        b0[i] = (float)b[idx];
+                        b1[i] = (float)b[idx + 1];
+                    }
+
+                    const float m = frameMix;
+                    for (int i = 0; i < n; ++i)
+                    {
+                        a0[i] += (b0[i] - a0[i]) * m;
+                        a1[i] += (b1[i] - a1[i]) * m;
+                    }
+                }
+
+                const float g = gain;
+                for (int i = 0; i < n; ++i)
+                    out[i] = (a0[i] + (a1[i] - a0[i]) * frac[i]) * g;
+            }
+
+            void readLevelCubic (const Sample* a, const Sample* b, const float* pos, float* out, int n) const noexcept
+            {
+                // Four taps per lane, the outer two wrapping round the cycle; frames blend tap by tap
+                constexpr int mask = tableSize - 1;
+                const float m = frameMix;
+                const float g = gain;
+
+                for (int i = 0; i < n; ++i)
+                {
+                    const int idx = juce::jlimit (0, tableSize - 1, (int)pos[i]);
+                    const float t = pos[i] - (float)idx;
+                    const int taps[] = { (idx - 1) & mask, idx, idx + 1, (idx + 2) & mask };
+
+                    float x[4];
+                    for (int k = 0; k < 4; ++k)
+                    {
+                        x[k] = (float)a[taps[k]];
+                        if (m > 0.0f)
+                            x[k] += ((float)b[taps[k]] - x[k]) * m;
+                    }
+
+                    const float c1 = 0.5f * (x[2] - x[0]);
+                    const float c2 = x[0] - 2.5f * x[1] + 2.0f * x[2] - 0.5f * x[3];
+                    const float c3 = 0.5f * (x[3] - x[0]) + 1.5f * (x[1] - x[2]);
+                    out[i] = (((c3 * t + c2) * t + c1) * t + x[1]) * g;
+                }
+            }
+        };
+
+        /** Levels for a phase increment in cycles per sample, at a frame position 0 .. numFrames - 1. */
+        Selection select (double phaseIncrement, float framePosition) const noexcept
+        {
+            const float position = juce::jlimit (0.0f, (float)(numFrames - 1), framePosition);
+            const int frameA = juce::jmin ((int)position, numFrames - 1);
+            const int frameB = juce::jmin (frameA + 1, numFrames - 1);
+
+            float levelMix = 0.0f;
+            const int level = MipmappedWavetable::chooseLevel (phaseIncrement, levelMix);
+            const int upperLevel = juce::jmin (level + 1, numLevels - 1);
+
+            Selection s;
+            s.lowerA = samples.data() + offsetOf (level, frameA);
+            s.lowerB = samples.data() + offsetOf (level, frameB);
+            s.upperA = samples.data() + offsetOf (upperLevel, frameA);
+            s.upperB = samples.data() + offsetOf (upperLevel, frameB);
+            s.frameMix = frameB != frameA ? position - (float)frameA : 0.0f;
+            s.levelMix = levelMix;
+            s.gain = gain;
+            return s;
+        }
+
+    private:
+        static constexpr int stride = tableSize + 1; // with the guard sample
+
+        size_t offsetOf (int level, int frame) const noexcept
+        {
+            return (size_t)((level * numFrames + frame) * stride);
+        }
+
+        int numFrames;
+        float gain = 1.0f;
+        std::vector<Sample> samples;
+    };
+}
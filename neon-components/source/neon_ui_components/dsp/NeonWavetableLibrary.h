@@ -0,0 +1,475 @@
+#pragma once
+
+#include <juce_audio_formats/juce_audio_formats.h>
+#include "NeonWavetableFamily.h"
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <vector>
+
+namespace neon
+{
+    /**
+     * WavetableLibrary
+     * User wavetables from a folder (PatchManager::getWavetableDirectory()). A background
+     * thread watches it, decodes new or changed files, normalises them, slices them into
+     * frames (Serum-style "clm " frame size, else 2048-sample frames, else one cycle per
+     * file) and builds the band-limited WavetableFamily. Finished sets are published as
+     * immutable snapshots; nothing on the message or audio thread ever waits for a decode.
+     *
+     * Every file keeps the ID it was first given (stored next to the tables in ids.txt), so
+     * a patch can store the ID and find the same table after the library changes:
+     *
+     *     auto library = WavetableLibrary::getShared (patchManager.getWavetableDirectory());
+     *     WavetableLibrary::Reader reader (library);                   // one per engine
+     *     const auto& tables = reader.acquire();                       // audio thread, per block
+     *     if (auto* family = tables.find (userTableId)) ...
+     *
+     * One library (and one thread) per folder, shared by every instance that uses it.
+     * When all 255 IDs are taken, a new file takes over the ID of the file that has been
+     * missing longest (gone for at least one full scan); files that still find no ID are
+     * listed by getStatus() for the editor to show.
+     */
+    class WavetableLibrary : private juce::Thread
+    {
+    public:
+        using Family = WavetableFamily<int16_t>;
+
+        static constexpr int maxTables = 256;    // IDs 1 .. 255; 0 means "no user table"
+        static constexpr int defaultFrameSize = 2048;
+        static constexpr int maxFrames = 256;
+
+        struct Table
+        {
+            Table (int tableId, const juce::String& tableName, Family&& frames)
+                : id (tableId), name (tableName), family (std::move (frames)) {}
+
+            int id;
+            juce::String name;
+            Family family;
+        };
+
+        /** Everything the audio thread can see at one moment; immutable once published. */
+        struct Snapshot
+        {
+            std::array<std::shared_ptr<const Table>, (size_t)maxTables> tables; // indexed by ID
+
+            const Family* find (int id) const noexcept
+            {
+                if (! juce::isPositiveAndBelow (id, maxTables) || tables[(size_t)id] == nullptr)
+                    return nullptr;
+
+                return &tables[(size_t)id]->family;
+            }
+        };
+
+        /**
+         * One engine's lock-free view of the library. The worker hands each new snapshot
+         * over through a triple buffer (as PatchLoader does); the audio thread swaps it in
+         * with one atomic exchange and never releases the last reference to anything.
+         */
+        class Reader
+        {
+        public:
+            explicit Reader (std::shared_ptr<WavetableLibrary> sharedLibrary)
+                : library (std::move (sharedLibrary))
+            {
+                library->addReader (*this);
+            }
+
+            ~Reader() { library->removeReader (*this); }
+
+            /** Audio thread, once per block: the newest snapshot; valid until the next call. */
+            const Snapshot& acquire() noexcept
+            {
+                if ((sharedIndex.load (std::memory_order_acquire) & freshBit) != 0)
+                    frontIndex = sharedIndex.exchange (frontIndex, std::memory_order_acq_rel) & indexMask;
+
+                return *slots[(size_t)frontIndex];
+            }
+
+            WavetableLibrary& getLibrary() const noexcept { return *library; }
+
+        private:
+            friend class WavetableLibrary;
+
+            // Worker thread (under the library lock)
+            void publish (const std::shared_ptr<const Snapshot>& snapshot)
+            {
+                slots[(size_t)backIndex] = snapshot; // whatever the slot held is released here, not on the audio thread
+                backIndex = sharedIndex.exchange (backIndex | freshBit, std::memory_order_acq_rel) & indexMask;
+            }
+
+            static constexpr int indexMask = 3;
+            static constexpr int freshBit = 4;
+
+            std::shared_ptr<WavetableLibrary> library;
+            std::array<std::shared_ptr<const Snapshot>, 3> slots;
+            std::atomic<int> sharedIndex { 1 };
+            int backIndex = 0;   // worker
+            int frontIndex = 2;  // audio thread
+
+            JUCE_DECLARE_NON_COPYABLE (Reader)
+        };
+
+        explicit WavetableLibrary (const juce::File& folderToWatch)
+            : juce::Thread ("Neon Wavetable Library"), folder (folderToWatch),
+              current (std::make_shared<const Snapshot>())
+        {
+            formats.registerBasicFormats();
+            startThread();
+        }
+
+        ~WavetableLibrary() override { stopThread (4000); }
+
+        static std::shared_ptr<WavetableLibrary> getShared (const juce::File& folder)
+        {
+            static std::mutex lock;
+            static std::map<juce::String, std::weak_ptr<WavetableLibrary>> cache;
+
+            const std::lock_guard<std::mutex> scopedLock (lock);
+            auto& entry = cache[folder.getFullPathName()];
+            auto shared = entry.lock();
+            if (shared == nullptr)
+            {
+                shared = std::make_shared<WavetableLibrary> (folder);
+                entry = shared;
+            }
+            return shared;
+        }
+
+        // -------- Message thread --------
+
+        /** Picks up changes now instead of at the next poll. */
+        void rescan() { notify(); }
+
+        /** Bumped whenever a new snapshot or status is published, so the UI knows to refresh. */
+        int getGeneration() const noexcept { return generation.load(); }
+
+        /** Display names indexed by ID ("OFF" at 0, "-" where no table is loaded). */
+        std::vector<juce::String> getChoiceNames() const
+        {
+            std::shared_ptr<const Snapshot> snapshot;
+            {
+                const std::lock_guard<std::mutex> sl (lock);
+                snapshot = current;
+            }
+            return getChoiceNames (snapshot.get());
+        }
+
+        /** Files the last scan could not give an ID to, for display; empty when all loaded. */
+        juce::String getStatus() const
+        {
+            const std::lock_guard<std::mutex> sl (lock);
+            return status;
+        }
+
+        static std::vector<juce::String> getChoiceNames (const Snapshot* snapshot)
+        {
+            std::vector<juce::String> names { "OFF" };
+            for (int id = 1; id < maxTables; ++id)
+            {
+                auto table = snapshot != nullptr ? snapshot->tables[(size_t)id] : nullptr;
+                names.push_back (table != nullptr ? table->name : juce::String ("-"));
+            }
+            return names;
+        }
+
+    private:
+        struct CachedFile
+        {
+            juce::Time modified;
+            juce::int64 size = 0;
+            std::shared_ptr<const Table> table;
+        };
+
+        static constexpr int pollIntervalMs = 2000;
+
+        void run() override
+        {
+            while (! threadShouldExit())
+            {
+                scan();
+                wait (pollIntervalMs);
+            }
+        }
+
+        void addReader (Reader& reader)
+        {
+            const std::lock_guard<std::mutex> sl (lock);
+            for (auto& slot : reader.slots)
+                slot = current;
+            readers.push_back (&reader);
+        }
+
+        void removeReader (Reader& reader)
+        {
+            const std::lock_guard<std::mutex> sl (lock);
+            readers.erase (std::remove (readers.begin(), readers.end(), &reader), readers.end());
+        }
+
+        void scan()
+        {
+            if (! folder.isDirectory())
+                return;
+
+            loadIds();
+
+            auto files = folder.findChildFiles (juce::File::findFiles, true, "*.wav;*.aif;*.aiff;*.flac");
+            files.sort();
+
+            // Note which ID holders have gone, and since when, before handing out IDs
+            ++scanCount;
+            std::set<juce::String> keys;
+            for (auto& file : files)
+                keys.insert (getKey (file));
+
+            for (auto& [key, id] : ids)
+            {
+                if (keys.count (key) > 0)
+                    missingSince.erase (key);
+                else
+                    missingSince.try_emplace (key, scanCount);
+            }
+
+            auto next = std::make_shared<Snapshot>();
+            std::map<juce::String, CachedFile> stillPresent;
+            juce::StringArray skipped;
+            bool changed = false;
+
+            for (auto& file : files)
+            {
+                if (threadShouldExit())
+                    return;
+
+                const auto key = getKey (file);
+                const int id = getOrAssignId (key);
+                if (id == 0)
+                {
+                    skipped.add (key); // no free ID, and none held by a file gone long enough
+                    continue;
+                }
+
+                auto cached = cache.find (key);
+                CachedFile entry;
+                entry.modified = file.getLastModificationTime();
+                entry.size = file.getSize();
+
+                if (cached != cache.end() && cached->second.modified == entry.modified && cached->second.size == entry.size)
+                {
+                    entry.table = cached->second.table;
+                }
+                else
+                {
+                    entry.table = load (file, id);
+                    changed = true;
+                }
+
+                next->tables[(size_t)id] = entry.table;
+                stillPresent[key] = std::move (entry);
+            }
+
+            changed = changed || stillPresent.size() != cache.size();
+            cache = std::move (stillPresent);
+
+            if (idsChanged)
+                saveIds();
+
+            juce::String nextStatus;
+            if (! skipped.isEmpty())
+                nextStatus << skipped.size() << " skipped, all " << (maxTables - 1) << " IDs in use: " << skipped.joinIntoString (", ");
+
+            const std::lock_guard<std::mutex> sl (lock);
+            if (! changed && nextStatus == status)
+                return;
+
+            if (changed)
+            {
+                current = std::move (next);
+                for (auto* reader : readers)
+                    reader->publish (current);
+            }
+
+            status = nextStatus;
+            ++generation;
+        }
+
+        /** Decodes, normalises and slices one file; nullptr if it is not usable audio. */
+        std::shared_ptr<const Table> load (const juce::File& file, int id)
+        {
+            std::unique_ptr<juce::AudioFormatReader> reader (formats.createReaderFor (file));
+            if (reader == nullptr || reader->lengthInSamples <= 0)
+                return nullptr;
+
+            int frameSize = getSerumFrameSize (file);
+            const int maxLength = maxFrames * juce::jmax (frameSize, defaultFrameSize);
+            const int length = (int)juce::jmin ((juce::int64)maxLength, reader->lengthInSamples);
+
+            juce::AudioBuffer<float> buffer (1, length);
+            reader->read (&buffer, 0, length, 0, true, false);
+
+            // Without a frame size in the file: whole 2048-sample frames, else one single cycle
+            if (frameSize <= 0)
+                frameSize = length >= 2 * defaultFrameSize && length % defaultFrameSize == 0 ? defaultFrameSize : length;
+
+            const float peak = buffer.getMagnitude (0, 0, length);
+            if (peak > 1.0e-6f)
+                buffer.applyGain (1.0f / peak);
+
+            const int numFrames = juce::jlimit (1, maxFrames, length / frameSize);
+            std::vector<MipmappedWavetable> mipmaps;
+            mipmaps.reserve ((size_t)numFrames);
+            for (int f = 0; f < numFrames; ++f)
+                mipmaps.emplace_back (buffer.getReadPointer (0, f * frameSize), juce::jmin (frameSize, length));
+
+            std::vector<const MipmappedWavetable*> frames;
+            for (auto& m : mipmaps)
+                frames.push_back (&m);
+
+            return std::make_shared<const Table> (id, file.getFileNameWithoutExtension(), Family (frames));
+        }
+
+        /** Frame length from Serum's "clm " chunk ("<!>2048 ..."), or 0 if there is none. */
+        static int getSerumFrameSize (const juce::File& file)
+        {
+            juce::FileInputStream in (file);
+            char id[4] {};
+            if (! in.openedOk() || in.read (id, 4) != 4 || std::memcmp (id, "RIFF", 4) != 0)
+                return 0;
+
+            in.readInt();
+            if (in.read (id, 4) != 4 || std::memcmp (id, "WAVE", 4) != 0)
+                return 0;
+
+            while (! in.isExhausted())
+            {
+                if (in.read (id, 4) != 4)
+                    break;
+
+                const auto size = (juce::int64)(juce::uint32)in.readInt();
+                const auto next = in.getPosition() + size + (size & 1);
+
+                if (std::memcmp (id, "clm ", 4) == 0)
+                {
+                    juce::MemoryBlock text;
+                    in.readIntoMemoryBlock (text, (juce::ssize_t)juce::jmin ((juce::int64)64, size));
+                    auto clm = text.toString();
+                    if (clm.startsWith ("<!>"))
+                        return juce::jlimit (0, 1 << 16, clm.substring (3).getIntValue());
+                    return 0;
+                }
+
+                in.setPosition (next);
+            }
+
+            return 0;
+        }
+
+        // -------- Stable IDs: "<id>\t<path relative to the folder>" per line --------
+
+        juce::File getIdFile() const { return folder.getChildFile ("ids.txt"); }
+
+        juce::String getKey (const juce::File& file) const
+        {
+            return file.getRelativePathFrom (folder).replaceCharacter ('\\', '/');
+        }
+
+        void loadIds()
+        {
+            if (! ids.empty() || ! getIdFile().existsAsFile())
+                return;
+
+            juce::StringArray lines;
+            getIdFile().readLines (lines);
+            for (auto& line : lines)
+            {
+                const int id = line.upToFirstOccurrenceOf ("\t", false, false).getIntValue();
+                const auto key = line.fromFirstOccurrenceOf ("\t", false, false);
+                if (juce::isPositiveAndBelow (id, maxTables) && id > 0 && key.isNotEmpty())
+                    ids[key] = id;
+            }
+        }
+
+        void saveIds()
+        {
+            juce::String text;
+            for (auto& [key, id] : ids)
+                text << id << "\t" << key << "\n";
+
+            getIdFile().replaceWithText (text);
+            idsChanged = false;
+        }
+
+        /**
+         * The file's ID. New files get the lowest one never handed out before; once none
+         * is left, the ID of the file missing longest (lowest ID on a tie), provided it was
+         * already gone in an earlier scan. 0 if every ID belongs to a file still around.
+         */
+        int getOrAssignId (const juce::String& key)
+        {
+            auto it = ids.find (key);
+            if (it != ids.end())
+                return it->second;
+
+            std::array<bool, (size_t)maxTables> used {};
+            for (auto& [k, id] : ids)
+                used[(size_t)id] = true;
+
+            for (int id = 1; id < maxTables; ++id)
+            {
+                if (! used[(size_t)id])
+                {
+                    ids[key] = id;
+                    idsChanged = true;
+                    return id;
+                }
+            }
+
+            auto oldest = ids.end();
+            for (auto candidate = ids.begin(); candidate != ids.end(); ++candidate)
+            {
+                auto missing = missingSince.find (candidate->first);
+                if (missing == missingSince.end() || missing->second >= scanCount)
+                    continue;
+
+                if (oldest == ids.end()
+                    || std::make_pair (missing->second, candidate->second) < std::make_pair (missingSince[oldest->first], oldest->second))
+                    oldest = candidate;
+            }
+
+            if (oldest == ids.end())
+                return 0;
+
+            const int id = oldest->second;
+            missingSince.erase (oldest->first);
+            ids.erase (oldest);
+            ids[key] = id;
+            idsChanged = true;
+            return id;
+        }
+
+        const juce::File folder;
+        juce::AudioFormatManager formats;
+
+        // Worker thread only
+        std::map<juce::String, CachedFile> cache;
+        std::map<juce::String, int> ids;
+        std::map<juce::String, int> missingSince; // scan in which an ID holder was first found gone
+        int scanCount = 0;
+        bool idsChanged = false;
+
+        // Worker <-> readers and message thread
+        mutable std::mutex lock;
+        std::shared_ptr<const Snapshot> current;
+        std::vector<Reader*> readers;
+        juce::String status;
+        std::atomic<int> generation { 0 };
+
+        JUCE_DECLARE_NON_COPYABLE (WavetableLibrary)
+    };
+}
@@ -11,16 +11,20 @@ namespace neon
     class AdsrModule : public ModuleBase
     {
     public:
-        AdsrModule (const juce::String& name, const juce::Colour& color = juce::Colours::cyan) 
-            : ModuleBase (name, color)
+        AdsrModule (NeonInstance& instance, const juce::String& name, const juce::Colour& color = juce::Colours::cyan) 
+            : ModuleBase (instance, name, color)
         {
-            addParameter ("Attack",  0.0f, 10000.0f, 100.0f);
-            addParameter ("Decay",   0.0f, 10000.0f, 500.0f);
-            addParameter ("Sustain", 0.0f, 1.0f,     0.7f);
-            addParameter ("Release", 0.0f, 10000.0f, 1000.0f);
-            
+            addParameters (*this);
             lastAdjustedIndex = 0;
         }
+
+        static void addParameters (ParameterLayout& layout)
+        {
+            layout.addParameter ("Attack",  0.0f, 10000.0f, 100.0f);
+            layout.addParameter ("Decay",   0.0f, 10000.0f, 500.0f);
+            layout.addParameter ("Sustain", 0.0f, 1.0f,     0.7f);
+            layout.addParameter ("Release", 0.0f, 10000.0f, 1000.0f);
+        }
         
     protected:
         void paintVisualization (juce::Graphics& g, juce::Rectangle<int> area) override
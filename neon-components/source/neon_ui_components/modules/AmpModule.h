@@ -7,22 +7,26 @@ namespace neon
     class AmpModule : public ModuleBase
     {
     public:
-        AmpModule (const juce::String& name, const juce::Colour& color) 
-            : ModuleBase (name, color)
+        AmpModule (NeonInstance& instance, const juce::String& name, const juce::Colour& color) 
+            : ModuleBase (instance, name, color)
+        {
+            addParameters (*this);
+            lastAdjustedIndex = 0;
+        }
+
+        static void addParameters (ParameterLayout& layout)
         {
             // Row 1: Level, Velocity, Aftertouch, [Blank]
-            addParameter ("Level",  0.0f, 1.0f, 0.8f);
-            addParameter ("Velocity", 0.0f, 1.0f, 0.5f);
-            addParameter ("Aftertouch", 0.0f, 1.0f, 0.0f); // NEW: Amp aftertouch sensitivity
-            addSpacer(); // Blank
+            layout.addParameter ("Level",  0.0f, 1.0f, 0.8f);
+            layout.addParameter ("Velocity", 0.0f, 1.0f, 0.5f);
+            layout.addParameter ("Aftertouch", 0.0f, 1.0f, 0.0f); // NEW: Amp aftertouch sensitivity
+            layout.addSpacer(); // Blank
             
             // Row 2: [All Blank]
-            addSpacer();
-            addSpacer();
-            addSpacer();
-            addSpacer();
-            
-            lastAdjustedIndex = 0;
+            layout.addSpacer();
+            layout.addSpacer();
+            layout.addSpacer();
+            layout.addSpacer();
         }
 
     protected:
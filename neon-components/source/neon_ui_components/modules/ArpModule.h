@@ -7,25 +7,30 @@ namespace neon
     class ArpModule : public ModuleBase
     {
     public:
-        ArpModule (const juce::String& name, const juce::Colour& color) 
-            : ModuleBase (name, color)
+        ArpModule (NeonInstance& instance, const juce::String& name, const juce::Colour& color) 
+            : ModuleBase (instance, name, color)
         {
-            addParameter ("Arp On", 0.0f, 1.0f, 0.0f, true);
+            addParameters (*this);
+
+            moduleNameDisplay.setText("ARPEGGIATOR", juce::dontSendNotification);
+            lastAdjustedIndex = 2; // Start with Mode highlighted
+        }
+
+        static void addParameters (ParameterLayout& layout)
+        {
+            layout.addParameter ("Arp On", 0.0f, 1.0f, 0.0f, true);
 
             std::vector<juce::String> divisions = { 
                 "1/64", "1/32", "1/16", "1/8", "1/4", "1/2", "1/1", "2/1", "4/1" 
             };
-            addChoiceParameter ("Rate Note", divisions, 2); // Default 1/16
+            layout.addChoiceParameter ("Rate Note", divisions, 2); // Default 1/16
 
             std::vector<juce::String> modes = { "UP", "DOWN", "UP/DOWN", "RANDOM" };
-            addChoiceParameter ("Mode", modes, 0);
+            layout.addChoiceParameter ("Mode", modes, 0);
 
-            addParameter ("Octave", 1.0f, 4.0f, 1.0f, false, 1.0f, false, true);
-            addParameter ("Gate", 1.0f, 100.0f, 80.0f, false, 1.0f, false, true);
-            addParameter ("Latch", 0.0f, 1.0f, 0.0f, true);
-            
-            moduleNameDisplay.setText("ARPEGGIATOR", juce::dontSendNotification);
-            lastAdjustedIndex = 2; // Start with Mode highlighted
+            layout.addParameter ("Octave", 1.0f, 4.0f, 1.0f, false, 1.0f, false, true);
+            layout.addParameter ("Gate", 1.0f, 100.0f, 80.0f, false, 1.0f, false, true);
+            layout.addParameter ("Latch", 0.0f, 1.0f, 0.0f, true);
         }
 
         void paintVisualization (juce::Graphics& g, juce::Rectangle<int> area) override
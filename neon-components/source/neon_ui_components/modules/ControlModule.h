@@ -1,6 +1,7 @@
 #pragma once
 
 #include "ModuleBase.h"
+#include "../dsp/NeonRenderQuality.h"
 
 namespace neon
 {
@@ -11,25 +12,41 @@ namespace neon
     class ControlModule : public ModuleBase
     {
     public:
-        ControlModule (const juce::String& name, const juce::Colour& color) 
-            : ModuleBase (name, color)
+        ControlModule (NeonInstance& instance, const juce::String& name, const juce::Colour& color, bool withCpuBudget = false, bool withQuality = false)
+            : ModuleBase (instance, name, color), showsCpu (withCpuBudget)
+        {
+            addParameters (*this, withCpuBudget, withQuality);
+            moduleNameDisplay.setText("GLOBAL CONTROLS", juce::dontSendNotification);
+        }
+
+        static void addParameters (ParameterLayout& layout, bool withCpuBudget = false, bool withQuality = false)
         {
             // Row 1: PB Range, Mode, Tempo, Tempo Sync
-            addParameter ("PB Range", 0.0f, 24.0f, 2.0f, false, 1.0f);
-            addChoiceParameter ("Mode", {"POLY", "MONO"}, 0);
-            addParameter ("Tempo", 20.0f, 300.0f, 120.0f, false, 0.0f, false, true);
-            addParameter ("Tempo Sync", 0.0f, 1.0f, 1.0f, true);
-            if (auto* p = parameters.back()) p->setBinaryLabels ("SELF", "HOST");
+            layout.addParameter ("PB Range", 0.0f, 24.0f, 2.0f, false, 1.0f);
+            layout.addChoiceParameter ("Mode", {"POLY", "MONO"}, 0);
+            layout.addParameter ("Tempo", 20.0f, 300.0f, 120.0f, false, 0.0f, false, true);
+            if (auto* p = layout.addParameter ("Tempo Sync", 0.0f, 1.0f, 1.0f, true))
+                p->setBinaryLabels ("SELF", "HOST");
 
-            // Row 2: Porta On, Porta Time, Porta Time/Rate, [Blank]
-            addParameter ("Porta On", 0.0f, 1.0f, 0.0f, true); // NEW: Portamento on/off
-            if (auto* p = parameters.back()) p->setBinaryLabels ("OFF", "ON");
-            addParameter ("Porta Time", 0.0f, 5000.0f, 100.0f); // NEW: Portamento time in ms
-            addParameter ("Porta Mode", 0.0f, 1.0f, 0.0f, true); // NEW: Time vs Rate mode
-            if (auto* p = parameters.back()) p->setBinaryLabels ("TIME", "RATE");
-            addSpacer(); // Blank
+            // Row 2: Porta On, Porta Time, Porta Time/Rate, [CPU Budget]
+            if (auto* p = layout.addParameter ("Porta On", 0.0f, 1.0f, 0.0f, true)) // NEW: Portamento on/off
+                p->setBinaryLabels ("OFF", "ON");
+            layout.addParameter ("Porta Time", 0.0f, 5000.0f, 100.0f); // NEW: Portamento time in ms
+            if (auto* p = layout.addParameter ("Porta Mode", 0.0f, 1.0f, 0.0f, true)) // NEW: Time vs Rate mode
+                p->setBinaryLabels ("TIME", "RATE");
+            if (withCpuBudget)
+                layout.addParameter ("CPU Budget", 10.0f, 100.0f, 80.0f, false, 1.0f); // % of the audio deadline, see CpuGovernor
+            else
+                layout.addSpacer(); // Blank
 
-            moduleNameDisplay.setText("GLOBAL CONTROLS", juce::dontSendNotification);
+            // PAGE 2: Row 1: Quality, [Blank], [Blank], [Blank]
+            if (withQuality)
+            {
+                layout.addChoiceParameter ("Quality", RenderQuality::getNames(), RenderQuality::realtime); // bounces always render at OFFLINE
+                layout.addSpacer(); // Blank
+                layout.addSpacer(); // Blank
+                layout.addSpacer(); // Blank
+            }
         }
 
         void updateMeters (float pb, float mw, float at)
@@ -39,6 +56,16 @@ namespace neon
             aftertouch = at;
         }
 
+        void updateCpuReport (float load, const juce::String& degradations)
+        {
+            if (cpuLoad != load || cpuReport != degradations)
+            {
+                cpuLoad = load;
+                cpuReport = degradations;
+                repaint();
+            }
+        }
+
         void paintVisualization (juce::Graphics& g, juce::Rectangle<int> area) override
         {
             auto displayArea = area.reduced(40);
@@ -84,11 +111,23 @@ namespace neon
             drawMeter (displayArea.removeFromLeft ((int)meterW).withSizeKeepingCentre (30, 100).toFloat(), modWheel, "MOD", false);
             displayArea.removeFromLeft (pad);
             drawMeter (displayArea.removeFromLeft ((int)meterW).withSizeKeepingCentre (30, 100).toFloat(), aftertouch, "AT", false);
+
+            if (showsCpu)
+            {
+                g.setColour (accentColor.withAlpha (0.6f));
+                g.setFont (14.0f);
+                g.drawText ("CPU " + juce::String (juce::roundToInt (cpuLoad * 100.0f)) + "%  " + cpuReport,
+                            area.reduced (40, 10).removeFromBottom (20), juce::Justification::centred);
+            }
         }
 
     private:
         float pitchBend = 0.0f;
         float modWheel = 0.0f;
         float aftertouch = 0.0f;
+
+        bool showsCpu = false;
+        float cpuLoad = 0.0f;
+        juce::String cpuReport;
     };
 }
@@ -14,48 +14,66 @@ namespace neon
     class DahdsrModule : public ModuleBase
     {
     public:
-        DahdsrModule (const juce::String& name, const juce::Colour& color, bool includeAmount = false, bool includeModulation = false) 
-            : ModuleBase (name, color)
+        DahdsrModule (NeonInstance& instance, const juce::String& name, const juce::Colour& color, bool includeAmount = false, bool includeModulation = false) 
+            : ModuleBase (instance, name, color)
+        {
+            addParameters (*this, includeAmount, includeModulation);
+
+            // Set initial display
+            lastAdjustedIndex = (includeModulation ? 2 : 1); // Default to Attack
+        }
+
+        static void addParameters (ParameterLayout& layout, bool includeAmount = false, bool includeModulation = false)
         {
             if (includeModulation)
             {
                 // PAGE 1: Row 1: Target, Delay, Attack, Hold
                 std::vector<juce::String> targets = { "Osc 1", "Osc 2", "Osc 1&2" };
-                addChoiceParameter ("Target", targets, 2); // Default to both oscillators
+                layout.addChoiceParameter ("Target", targets, 2); // Default to both oscillators
             }
             
             // PAGE 1: DAHDSR parameters (continuing row 1 if includeModulation, else starting fresh)
-            addParameter ("Delay",   0.0f, 10000.0f, 0.0f);
-            addParameter ("Attack",  0.0f, 10000.0f, 100.0f);
-            addParameter ("Hold",    0.0f, 10000.0f, 0.0f);
+            layout.addParameter ("Delay",   0.0f, 10000.0f, 0.0f);
+            layout.addParameter ("Attack",  0.0f, 10000.0f, 100.0f);
+            layout.addParameter ("Hold",    0.0f, 10000.0f, 0.0f);
             
             // PAGE 1: Row 2: Decay, Sustain, Release, Mode
-            addParameter ("Decay",   0.0f, 10000.0f, 500.0f);
-            addParameter ("Sustain", 0.0f, 1.0f,     0.7f);
-            addParameter ("Release", 0.0f, 10000.0f, 1000.0f);
-            addChoiceParameter ("Env Mode", {"Normal", "Legato", "Retrigger"}, 0);
+            layout.addParameter ("Decay",   0.0f, 10000.0f, 500.0f);
+            layout.addParameter ("Sustain", 0.0f, 1.0f,     0.7f);
+            layout.addParameter ("Release", 0.0f, 10000.0f, 1000.0f);
+            layout.addChoiceParameter ("Env Mode", {"Normal", "Legato", "Retrigger"}, 0);
             
             if (includeAmount || includeModulation)
             {
                 // PAGE 2: Row 1: Amount, V.Amount, AT.Amount, [Blank]
-                addParameter ("Amount", -100.0f, 100.0f, 0.0f);
+                layout.addParameter ("Amount", -100.0f, 100.0f, 0.0f);
                 
                 if (includeModulation)
                 {
-                    addParameter ("V.Amount", 0.0f, 1.0f, 0.0f);  // Velocity sensitivity for amount
-                    addParameter ("AT.Amount", 0.0f, 1.0f, 0.0f); // Aftertouch sensitivity for amount
-                    addSpacer(); // Blank
+                    layout.addParameter ("V.Amount", 0.0f, 1.0f, 0.0f);  // Velocity sensitivity for amount
+                    layout.addParameter ("AT.Amount", 0.0f, 1.0f, 0.0f); // Aftertouch sensitivity for amount
+                    layout.addSpacer(); // Blank
                     
                     // PAGE 2: Row 2: [Blank], V.Attack, [Blank], [Blank]
-                    addSpacer(); // Blank
-                    addParameter ("V.Attack", 0.0f, 1.0f, 0.0f);  // Velocity sensitivity for attack time
-                    addSpacer(); // Blank
-                    addSpacer(); // Blank
+                    layout.addSpacer(); // Blank
+                    layout.addParameter ("V.Attack", 0.0f, 1.0f, 0.0f);  // Velocity sensitivity for attack time
+                    layout.addSpacer(); // Blank
+                    layout.addSpacer(); // Blank
                 }
             }
+        }
 
-            // Set initial display
-            lastAdjustedIndex = (includeModulation ? 2 : 1); // Default to Attack
+        /** Page 2 of an envelope used as a modulation source: four Target/Amount slots. */
+        static void addModSlotParameters (ParameterLayout& layout, const NeonRegistry& registry)
+        {
+            // Page 1 has 7 cards (6 DAHDSR + 1 Mode); one empty choice aligns the 4 slot pairs on page 2
+            layout.addChoiceParameter (" ", {" "}, 0);
+
+            for (int i = 1; i <= 4; ++i)
+            {
+                layout.addChoiceParameter ("Slot " + juce::String(i) + " Target", registry.getTargetNames(), 0);
+                layout.addParameter       ("Slot " + juce::String(i) + " Amount", -100.0f, 100.0f, 0.0f);
+            }
         }
         
         ~DahdsrModule() override = default;
@@ -7,55 +7,60 @@ namespace neon
     class FxModule : public ModuleBase
     {
     public:
-        FxModule (const juce::String& name, const juce::Colour& color) 
-            : ModuleBase (name, color)
+        FxModule (NeonInstance& instance, const juce::String& name, const juce::Colour& color) 
+            : ModuleBase (instance, name, color)
+        {
+            addParameters (*this);
+
+            moduleNameDisplay.setText("MASTER EFFECTS", juce::dontSendNotification);
+            lastAdjustedIndex = 0;
+        }
+
+        static void addParameters (ParameterLayout& layout)
         {
             // PAGE 1: Modulation FX
             // Row 1: Mod Type, Mod Rate, Mod Depth, Mod Feedback
             std::vector<juce::String> modTypes = { "OFF", "CHORUS", "PHASER", "FLANGER" };
-            addChoiceParameter ("Mod Type", modTypes, 1);
-            addParameter ("Mod Rate", 0.1f, 10.0f, 1.0f);
-            addParameter ("Mod Depth", 0.0f, 1.0f, 0.5f);
-            addParameter ("Mod Feedback", 0.0f, 0.95f, 0.0f); // NEW
+            layout.addChoiceParameter ("Mod Type", modTypes, 1);
+            layout.addParameter ("Mod Rate", 0.1f, 10.0f, 1.0f);
+            layout.addParameter ("Mod Depth", 0.0f, 1.0f, 0.5f);
+            layout.addParameter ("Mod Feedback", 0.0f, 0.95f, 0.0f); // NEW
             
             // Row 2: [Blank], [Blank], [Blank], Mix
-            addSpacer();
-            addSpacer();
-            addSpacer();
-            addParameter ("Mod Mix", 0.0f, 1.0f, 0.0f);
+            layout.addSpacer();
+            layout.addSpacer();
+            layout.addSpacer();
+            layout.addParameter ("Mod Mix", 0.0f, 1.0f, 0.0f);
 
             // PAGE 2: Delay
             // Row 1: Dly Time, Dly Note, Dly Sync, Dly FB
-            addParameter ("Dly Time", 1.0f, 2000.0f, 400.0f);
+            layout.addParameter ("Dly Time", 1.0f, 2000.0f, 400.0f);
             std::vector<juce::String> divisions = { 
                 "1/64", "1/32", "1/16", "1/8", "1/4", "1/2", "1/1", "2/1", "4/1" 
             };
-            addChoiceParameter ("Dly Note", divisions, 4); // NEW: Default 1/4
-            addParameter ("Dly Sync", 0.0f, 1.0f, 0.0f, true);
-            if (auto* p = parameters.back()) p->setBinaryLabels ("MS", "NOTE");
-            addParameter ("Dly FB", 0.0f, 0.95f, 0.3f);
+            layout.addChoiceParameter ("Dly Note", divisions, 4); // NEW: Default 1/4
+            if (auto* p = layout.addParameter ("Dly Sync", 0.0f, 1.0f, 0.0f, true))
+                p->setBinaryLabels ("MS", "NOTE");
+            layout.addParameter ("Dly FB", 0.0f, 0.95f, 0.3f);
             
             // Row 2: [Blank], [Blank], [Blank], Mix
-            addSpacer();
-            addSpacer();
-            addSpacer();
-            addParameter ("Dly Mix", 0.0f, 1.0f, 0.0f);
+            layout.addSpacer();
+            layout.addSpacer();
+            layout.addSpacer();
+            layout.addParameter ("Dly Mix", 0.0f, 1.0f, 0.0f);
 
             // PAGE 3: Reverb
             // Row 1: Rvb Time, Rvb Size, Rvb Damp, Rvb Predelay
-            addParameter ("Rvb Time", 0.0f, 10.0f, 2.0f); // NEW: Reverb decay time in seconds
-            addParameter ("Rvb Size", 0.0f, 1.0f, 0.5f);
-            addParameter ("Rvb Damp", 0.0f, 1.0f, 0.5f);
-            addParameter ("Rvb Predelay", 0.0f, 200.0f, 0.0f); // NEW: Predelay in ms
+            layout.addParameter ("Rvb Time", 0.0f, 10.0f, 2.0f); // NEW: Reverb decay time in seconds
+            layout.addParameter ("Rvb Size", 0.0f, 1.0f, 0.5f);
+            layout.addParameter ("Rvb Damp", 0.0f, 1.0f, 0.5f);
+            layout.addParameter ("Rvb Predelay", 0.0f, 200.0f, 0.0f); // NEW: Predelay in ms
             
             // Row 2: [Blank], [Blank], [Blank], Mix
-            addSpacer();
-            addSpacer();
-            addSpacer();
-            addParameter ("Rvb Mix", 0.0f, 1.0f, 0.0f);
-            
-            moduleNameDisplay.setText("MASTER EFFECTS", juce::dontSendNotification);
-            lastAdjustedIndex = 0;
+            layout.addSpacer();
+            layout.addSpacer();
+            layout.addSpacer();
+            layout.addParameter ("Rvb Mix", 0.0f, 1.0f, 0.0f);
         }
 
         void paintVisualization (juce::Graphics& g, juce::Rectangle<int> area) override
@@ -7,23 +7,28 @@ namespace neon
     class LadderFilterModule : public ModuleBase
     {
     public:
-        LadderFilterModule (const juce::String& name, const juce::Colour& color) 
-            : ModuleBase (name, color)
+        LadderFilterModule (NeonInstance& instance, const juce::String& name, const juce::Colour& color) 
+            : ModuleBase (instance, name, color)
+        {
+            addParameters (*this, instance.getRegistry());
+
+            lastAdjustedIndex = 0;
+        }
+
+        static void addParameters (ParameterLayout& layout, const NeonRegistry& registry)
         {
             // Row 1: Type, Cutoff, Res, Slope
-            addChoiceParameter ("Type", NeonRegistry::getFilterTypes(), 0);
-            addParameter ("Cutoff",   20.0f, 20000.0f, 20000.0f);
-            addParameter ("Res",      0.0f, 1.0f, 0.0f);
-            addParameter ("Slope",    0.0f, 1.0f, 1.0f, true);
-            if (auto* p = parameters.back()) p->setBinaryLabels ("12dB", "24dB");
+            layout.addChoiceParameter ("Type", registry.getFilterTypes(), 0);
+            layout.addParameter ("Cutoff",   20.0f, 20000.0f, 20000.0f);
+            layout.addParameter ("Res",      0.0f, 1.0f, 0.0f);
+            if (auto* p = layout.addParameter ("Slope",    0.0f, 1.0f, 1.0f, true))
+                p->setBinaryLabels ("12dB", "24dB");
             
             // Row 2: KeyTrack, Drive, Velocity, Aftertouch
-            addParameter ("KeyTrack", 0.0f, 1.0f, 0.5f, false, 0.0f, false, true);
-            addParameter ("Drive",    1.0f, 10.0f, 1.0f);
-            addParameter ("Velocity", 0.0f, 1.0f, 0.0f); // NEW: Filter velocity sensitivity
-            addParameter ("Aftertouch", 0.0f, 1.0f, 0.0f); // NEW: Filter aftertouch sensitivity
-            
-            lastAdjustedIndex = 0;
+            layout.addParameter ("KeyTrack", 0.0f, 1.0f, 0.5f, false, 0.0f, false, true);
+            layout.addParameter ("Drive",    1.0f, 10.0f, 1.0f);
+            layout.addParameter ("Velocity", 0.0f, 1.0f, 0.0f); // NEW: Filter velocity sensitivity
+            layout.addParameter ("Aftertouch", 0.0f, 1.0f, 0.0f); // NEW: Filter aftertouch sensitivity
         }
 
     protected:
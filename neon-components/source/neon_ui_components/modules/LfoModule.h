@@ -7,43 +7,48 @@ namespace neon
     class LfoModule : public ModuleBase
     {
     public:
-        LfoModule (const juce::String& name, const juce::Colour& color) 
-            : ModuleBase (name, color)
+        LfoModule (NeonInstance& instance, const juce::String& name, const juce::Colour& color) 
+            : ModuleBase (instance, name, color)
+        {
+            addParameters (*this, instance.getRegistry());
+
+            lastAdjustedIndex = 0;
+        }
+
+        static void addParameters (ParameterLayout& layout, const NeonRegistry& registry)
         {
             // Page 1: Main LFO controls
             std::vector<juce::String> shapes = { "TRIANGLE", "RAMP UP", "RAMP DOWN", "SQUARE", "S&H" };
-            addChoiceParameter ("Shape", shapes, 0);
+            layout.addChoiceParameter ("Shape", shapes, 0);
             
-            addParameter ("Sync", 0.0f, 1.0f, 0.0f, true); // Hz / Note
-            if (auto* p = parameters.back()) p->setBinaryLabels ("HZ", "NOTE");
+            if (auto* p = layout.addParameter ("Sync", 0.0f, 1.0f, 0.0f, true)) // Hz / Note
+                p->setBinaryLabels ("HZ", "NOTE");
 
-            addParameter ("Rate Hz", 0.2f, 20.0f, 1.0f); // 0.2-20 Hz with default skew
+            layout.addParameter ("Rate Hz", 0.2f, 20.0f, 1.0f); // 0.2-20 Hz with default skew
             
             std::vector<juce::String> divisions = { 
                 "1/64", "1/32", "1/16", "1/8", "1/4", "1/2", "1/1", "2/1", "4/1" 
             };
-            addChoiceParameter ("Rate Note", divisions, 4); // Default 1/4
+            layout.addChoiceParameter ("Rate Note", divisions, 4); // Default 1/4
 
-            addParameter ("KeySync", 0.0f, 1.0f, 1.0f, true);
-            if (auto* p = parameters.back()) p->setBinaryLabels ("OFF", "ON");
+            if (auto* p = layout.addParameter ("KeySync", 0.0f, 1.0f, 1.0f, true))
+                p->setBinaryLabels ("OFF", "ON");
 
-            addParameter ("Phase", 0.0f, 360.0f, 0.0f, false, 0.0f, false, true);
-            addParameter ("Delay", 0.0f, 5000.0f, 0.0f, false, 0.0f, false, true); // Delay in ms
-            addParameter ("Fade", 0.0f, 5000.0f, 0.0f, false, 0.0f, false, true);  // NEW: Fade-in time in ms
+            layout.addParameter ("Phase", 0.0f, 360.0f, 0.0f, false, 0.0f, false, true);
+            layout.addParameter ("Delay", 0.0f, 5000.0f, 0.0f, false, 0.0f, false, true); // Delay in ms
+            layout.addParameter ("Fade", 0.0f, 5000.0f, 0.0f, false, 0.0f, false, true);  // NEW: Fade-in time in ms
 
             // Page 2: Modulation Targets (All 4 on one page)
             // To ensure they are together, we add 0 spacers (8 used already - perfect fit)
 
             // Targets
-            std::vector<juce::String> targets = getModTargetNames();
+            std::vector<juce::String> targets = registry.getTargetNames();
 
             for (int i = 1; i <= 4; ++i)
             {
-                addChoiceParameter ("Slot " + juce::String(i) + " Target", targets, 0);
-                addParameter       ("Slot " + juce::String(i) + " Amount", -100.0f, 100.0f, 0.0f);
+                layout.addChoiceParameter ("Slot " + juce::String(i) + " Target", targets, 0);
+                layout.addParameter       ("Slot " + juce::String(i) + " Amount", -100.0f, 100.0f, 0.0f);
             }
-            
-            lastAdjustedIndex = 0;
         }
 
         void paintVisualization (juce::Graphics& g, juce::Rectangle<int> area) override
@@ -8,21 +8,21 @@ namespace neon
     class LibrarianModule : public ModuleBase, public juce::ListBoxModel
     {
     public:
-        LibrarianModule (const juce::String& name, const juce::Colour& color) 
-            : ModuleBase (name, color)
+        LibrarianModule (NeonInstance& instance, const juce::String& name, const juce::Colour& color) 
+            : ModuleBase (instance, name, color)
         {
             // Patch controls
             patchNameEditor.setJustification (juce::Justification::centred);
             patchNameEditor.setFont (juce::FontOptions ().withHeight (30.0f).withStyle ("Bold"));
             patchNameEditor.setColour (juce::TextEditor::backgroundColourId, juce::Colours::black.withAlpha (0.3f));
             patchNameEditor.setColour (juce::TextEditor::textColourId, juce::Colours::white);
-            patchNameEditor.setText (NeonRegistry::getCurrentPatchName());
+            patchNameEditor.setText (getNeonInstance().getRegistry().getCurrentPatchName());
             patchNameEditor.onReturnKey = [this] { performSave (false); };
             addAndMakeVisible (patchNameEditor);
 
             loadBtn.setButtonText ("LOAD");
             loadBtn.onClick = [this] { 
-                PatchManager::getInstance().loadPatch (patchList.getSelectedRow()); 
+                getPatchManager().loadPatch (patchList.getSelectedRow()); 
                 updateUI();
             };
             addAndMakeVisible (loadBtn);
@@ -41,14 +41,14 @@ namespace neon
 
             initBtn.setButtonText ("INIT");
             initBtn.onClick = [this] { 
-                PatchManager::getInstance().initPatch(); 
+                getPatchManager().initPatch(); 
                 updateUI();
             };
             addAndMakeVisible (initBtn);
 
             // Bank controls
             bankSelector.onChange = [this] { 
-                PatchManager::getInstance().selectBank (bankSelector.getSelectedItemIndex());
+                getPatchManager().selectBank (bankSelector.getSelectedItemIndex());
                 updateUI();
             };
             addAndMakeVisible (bankSelector);
@@ -56,7 +56,7 @@ namespace neon
             newBankBtn.setButtonText ("NEW BANK");
             newBankBtn.onClick = [this] {
                 // Temporary name, user can rename
-                PatchManager::getInstance().createNewBank ("New Bank");
+                getPatchManager().createNewBank ("New Bank");
                 updateUI();
             };
             addAndMakeVisible (newBankBtn);
@@ -64,7 +64,8 @@ namespace neon
             renameBankBtn.setButtonText ("RENAME BANK");
             renameBankBtn.onClick = [this] {
                 // Simplified rename for bank
-                PatchManager::getInstance().renameBank (bankSelector.getText());
+                if (! getPatchManager().renameBank (bankSelector.getText()))
+                    showMomentaryMessage ("RENAME FAILED!");
                 updateUI();
             };
             addAndMakeVisible (renameBankBtn);
@@ -79,15 +80,20 @@ namespace neon
             messageLabel.setColour (juce::Label::textColourId, juce::Colours::white);
             addChildComponent (messageLabel);
 
-            // Add navigation parameters using the new Momentary flag
-            addParameter ("PREV BANK", 0.0f, 1.0f, 0.0f, true, 0.0f, true);
-            addParameter ("NEXT BANK", 0.0f, 1.0f, 0.0f, true, 0.0f, true);
-            addParameter ("PREV PATCH", 0.0f, 1.0f, 0.0f, true, 0.0f, true);
-            addParameter ("NEXT PATCH", 0.0f, 1.0f, 0.0f, true, 0.0f, true);
+            addParameters (*this);
 
             updateUI();
         }
 
+        static void addParameters (ParameterLayout& layout)
+        {
+            // Add navigation parameters using the new Momentary flag
+            layout.addParameter ("PREV BANK", 0.0f, 1.0f, 0.0f, true, 0.0f, true);
+            layout.addParameter ("NEXT BANK", 0.0f, 1.0f, 0.0f, true, 0.0f, true);
+            layout.addParameter ("PREV PATCH", 0.0f, 1.0f, 0.0f, true, 0.0f, true);
+            layout.addParameter ("NEXT PATCH", 0.0f, 1.0f, 0.0f, true, 0.0f, true);
+        }
+
         void timerCallback() override
         {
             ModuleBase::timerCallback();
@@ -105,16 +111,16 @@ namespace neon
                 }
             };
 
-            checkTrigger ("PREV BANK", lastPrevBank, [this]{ PatchManager::getInstance().prevBank(); updateUI(); });
-            checkTrigger ("NEXT BANK", lastNextBank, [this]{ PatchManager::getInstance().nextBank(); updateUI(); });
-            checkTrigger ("PREV PATCH", lastPrevPatch, [this]{ PatchManager::getInstance().prevPatch(); updateUI(); });
-            checkTrigger ("NEXT PATCH", lastNextPatch, [this]{ PatchManager::getInstance().nextPatch(); updateUI(); });
+            checkTrigger ("PREV BANK", lastPrevBank, [this]{ getPatchManager().prevBank(); updateUI(); });
+            checkTrigger ("NEXT BANK", lastNextBank, [this]{ getPatchManager().nextBank(); updateUI(); });
+            checkTrigger ("PREV PATCH", lastPrevPatch, [this]{ getPatchManager().prevPatch(); updateUI(); });
+            checkTrigger ("NEXT PATCH", lastNextPatch, [this]{ getPatchManager().nextPatch(); updateUI(); });
         }
 
         void updateUI()
         {
-            auto& pm = PatchManager::getInstance();
-            patchNameEditor.setText (NeonRegistry::getCurrentPatchName(), juce::dontSendNotification);
+            auto& pm = getPatchManager();
+            patchNameEditor.setText (getNeonInstance().getRegistry().getCurrentPatchName(), juce::dontSendNotification);
             
             bankSelector.clear (juce::dontSendNotification);
             auto banks = pm.getBankNames();
@@ -129,7 +135,7 @@ namespace neon
 
         void performSave (bool isSaveAs)
         {
-            auto& pm = PatchManager::getInstance();
+            auto& pm = getPatchManager();
             int targetIndex = pm.getCurrentPatchIndex();
 
             if (isSaveAs)
@@ -142,9 +148,10 @@ namespace neon
                 }
             }
 
-            pm.savePatch (patchNameEditor.getText(), targetIndex);
-            
-            if (isSaveAs)
+            // e.g. read-only factory folder, or another app holding the bank open
+            if (! pm.savePatch (patchNameEditor.getText(), targetIndex))
+                showMomentaryMessage ("SAVE FAILED!");
+            else if (isSaveAs)
                 showMomentaryMessage ("SAVED AS #" + juce::String (targetIndex + 1));
             else
                 showMomentaryMessage ("PATCH SAVED");
@@ -152,6 +159,8 @@ namespace neon
             updateUI();
         }
 
+        PatchManager& getPatchManager() { return getNeonInstance().getPatchManager(); }
+
         void showMomentaryMessage (const juce::String& msg)
         {
             messageLabel.setText (msg, juce::dontSendNotification);
@@ -169,7 +178,7 @@ namespace neon
             g.setColour (rowIsSelected ? juce::Colours::white : accentColor.withAlpha (0.7f));
             g.setFont (18.0f);
             
-            auto names = PatchManager::getInstance().getPatchNames();
+            auto names = getPatchManager().getPatchNames();
             juce::String text = juce::String (rowNumber + 1).paddedLeft (' ', 3) + ": ";
             if (rowNumber < names.size())
                 text += names[rowNumber];
@@ -181,7 +190,7 @@ namespace neon
 
         void listBoxItemDoubleClicked (int row, const juce::MouseEvent&) override
         {
-            PatchManager::getInstance().loadPatch (row);
+            getPatchManager().loadPatch (row);
             updateUI();
         }
 
@@ -12,13 +12,31 @@ namespace neon
     class ModMatrixModule : public ModuleBase
     {
     public:
-        ModMatrixModule (const juce::String& name, const juce::Colour& color) 
-            : ModuleBase (name, color)
+        ModMatrixModule (NeonInstance& instance, const juce::String& name, const juce::Colour& color) 
+            : ModuleBase (instance, name, color)
         {
-            // The mapping parameters are added in PluginEditor or here
+            addParameters (*this, instance.getRegistry());
             moduleNameDisplay.setText("MODULATION MATRIX", juce::dontSendNotification);
         }
 
+        /** 4-slot modulation matrix with [Source][Target][Amount] */
+        static void addParameters (ParameterLayout& layout, const NeonRegistry& registry)
+        {
+            static const std::vector<juce::String> sources = {"None", "Velocity", "Aftertouch", "Note#", 
+                                                              "CC 1 (Mod Wheel)", "CC 11 (Expression)", "CC 2 (Breath)", 
+                                                              "CC 4 (Foot Pedal)", "CC 64 (Sustain)",
+                                                              "CC 16", "CC 17", "CC 18", "CC 19",
+                                                              "CC 80", "CC 81", "CC 82", "CC 83"};
+
+            for (int i = 1; i <= 4; ++i)
+            {
+                layout.addChoiceParameter ("Slot " + juce::String(i) + " Source", sources, 0);
+                layout.addChoiceParameter ("Slot " + juce::String(i) + " Target", registry.getTargetNames(), 0);
+                layout.addParameter       ("Slot " + juce::String(i) + " Amount", -100.0f, 100.0f, 0.0f);
+                layout.addChoiceParameter (" ", {" "}, 0); // Spacer for alignment
+            }
+        }
+
         void paintVisualization (juce::Graphics& g, juce::Rectangle<int> area) override
         {
             // Just a placeholder or simple graphic since meters moved to CTRL
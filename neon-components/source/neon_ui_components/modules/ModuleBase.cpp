@@ -3,8 +3,9 @@
 
 namespace neon
 {
-    ModuleBase::ModuleBase (const juce::String& name, const juce::Colour& color)
-        : moduleName (name), accentColor (color), lastAdjustedIndex (-1)
+    ModuleBase::ModuleBase (NeonInstance& instance, const juce::String& name, const juce::Colour& color)
+        : ParameterLayout (instance.getParameterRegistry(), name),
+          neonInstance (instance), moduleName (name), accentColor (color), lastAdjustedIndex (-1)
     {
         // Display Area
         unitDisplay.setJustificationType (juce::Justification::centred);
@@ -36,7 +37,7 @@ namespace neon
         midiIndicator.setColour (juce::Label::textColourId, juce::Colours::transparentBlack); // Hidden by default
         addAndMakeVisible (midiIndicator);
 
-        patchNameDisplay.setText (NeonRegistry::getCurrentPatchName(), juce::dontSendNotification);
+        patchNameDisplay.setText (neonInstance.getRegistry().getCurrentPatchName(), juce::dontSendNotification);
         patchNameDisplay.setJustificationType (juce::Justification::centredTop);
         patchNameDisplay.setFont (juce::FontOptions ().withHeight (24.0f).withStyle ("Bold"));
         patchNameDisplay.setColour (juce::Label::textColourId, accentColor.withAlpha (0.9f));
@@ -58,29 +59,12 @@ namespace neon
         stopTimer();
     }
 
-    void ModuleBase::addParameter (const juce::String& name, float min, float max, float def, bool isBool, float interval, bool isMomentary, bool isLinear)
+    void ModuleBase::parameterAdded (ManagedParameter& p)
     {
         int index = (int)parameters.size();
-        auto* p = ParameterRegistry::getInstance().getOrCreateParameter (moduleName, name, min, max, def, isBool, interval, isMomentary, isLinear);
-        parameters.push_back (p);
+        parameters.push_back (&p);
 
-        auto card = std::make_unique<ParameterCard> (*p, accentColor);
-        card->onValueChanged = [this, index] (float) { lastAdjustedIndex = index; };
-        
-        addChildComponent (card.get());
-        cards.push_back (std::move (card));
-        
-        numPages = (int)std::ceil (cards.size() / 8.0f);
-        updatePageVisibility();
-    }
-
-    void ModuleBase::addChoiceParameter (const juce::String& name, const std::vector<juce::String>& choices, int defaultIndex)
-    {
-        int index = (int)parameters.size();
-        auto* p = ParameterRegistry::getInstance().getOrCreateChoiceParameter (moduleName, name, choices, defaultIndex);
-        parameters.push_back (p);
-
-        auto card = std::make_unique<ParameterCard> (*p, accentColor);
+        auto card = std::make_unique<ParameterCard> (p, accentColor);
         card->onValueChanged = [this, index] (float) { lastAdjustedIndex = index; };
         
         addChildComponent (card.get());
@@ -103,7 +87,7 @@ namespace neon
         }
     }
 
-    void ModuleBase::addSpacer()
+    void ModuleBase::spacerAdded()
     {
         auto card = std::make_unique<ParameterCard> (" ", accentColor);
         card->setVisible (false);
@@ -151,7 +135,7 @@ namespace neon
         midiIndicator.setColour (juce::Label::textColourId, midiActive ? accentColor : juce::Colours::transparentBlack);
 
         // Update Patch Name
-        patchNameDisplay.setText (NeonRegistry::getCurrentPatchName(), juce::dontSendNotification);
+        patchNameDisplay.setText (neonInstance.getRegistry().getCurrentPatchName(), juce::dontSendNotification);
 
         // Always trigger a repaint for visualization
         repaint();
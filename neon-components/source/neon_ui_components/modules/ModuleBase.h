@@ -4,6 +4,8 @@
 #include "../widgets/NeonParameterCard.h"
 #include "../core/NeonManagedParameter.h"
 #include "../core/NeonColors.h"
+#include "../core/NeonInstance.h"
+#include "../core/NeonParameterLayout.h"
 
 namespace neon
 {
@@ -11,11 +13,13 @@ namespace neon
      * ModuleBase
      * Base class for all high-level synth modules with the "Unit Display" layout.
      * 5/8 Display, 2/8 Parameters (2x4), 1/8 Paging
+     * Parameters are registered in the given instance; as a ParameterLayout, a module
+     * gets one card per parameter it declares.
      */
-    class ModuleBase : public juce::Component, public juce::Timer
+    class ModuleBase : public juce::Component, public juce::Timer, public ParameterLayout
     {
     public:
-        ModuleBase (const juce::String& moduleName, const juce::Colour& accentColor);
+        ModuleBase (NeonInstance& instance, const juce::String& moduleName, const juce::Colour& accentColor);
         ~ModuleBase() override;
 
         void paint (juce::Graphics& g) override;
@@ -26,10 +30,7 @@ namespace neon
         void timerCallback() override;
 
         void setPage (int newPage);
-        void addParameter (const juce::String& name, float min, float max, float def, bool isBool = false, float interval = 0.0f, bool isMomentary = false, bool isLinear = false);
-        void addChoiceParameter (const juce::String& name, const std::vector<juce::String>& choices, int defaultIndex);
         void updateChoiceParameter (const juce::String& name, const std::vector<juce::String>& choices);
-        void addSpacer();
         
         void setMidiActive (bool active) { if (midiActive != active) { midiActive = active; repaint(); } }
         void setVoiceCount (int count) { if (voiceCountCount != count) { voiceCountCount = count; repaint(); } }
@@ -37,7 +38,14 @@ namespace neon
         // Load settings from a "Patch"
         void loadPatch (const std::map<juce::String, float>& patchData);
 
+        NeonInstance& getNeonInstance() const { return neonInstance; }
+
     protected:
+        NeonInstance& neonInstance;
+
+        void parameterAdded (ManagedParameter& parameter) override;
+        void spacerAdded() override;
+
         virtual void paintVisualization (juce::Graphics& g, juce::Rectangle<int> area) {}
         virtual void handleVisualizationInteraction (const juce::MouseEvent& e, bool isDrag) {}
 
@@ -7,13 +7,18 @@ namespace neon
     class NoiseModule : public ModuleBase
     {
     public:
-        NoiseModule (const juce::String& name, const juce::Colour& color) 
-            : ModuleBase (name, color)
+        NoiseModule (NeonInstance& instance, const juce::String& name, const juce::Colour& color) 
+            : ModuleBase (instance, name, color)
         {
-            addParameter ("Volume", 0.0f, 1.0f, 0.0f);
-            addSpacer(); // Blank
-            addSpacer(); // Blank
-            addSpacer(); // Blank
+            addParameters (*this);
+        }
+
+        static void addParameters (ParameterLayout& layout)
+        {
+            layout.addParameter ("Volume", 0.0f, 1.0f, 0.0f);
+            layout.addSpacer(); // Blank
+            layout.addSpacer(); // Blank
+            layout.addSpacer(); // Blank
         }
 
         void paintVisualization (juce::Graphics& g, juce::Rectangle<int> area) override
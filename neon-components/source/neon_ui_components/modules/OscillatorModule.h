@@ -1,6 +1,7 @@
 #pragma once
 
 #include "ModuleBase.h"
+#include "../dsp/NeonWavetableLibrary.h"
 #include <juce_audio_formats/juce_audio_formats.h>
 
 namespace neon
@@ -8,33 +9,10 @@ namespace neon
     class OscillatorModule : public ModuleBase
     {
     public:
-        OscillatorModule (const juce::String& name, const juce::Colour& color) 
-            : ModuleBase (name, color)
+        OscillatorModule (NeonInstance& instance, const juce::String& name, const juce::Colour& color) 
+            : ModuleBase (instance, name, color)
         {
-            // PAGE 1: Row 1: Waveform, Volume, Transp, Detune
-            addParameter ("Waveform",  0.0f, 200.0f, 0.0f, false, 1.0f);
-            addParameter ("Volume",    0.0f, 1.0f, 0.8f);
-            addParameter ("Transp",    -24.0f, 24.0f, 0.0f, false, 1.0f);
-            addParameter ("Detune",    -100.0f, 100.0f, 0.0f);
-            
-            // PAGE 1: Row 2: Phase, KeySync, Unison, USpread
-            addParameter ("Phase",     0.0f, 360.0f, 0.0f, false, 0.0f, false, true);
-            addParameter ("KeySync",   0.0f, 1.0f, 1.0f, true);
-            if (auto* p = parameters.back()) p->setBinaryLabels("OFF", "ON");
-            addParameter ("Unison",    1.0f, 8.0f, 1.0f, false, 1.0f);
-            addParameter ("USpread",   0.0f, 1.0f, 0.2f);
-            
-            // PAGE 2: Row 1: Drive, BitRedux, Symmetry, Fold
-            addParameter ("Drive",     0.0f, 1.0f, 0.0f);
-            addParameter ("BitRedux",  0.0f, 1.0f, 0.0f);
-            addParameter ("Symmetry",  0.0f, 1.0f, 0.5f, false, 0.0f, false, true);
-            addParameter ("Fold",      0.0f, 1.0f, 0.0f);
-            
-            // PAGE 2: Row 2: Pan, [Blank], [Blank], [Blank]
-            addParameter ("Pan",       -1.0f, 1.0f, 0.0f);
-            addSpacer(); // Blank
-            addSpacer(); // Blank
-            addSpacer(); // Blank
+            addParameters (*this);
 
             loadWaveforms();
 
@@ -52,8 +30,40 @@ namespace neon
 
             addAndMakeVisible (waveformSelector);
             
+            // Show the stored waveform; the parameter may already hold a loaded patch or session
             if (waveformSelector.getNumItems() > 0)
-                waveformSelector.setSelectedItemIndex (0);
+                waveformSelector.setSelectedItemIndex (juce::jlimit (0, waveformSelector.getNumItems() - 1, (int) parameters[0]->getValue()), juce::dontSendNotification);
+        }
+
+        static void addParameters (ParameterLayout& layout)
+        {
+            // PAGE 1: Row 1: Waveform, Volume, Transp, Detune
+            layout.addParameter ("Waveform",  0.0f, 200.0f, 0.0f, false, 1.0f);
+            layout.addParameter ("Volume",    0.0f, 1.0f, 0.8f);
+            layout.addParameter ("Transp",    -24.0f, 24.0f, 0.0f, false, 1.0f);
+            layout.addParameter ("Detune",    -100.0f, 100.0f, 0.0f);
+            
+            // PAGE 1: Row 2: Phase, KeySync, Unison, USpread
+            layout.addParameter ("Phase",     0.0f, 360.0f, 0.0f, false, 0.0f, false, true);
+            if (auto* p = layout.addParameter ("KeySync",   0.0f, 1.0f, 1.0f, true))
+                p->setBinaryLabels("OFF", "ON");
+            layout.addParameter ("Unison",    1.0f, 16.0f, 1.0f, false, 1.0f);
+            layout.addParameter ("USpread",   0.0f, 1.0f, 0.2f);
+            
+            // PAGE 2: Row 1: Drive, BitRedux, Symmetry, Fold
+            layout.addParameter ("Drive",     0.0f, 1.0f, 0.0f);
+            layout.addParameter ("BitRedux",  0.0f, 1.0f, 0.0f);
+            layout.addParameter ("Symmetry",  0.0f, 1.0f, 0.5f, false, 0.0f, false, true);
+            layout.addParameter ("Fold",      0.0f, 1.0f, 0.0f);
+            
+            // PAGE 2: Row 2: Pan, WT Pos, User WT, [Blank]
+            layout.addParameter ("Pan",       -1.0f, 1.0f, 0.0f);
+            layout.addParameter ("WT Pos",    -1.0f, 1.0f, 0.0f); // scan from the selected frame through its family
+
+            // One choice per stable library ID, so the stored value survives library changes;
+            // the names are filled in by setUserWavetableNames() once the library has loaded
+            layout.addChoiceParameter ("User WT", WavetableLibrary::getChoiceNames (nullptr), 0);
+            layout.addSpacer(); // Blank
         }
 
         void resized() override
@@ -88,7 +98,7 @@ namespace neon
             g.setColour (accentColor.withAlpha (0.15f));
             g.drawRect (r, 1.0f);
 
-            auto* buffer = NeonRegistry::getWaveformBuffer((int)std::round(parameters[0]->getValue()));
+            auto* buffer = getNeonInstance().getRegistry().getWaveformBuffer((int)std::round(parameters[0]->getValue()));
             if (buffer != nullptr && buffer->getNumSamples() > 0)
             {
                 auto data = buffer->getReadPointer (0);
@@ -165,12 +175,35 @@ namespace neon
                 g.setColour (drawColor.withAlpha(0.3f));
                 g.strokePath (path, juce::PathStrokeType (10.0f));
             }
+
+            if (userWavetableStatus.isNotEmpty())
+            {
+                g.setColour (juce::Colours::orange);
+                g.setFont (16.0f);
+                g.drawFittedText ("USER WT: " + userWavetableStatus, area.reduced (40, 10).removeFromBottom (40),
+                                  juce::Justification::centred, 2);
+            }
+        }
+
+        void setUserWavetableNames (const std::vector<juce::String>& names)
+        {
+            updateChoiceParameter ("User WT", names);
+        }
+
+        /** Files the wavetable library had to leave out (see WavetableLibrary::getStatus()). */
+        void setUserWavetableStatus (const juce::String& status)
+        {
+            if (userWavetableStatus != status)
+            {
+                userWavetableStatus = status;
+                repaint();
+            }
         }
 
     private:
         void loadWaveforms()
         {
-            auto names = NeonRegistry::getWaveformNames();
+            const auto& names = getNeonInstance().getRegistry().getWaveformNames();
             waveformSelector.clear();
             for (int i = 0; i < names.size(); ++i)
                 waveformSelector.addItem (names[i], i + 1);
@@ -183,5 +216,6 @@ namespace neon
         }
 
         juce::ComboBox waveformSelector;
+        juce::String userWavetableStatus;
     };
 }
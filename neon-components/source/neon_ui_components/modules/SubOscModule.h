@@ -7,18 +7,23 @@ namespace neon
     class SubOscModule : public ModuleBase
     {
     public:
-        SubOscModule (const juce::String& name, const juce::Colour& color) 
-            : ModuleBase (name, color)
+        SubOscModule (NeonInstance& instance, const juce::String& name, const juce::Colour& color) 
+            : ModuleBase (instance, name, color)
+        {
+            addParameters (*this);
+
+            lastAdjustedIndex = 0;
+        }
+
+        static void addParameters (ParameterLayout& layout)
         {
             // PAGE 1: Row 1: Octave, Volume, Pan, [Blank]
             std::vector<juce::String> octaves = { "-2 Oct", "-1 Oct", "-0.5 Oct" };
-            addChoiceParameter ("Octave", octaves, 1); // Default to -1 Oct
-            
-            addParameter ("Volume", 0.0f, 1.0f, 0.0f);
-            addParameter ("Pan", -1.0f, 1.0f, 0.0f);
-            addSpacer(); // Blank
+            layout.addChoiceParameter ("Octave", octaves, 1); // Default to -1 Oct
             
-            lastAdjustedIndex = 0;
+            layout.addParameter ("Volume", 0.0f, 1.0f, 0.0f);
+            layout.addParameter ("Pan", -1.0f, 1.0f, 0.0f);
+            layout.addSpacer(); // Blank
         }
 
         void paintVisualization (juce::Graphics& g, juce::Rectangle<int> area) override
@@ -1,7 +1,6 @@
 #include "neon_ui_components.h"
 
 #include "core/NeonLookAndFeel.cpp"
-#include "core/NeonParameterRegistry.cpp"
 #include "widgets/NeonBar.cpp"
 #include "widgets/NeonToggle.cpp"
 #include "widgets/NeonParameterCard.cpp"
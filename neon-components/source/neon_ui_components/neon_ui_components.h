@@ -9,7 +9,7 @@
   website:          http://neonh2o.com
   license:          Proprietary
 
-  dependencies:     juce_gui_basics, juce_gui_extra, juce_graphics
+  dependencies:     juce_gui_basics, juce_gui_extra, juce_graphics, juce_audio_basics, juce_audio_formats, juce_dsp
 
  END_JUCE_MODULE_DECLARATION
 *******************************************************************************/
@@ -19,6 +19,8 @@
 #include <juce_gui_basics/juce_gui_basics.h>
 #include <juce_gui_extra/juce_gui_extra.h>
 #include <juce_graphics/juce_graphics.h>
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <juce_dsp/juce_dsp.h>
 
 /** Config: NEON_USE_7SEG_FONT
     Whether to use the specialized 7-segment font for value displays.
@@ -32,9 +34,34 @@
 #include "core/NeonLookAndFeel.h"
 #include "core/NeonParameterTemplate.h"
 #include "core/NeonManagedParameter.h"
+#include "core/NeonParameterEventQueue.h"
 #include "core/NeonParameterRegistry.h"
+#include "core/NeonParameterLayout.h"
 #include "core/NeonRegistry.h"
+#include "core/NeonBankFile.h"
+#include "core/NeonPatchLoader.h"
 #include "core/NeonPatchManager.h"
+#include "core/NeonInstance.h"
+
+// Engine-side DSP helpers
+#include "dsp/NeonFastMath.h"
+#include "dsp/NeonAdaa.h"
+#include "dsp/NeonSmoothingBank.h"
+#include "dsp/NeonMidiSplitter.h"
+#include "dsp/NeonMipmappedWavetable.h"
+#include "dsp/NeonWavetableFamily.h"
+#include "dsp/NeonWavetableLibrary.h"
+#include "dsp/NeonUnisonKernel.h"
+#include "dsp/NeonLadderFilter.h"
+#include "dsp/NeonVoiceEngine.h"
+#include "dsp/NeonModRouting.h"
+#include "dsp/NeonLfo.h"
+#include "dsp/NeonArpeggiator.h"
+#include "dsp/NeonRenderPool.h"
+#include "dsp/NeonCpuGovernor.h"
+#include "dsp/NeonRenderQuality.h"
+#include "dsp/NeonDecimator.h"
+#include "dsp/NeonPolySignalPath.h"
 
 // Atoms (Individual Widgets)
 #include "widgets/NeonBar.h"
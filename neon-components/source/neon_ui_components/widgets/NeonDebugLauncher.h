@@ -9,10 +9,12 @@ namespace neon
      * NeonDebugLauncher
      * A small "DBG" toggle button that can be parented to any editor.
      * Clicking it opens (or closes) a pop-out DocumentWindow containing a
-     * live NeonDebugPanel reflecting the global ParameterRegistry.
+     * live NeonDebugPanel reflecting the plugin instance's ParameterRegistry.
      *
      * Usage in an editor:
      *     NeonDebugLauncher debugLauncher;
+     *     // in the initialiser list:
+     *     debugLauncher (p.getNeonInstance().getParameterRegistry())
      *     // in constructor:
      *     addAndMakeVisible (debugLauncher);
      *     // in resized():
@@ -21,7 +23,8 @@ namespace neon
     class NeonDebugLauncher : public juce::Component
     {
     public:
-        NeonDebugLauncher()
+        explicit NeonDebugLauncher (ParameterRegistry& registryToShow)
+            : registry (registryToShow)
         {
             button.setButtonText ("DBG");
             button.setClickingTogglesState (true);
@@ -55,7 +58,7 @@ namespace neon
         void showWindow()
         {
             if (debugWindow == nullptr)
-                debugWindow.reset (new DebugWindow ([this] { onWindowClosed(); }));
+                debugWindow.reset (new DebugWindow (registry, [this] { onWindowClosed(); }));
 
             debugWindow->setVisible (true);
             debugWindow->toFront (true);
@@ -74,7 +77,7 @@ namespace neon
         class DebugWindow : public juce::DocumentWindow
         {
         public:
-            explicit DebugWindow (std::function<void()> onClose)
+            DebugWindow (ParameterRegistry& registry, std::function<void()> onClose)
                 : juce::DocumentWindow ("Neon Debug Parameters",
                                         juce::Colours::black,
                                         juce::DocumentWindow::closeButton),
@@ -82,7 +85,7 @@ namespace neon
             {
                 setUsingNativeTitleBar (true);
                 setResizable (true, true);
-                setContentOwned (new NeonDebugPanel(), false);
+                setContentOwned (new NeonDebugPanel (registry), false);
                 centreWithSize (720, 540);
             }
 
@@ -108,6 +111,7 @@ namespace neon
             });
         }
 
+        ParameterRegistry& registry;
         juce::TextButton button;
         std::unique_ptr<DebugWindow> debugWindow;
 
@@ -13,7 +13,8 @@ namespace neon
     class NeonDebugPanel : public juce::Component, public juce::Timer
     {
     public:
-        NeonDebugPanel()
+        explicit NeonDebugPanel (ParameterRegistry& registryToShow)
+            : registry (registryToShow)
         {
             startTimerHz (30);
         }
@@ -52,7 +53,7 @@ namespace neon
             int numCols = 3;
             int colW = (bounds.getWidth() - (10 * (numCols + 1))) / numCols;
 
-            const auto& params = ParameterRegistry::getInstance().getParameters();
+            const auto& params = registry.getParameters();
             
             for (auto const& [path, param] : params)
             {
@@ -95,6 +96,8 @@ namespace neon
         }
 
     private:
+        ParameterRegistry& registry;
+
         JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (NeonDebugPanel)
     };
 }
@@ -0,0 +1,106 @@
+/*
+ * FastMathAccuracy
+ * Prints the accuracy table at the top of dsp/NeonFastMath.h: every approximation against
+ * the double-precision libm result, over 1M float inputs per range. NeonFastMath.h only
+ * needs the standard library, so this builds on its own:
+ *
+ *     c++ -std=c++20 -O2 neon-components/tools/FastMathAccuracy.cpp -o fastmath_accuracy
+ *     ./fastmath_accuracy
+ *
+ * "lin" ranges are sampled evenly, "log" ranges evenly in log2 (x), which is what finds the
+ * relative error of small arguments. Re-run it and update the table after touching the
+ * polynomials.
+ */
+
+#include "../source/neon_ui_components/dsp/NeonFastMath.h"
+#include <cstdio>
+#include <functional>
+#include <numbers>
+
+namespace
+{
+    constexpr int numPoints = 1000000;
+    constexpr double pi = std::numbers::pi;
+
+    enum class Spacing { lin, log };
+    enum class Metric { absolute, relative };
+
+    struct Row
+    {
+        const char* name;
+        const char* range;
+        double lo, hi;
+        Spacing spacing;
+        Metric metric;
+        std::function<float (float)> approx;
+        std::function<double (double)> exact;
+    };
+
+    float input (const Row& row, int i)
+    {
+        const double t = (double) i / (double) (numPoints - 1);
+        if (row.spacing == Spacing::log)
+            return (float) std::exp2 (std::log2 (row.lo) + t * (std::log2 (row.hi) - std::log2 (row.lo)));
+        return (float) (row.lo + t * (row.hi - row.lo));
+    }
+
+    double measure (const Row& row)
+    {
+        double worst = 0.0;
+        for (int i = 0; i < numPoints; ++i)
+        {
+            const float x = input (row, i);
+            const double expected = row.exact ((double) x);
+            if (row.metric == Metric::relative && expected == 0.0)
+                continue;
+
+            const double error = std::abs ((double) row.approx (x) - expected);
+            worst = std::max (worst, row.metric == Metric::relative ? error / std::abs (expected) : error);
+        }
+        return worst;
+    }
+}
+
+int main()
+{
+    using namespace neon;
+
+    const Row rows[] =
+    {
+        { "exp2",     "[-24, 24]",             -24.0, 24.0,         Spacing::lin, Metric::relative,
+          [] (float x) { return fastmath::exp2 (x); },  [] (double x) { return std::exp2 (x); } },
+        { "exp",      "[-20, 20]",             -20.0, 20.0,         Spacing::lin, Metric::relative,
+          [] (float x) { return fastmath::exp (x); },   [] (double x) { return std::exp (x); } },
+        { "log2",     "[2^-20, 2^20] log",     0x1p-20, 0x1p20,     Spacing::log, Metric::absolute,
+          [] (float x) { return fastmath::log2 (x); },  [] (double x) { return std::log2 (x); } },
+        { "sin2pi",   "[-8, 8] cycles",        -8.0, 8.0,           Spacing::lin, Metric::absolute,
+          [] (float x) { return fastmath::sin2pi (x); }, [] (double x) { return std::sin (2.0 * pi * x); } },
+        { "sin2pi",   "[2^-24, 0.25] cycles log", 0x1p-24, 0.25,       Spacing::log, Metric::relative,
+          [] (float x) { return fastmath::sin2pi (x); }, [] (double x) { return std::sin (2.0 * pi * x); } },
+        { "cos2pi",   "[-8, 8] cycles",        -8.0, 8.0,           Spacing::lin, Metric::absolute,
+          [] (float x) { return fastmath::cos2pi (x); }, [] (double x) { return std::cos (2.0 * pi * x); } },
+        { "sin",      "[-50, 50] rad",         -50.0, 50.0,         Spacing::lin, Metric::absolute,
+          [] (float x) { return fastmath::sin (x); },   [] (double x) { return std::sin (x); } },
+        { "cos",      "[-50, 50] rad",         -50.0, 50.0,         Spacing::lin, Metric::absolute,
+          [] (float x) { return fastmath::cos (x); },   [] (double x) { return std::cos (x); } },
+        { "tan",      "[0, 0.49 pi]",          0.0, 0.49 * pi,      Spacing::lin, Metric::relative,
+          [] (float x) { return fastmath::tan (x); },   [] (double x) { return std::tan (x); } },
+        { "tan",      "[2^-24, 0.49 pi] log",  0x1p-24, 0.49 * pi,  Spacing::log, Metric::relative,
+          [] (float x) { return fastmath::tan (x); },   [] (double x) { return std::tan (x); } },
+        { "tanh",     "[-10, 10]",             -10.0, 10.0,         Spacing::lin, Metric::absolute,
+          [] (float x) { return fastmath::tanh (x); },  [] (double x) { return std::tanh (x); } },
+        { "softClip", "[-10, 10]",             -10.0, 10.0,         Spacing::lin, Metric::absolute,
+          [] (float x) { return fastmath::softClip (x); }, [] (double x) { return std::tanh (x); } },
+    };
+
+    std::printf ("function      range                       max abs error    max rel error\n");
+    for (auto& row : rows)
+    {
+        char error[16];
+        std::snprintf (error, sizeof (error), "%.1e", measure (row));
+        std::printf ("%-13s %-27s %-16s %s\n", row.name, row.range,
+                     row.metric == Metric::absolute ? error : "-",
+                     row.metric == Metric::relative ? error : "-");
+    }
+    return 0;
+}
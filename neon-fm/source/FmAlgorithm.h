@@ -2,13 +2,17 @@
 
 #include <juce_core/juce_core.h>
 #include <array>
+#include <bit>
+#include <cstdint>
+#include <utility>
 #include <vector>
 
 namespace neon
 {
     /**
      * FmAlgorithm
-     * Defines the routing topology between 4 FM operators.
+     * Defines the routing topology between 4 FM operators. A 6-operator mode adds the 32
+     * DX7 algorithms, see FmAlgorithmRouter.
      * 
      * DX100-style algorithms for 4 operators with non-overlapping visual layout:
      * 
@@ -57,126 +61,201 @@ namespace neon
         return names;
     }
 
+    /** Display names of the 32 algorithms of the 6-operator mode, numbered as on a DX7. */
+    static inline std::vector<juce::String> getSixOpAlgorithmNames()
+    {
+        std::vector<juce::String> names;
+        for (int i = 1; i <= 32; ++i)
+            names.push_back ("DX " + juce::String (i));
+        return names;
+    }
+
     /**
-     * FmAlgorithmRouter
-     * Given 4 operator outputs, routes them according to the selected algorithm.
-     * 
-     * Usage: call processAlgorithm() each sample. It takes the base frequency,
-     * an array of 4 operator references, and returns the mixed output.
+     * FmRouting
+     * One algorithm as data: which operators modulate which, and which reach the output.
+     * Operators are 0-based; bit m of modulators[i] means operator m modulates operator i.
      */
-    struct FmAlgorithmRouter
+    struct FmRouting
     {
-        /**
-         * Process one sample through the selected algorithm.
-         * @param algo      The algorithm to use
-         * @param ops       Array of 4 FmOperator references
-         * @param baseFreq  The fundamental frequency for this voice
-         * @return           The mixed output sample
-         */
-        template <typename OpArray>
-        static float process (FmAlgorithmType algo, OpArray& ops, float baseFreq)
+        static constexpr int maxOperators = 6;
+
+        int numOperators = 4;
+        std::array<uint8_t, maxOperators> modulators {};
+        std::array<float, maxOperators> modScale { 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f }; // on the summed modulators
+        uint8_t carriers = 0;
+        float outputGain = 1.0f;
+        int feedbackOperator = -1; // the operator whose Feedback is live, -1 for all of them
+
+        constexpr bool isCarrier (int op) const noexcept { return (carriers >> op & 1) != 0; }
+
+        /** Operators in an order where every modulator runs before the operators it modulates. */
+        constexpr std::array<int, maxOperators> getEvaluationOrder() const
         {
-            float out = 0.0f;
+            std::array<int, maxOperators> order {};
+            uint32_t done = 0;
 
-            switch (algo)
+            for (int n = 0; n < numOperators; ++n)
             {
-                case FmAlgorithmType::SerialChain:
+                for (int op = 0; op < numOperators; ++op)
                 {
-                    // 1→2→3→4→out
-                    float o1 = ops[0].processSample (baseFreq);
-                    float o2 = ops[1].processSample (baseFreq, o1 * modDepth);
-                    float o3 = ops[2].processSample (baseFreq, o2 * modDepth);
-                    float o4 = ops[3].processSample (baseFreq, o3 * modDepth);
-                    out = o4;
-                    break;
+                    if ((done >> op & 1) == 0 && (modulators[(size_t)op] & ~done) == 0)
+                    {
+                        order[(size_t)n] = op;
+                        done |= 1u << op;
+                        break;
+                    }
                 }
+            }
 
-                case FmAlgorithmType::Branch:
-                {
-                    // 1→2→4, 3→4→out
-                    float o1 = ops[0].processSample (baseFreq);
-                    float o2 = ops[1].processSample (baseFreq, o1 * modDepth);
-                    float o3 = ops[2].processSample (baseFreq);
-                    float o4 = ops[3].processSample (baseFreq, (o2 + o3) * modDepth);
-                    out = o4;
-                    break;
-                }
+            return order;
+        }
 
-                case FmAlgorithmType::DualStack:
-                {
-                    // (1→2) + (3→4) → out
-                    float o1 = ops[0].processSample (baseFreq);
-                    float o2 = ops[1].processSample (baseFreq, o1 * modDepth);
-                    float o3 = ops[2].processSample (baseFreq);
-                    float o4 = ops[3].processSample (baseFreq, o3 * modDepth);
-                    out = (o2 + o4) * 0.5f;
-                    break;
-                }
+        // "65 54" reads as operator 6 modulates 5, 5 modulates 4; carriers "13" are operators 1 and 3
+        static constexpr FmRouting sixOp (const char* links, const char* carriers, int feedback)
+        {
+            FmRouting r;
+            r.numOperators = 6;
+            r.feedbackOperator = feedback - 1;
 
-                case FmAlgorithmType::TripleCarrier:
+            for (const char* c = links; *c != 0; ++c)
+            {
+                if (*c != ' ')
                 {
-                    // 1,2,3 → 4 → out
-                    float o1 = ops[0].processSample (baseFreq);
-                    float o2 = ops[1].processSample (baseFreq);
-                    float o3 = ops[2].processSample (baseFreq);
-                    float o4 = ops[3].processSample (baseFreq, (o1 + o2 + o3) * modDepth * 0.333f);
-                    out = o4;
-                    break;
+                    r.modulators[(size_t)(c[1] - '1')] |= (uint8_t)(1 << (c[0] - '1'));
+                    ++c;
                 }
+            }
 
-                case FmAlgorithmType::OneToMany:
-                {
-                    // 1 → (2, 3, 4) → out
-                    float o1 = ops[0].processSample (baseFreq);
-                    float o2 = ops[1].processSample (baseFreq, o1 * modDepth);
-                    float o3 = ops[2].processSample (baseFreq, o1 * modDepth);
-                    float o4 = ops[3].processSample (baseFreq, o1 * modDepth);
-                    out = (o2 + o3 + o4) * 0.333f;
-                    break;
-                }
+            int numCarriers = 0;
+            for (const char* c = carriers; *c != 0; ++c, ++numCarriers)
+                r.carriers |= (uint8_t)(1 << (*c - '1'));
 
-                case FmAlgorithmType::ParallelDual:
-                {
-                    // (1→2) + 3 + 4 → out
-                    float o1 = ops[0].processSample (baseFreq);
-                    float o2 = ops[1].processSample (baseFreq, o1 * modDepth);
-                    float o3 = ops[2].processSample (baseFreq);
-                    float o4 = ops[3].processSample (baseFreq);
-                    out = (o2 + o3 + o4) * 0.333f;
-                    break;
-                }
+            r.outputGain = 1.0f / (float)numCarriers;
+            return r;
+        }
 
-                case FmAlgorithmType::ComplexFork:
-                {
-                    // 1→2, 1→3, 2,3→4→out
-                    float o1 = ops[0].processSample (baseFreq);
-                    float o2 = ops[1].processSample (baseFreq, o1 * modDepth);
-                    float o3 = ops[2].processSample (baseFreq, o1 * modDepth);
-                    float o4 = ops[3].processSample (baseFreq, (o2 + o3) * modDepth * 0.5f);
-                    out = o4;
-                    break;
-                }
+        static constexpr FmRouting fourOp (std::array<uint8_t, 4> modulators, uint8_t carriers, float outputGain,
+                                           std::array<float, 4> modScale = { 1.0f, 1.0f, 1.0f, 1.0f })
+        {
+            FmRouting r;
+            for (size_t i = 0; i < 4; ++i)
+            {
+                r.modulators[i] = modulators[i];
+                r.modScale[i] = modScale[i];
+            }
+            r.carriers = carriers;
+            r.outputGain = outputGain;
+            return r;
+        }
+    };
 
-                case FmAlgorithmType::FullParallel:
-                {
-                    // 1 + 2 + 3 + 4 → out (additive)
-                    float o1 = ops[0].processSample (baseFreq);
-                    float o2 = ops[1].processSample (baseFreq);
-                    float o3 = ops[2].processSample (baseFreq);
-                    float o4 = ops[3].processSample (baseFreq);
-                    out = (o1 + o2 + o3 + o4) * 0.25f;
-                    break;
-                }
+    /**
+     * FmAlgorithmRouter
+     * Runs the operators of a voice through an algorithm for one sample. Every algorithm is
+     * its own kernel: the routing is a compile-time constant, so the modulator sums, scales
+     * and carrier mix are unrolled into straight-line code with no switch per sample. Pick
+     * the kernel once per block and keep it:
+     *
+     *     const int kernel = FmAlgorithmRouter::getKernel (sixOp, algorithm); // per block
+     *     float out = FmAlgorithmRouter::process<Kernel> (ops, baseFreq);    // per sample, in a loop
+     *                                                                         // instantiated per kernel
+     * Kernels 0-7 are the 4-operator algorithms in FmAlgorithmType order, 8-39 the 32
+     * algorithms of the 6-operator mode, DX7 numbering and operator order (operator 1 is
+     * always a carrier; the DX7 feedback loops of algorithms 4 and 6 are approximated by
+     * self-feedback on the loop's last operator).
+     */
+    struct FmAlgorithmRouter
+    {
+        static constexpr int numFourOpAlgorithms = (int)FmAlgorithmType::Count;
+        static constexpr int numSixOpAlgorithms = 32;
+        static constexpr int numKernels = numFourOpAlgorithms + numSixOpAlgorithms;
 
-                default:
-                    out = ops[3].processSample (baseFreq);
-                    break;
-            }
+        static constexpr float modDepth = juce::MathConstants<float>::twoPi;
 
-            return out;
+        static constexpr int getKernel (bool sixOp, int algorithm) noexcept
+        {
+            return sixOp ? numFourOpAlgorithms + juce::jlimit (0, numSixOpAlgorithms - 1, algorithm)
+                         : juce::jlimit (0, numFourOpAlgorithms - 1, algorithm);
         }
 
-        static constexpr float modDepth = juce::MathConstants<float>::twoPi;
+        static constexpr const FmRouting& getRouting (int kernel) noexcept { return routings[(size_t)kernel]; }
+
+        template <int Kernel, typename OpArray>
+        static float process (OpArray& ops, float baseFreq)
+        {
+            constexpr auto& routing = routings[(size_t)Kernel];
+
+            std::array<float, FmRouting::maxOperators> out;
+            processOperators<Kernel> (ops, baseFreq, out.data(), std::make_index_sequence<(size_t)routing.numOperators>());
+
+            if constexpr (routing.outputGain == 1.0f)
+                return sum<routing.carriers> (out.data());
+            else
+                return sum<routing.carriers> (out.data()) * routing.outputGain;
+        }
+
+    private:
+        static constexpr std::array<FmRouting, numKernels> routings {
+            // 4-operator, the modulators below the operators they modulate
+            FmRouting::fourOp ({ 0, 0b0001, 0b0010, 0b0100 }, 0b1000, 1.0f),                         // 1→2→3→4
+            FmRouting::fourOp ({ 0, 0b0001, 0, 0b0110 }, 0b1000, 1.0f),                              // 1→2→4, 3→4
+            FmRouting::fourOp ({ 0, 0b0001, 0, 0b0100 }, 0b1010, 0.5f),                              // (1→2) + (3→4)
+            FmRouting::fourOp ({ 0, 0, 0, 0b0111 }, 0b1000, 1.0f, { 1.0f, 1.0f, 1.0f, 0.333f }),     // 1,2,3→4
+            FmRouting::fourOp ({ 0, 0b0001, 0b0001, 0b0001 }, 0b1110, 0.333f),                       // 1→(2,3,4)
+            FmRouting::fourOp ({ 0, 0b0001, 0, 0 }, 0b1110, 0.333f),                                 // (1→2) + 3 + 4
+            FmRouting::fourOp ({ 0, 0b0001, 0b0001, 0b0110 }, 0b1000, 1.0f, { 1.0f, 1.0f, 1.0f, 0.5f }), // 1→2,3→4
+            FmRouting::fourOp ({ 0, 0, 0, 0 }, 0b1111, 0.25f),                                       // 1+2+3+4
+
+            // 6-operator, DX7 algorithms 1-32
+            FmRouting::sixOp ("65 54 43 21", "13", 6),       FmRouting::sixOp ("65 54 43 21", "13", 2),
+            FmRouting::sixOp ("65 54 32 21", "14", 6),       FmRouting::sixOp ("65 54 32 21", "14", 4),
+            FmRouting::sixOp ("65 43 21", "135", 6),         FmRouting::sixOp ("65 43 21", "135", 5),
+            FmRouting::sixOp ("65 53 43 21", "13", 6),       FmRouting::sixOp ("65 53 43 21", "13", 4),
+            FmRouting::sixOp ("65 53 43 21", "13", 2),       FmRouting::sixOp ("54 64 32 21", "14", 3),
+            FmRouting::sixOp ("54 64 32 21", "14", 6),       FmRouting::sixOp ("43 53 63 21", "13", 2),
+            FmRouting::sixOp ("43 53 63 21", "13", 6),       FmRouting::sixOp ("54 64 43 21", "13", 6),
+            FmRouting::sixOp ("54 64 43 21", "13", 2),       FmRouting::sixOp ("21 31 43 51 65", "1", 6),
+            FmRouting::sixOp ("21 31 43 51 65", "1", 2),     FmRouting::sixOp ("21 31 41 54 65", "1", 3),
+            FmRouting::sixOp ("32 21 64 65", "145", 6),      FmRouting::sixOp ("31 32 54 64", "124", 3),
+            FmRouting::sixOp ("31 32 64 65", "1245", 3),     FmRouting::sixOp ("21 63 64 65", "1345", 6),
+            FmRouting::sixOp ("32 64 65", "1245", 6),        FmRouting::sixOp ("63 64 65", "12345", 6),
+            FmRouting::sixOp ("64 65", "12345", 6),          FmRouting::sixOp ("32 54 64", "124", 6),
+            FmRouting::sixOp ("32 54 64", "124", 3),         FmRouting::sixOp ("21 43 54", "136", 5),
+            FmRouting::sixOp ("43 65", "1235", 6),           FmRouting::sixOp ("43 54", "1236", 5),
+            FmRouting::sixOp ("65", "12345", 6),             FmRouting::sixOp ("", "123456", 6)
+        };
+
+        template <int Kernel, typename OpArray, size_t... Order>
+        static void processOperators (OpArray& ops, float baseFreq, float* out, std::index_sequence<Order...>)
+        {
+            constexpr auto order = routings[(size_t)Kernel].getEvaluationOrder();
+            (processOperator<Kernel, order[Order]> (ops, baseFreq, out), ...);
+        }
+
+        template <int Kernel, int Op, typename OpArray>
+        static void processOperator (OpArray& ops, float baseFreq, float* out)
+        {
+            constexpr auto& routing = routings[(size_t)Kernel];
+            constexpr uint8_t modulators = routing.modulators[(size_t)Op];
+
+            if constexpr (modulators == 0)
+                out[Op] = ops[Op].processSample (baseFreq);
+            else
+                out[Op] = ops[Op].processSample (baseFreq, sum<modulators> (out) * modDepth * routing.modScale[(size_t)Op]);
+        }
+
+        /** Left-to-right sum of the outputs picked by Mask. */
+        template <uint32_t Mask>
+        static float sum (const float* out) noexcept
+        {
+            static_assert (Mask != 0);
+            constexpr int last = std::bit_width (Mask) - 1;
+
+            if constexpr ((Mask & (Mask - 1)) == 0)
+                return out[last];
+            else
+                return sum<Mask ^ (1u << last)> (out) + out[last];
+        }
     };
 
 } // namespace neon
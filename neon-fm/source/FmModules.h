@@ -18,32 +18,37 @@ namespace neon
     class FmOperatorModule : public ModuleBase
     {
     public:
-        FmOperatorModule (const juce::String& name, const juce::Colour& color, int opIndex)
-            : ModuleBase (name, color), operatorIndex (opIndex)
+        FmOperatorModule (NeonInstance& instance, const juce::String& name, const juce::Colour& color, int opIndex)
+            : ModuleBase (instance, name, color), operatorIndex (opIndex)
+        {
+            addParameters (*this, opIndex);
+
+            lastAdjustedIndex = 0;
+        }
+
+        static void addParameters (ParameterLayout& layout, int opIndex)
         {
             // Page 1, Row 1: Waveform, Ratio, Detune, Level
-            addChoiceParameter ("Waveform", { "Sine", "Triangle", "Saw", "Square" }, 0);
+            layout.addChoiceParameter ("Waveform", { "Sine", "Triangle", "Saw", "Square" }, 0);
 
             // Ratio: DX7-style snapping to 0.5 increments (0.5, 1.0, 1.5, ..., 16.0)
-            addParameter ("Ratio", 0.5f, 16.0f, getDefaultRatio (opIndex), false, 0.5f, false, true);
+            layout.addParameter ("Ratio", 0.5f, 16.0f, getDefaultRatio (opIndex), false, 0.5f, false, true);
 
-            addParameter ("Detune", -50.0f, 50.0f, 0.0f, false, 0.0f, false, true);
-            addParameter ("Level", 0.0f, 1.0f, getDefaultLevel (opIndex));
+            layout.addParameter ("Detune", -50.0f, 50.0f, 0.0f, false, 0.0f, false, true);
+            layout.addParameter ("Level", 0.0f, 1.0f, getDefaultLevel (opIndex));
 
             // Page 1, Row 2: Feedback, Velocity, KeySync, [spacer]
-            addParameter ("Feedback", 0.0f, 1.0f, 0.0f);
-            addParameter ("Velocity", 0.0f, 1.0f, 0.5f);
-            addParameter ("KeySync", 0.0f, 1.0f, 1.0f, true);
-            if (auto* p = parameters.back()) p->setBinaryLabels ("FREE", "SYNC");
-            addSpacer();
+            layout.addParameter ("Feedback", 0.0f, 1.0f, 0.0f);
+            layout.addParameter ("Velocity", 0.0f, 1.0f, 0.5f);
+            if (auto* p = layout.addParameter ("KeySync", 0.0f, 1.0f, 1.0f, true))
+                p->setBinaryLabels ("FREE", "SYNC");
+            layout.addSpacer();
 
             // Page 2, Row 1: Attack, Decay, Sustain, Release (operator envelope)
-            addParameter ("Attack",  0.0f, 10000.0f, 10.0f);
-            addParameter ("Decay",   0.0f, 10000.0f, 500.0f);
-            addParameter ("Sustain", 0.0f, 1.0f, 0.7f);
-            addParameter ("Release", 0.0f, 10000.0f, 500.0f);
-
-            lastAdjustedIndex = 0;
+            layout.addParameter ("Attack",  0.0f, 10000.0f, 10.0f);
+            layout.addParameter ("Decay",   0.0f, 10000.0f, 500.0f);
+            layout.addParameter ("Sustain", 0.0f, 1.0f, 0.7f);
+            layout.addParameter ("Release", 0.0f, 10000.0f, 500.0f);
         }
 
     protected:
@@ -152,23 +157,16 @@ namespace neon
     /**
      * FmAlgorithmModule
      * UI module that displays and selects the FM algorithm routing.
-     * Shows a visual diagram of the operator connections.
+     * Shows a visual diagram of the operator connections. In the 6-operator mode the
+     * diagram is drawn from the DX algorithm's FmRouting.
      */
     class FmAlgorithmModule : public ModuleBase
     {
     public:
-        FmAlgorithmModule (const juce::String& name, const juce::Colour& color)
-            : ModuleBase (name, color)
+        FmAlgorithmModule (NeonInstance& instance, const juce::String& name, const juce::Colour& color)
+            : ModuleBase (instance, name, color)
         {
-            addChoiceParameter ("Algorithm", getAlgorithmNames(), 0);
-            addSpacer();
-            addSpacer();
-            addSpacer();
-
-            addSpacer();
-            addSpacer();
-            addSpacer();
-            addSpacer();
+            addParameters (*this);
 
             lastAdjustedIndex = 0;
 
@@ -186,6 +184,21 @@ namespace neon
             algoDrawables[7] = loadSvg(BinaryData::algo_8_fullparallel_svg, BinaryData::algo_8_fullparallel_svgSize);
         }
 
+        static void addParameters (ParameterLayout& layout)
+        {
+            // Row 1: 4-operator algorithm, operator mode, 6-operator algorithm
+            layout.addChoiceParameter ("Algorithm", getAlgorithmNames(), 0);
+            if (auto* p = layout.addParameter ("Operators", 0.0f, 1.0f, 0.0f, true))
+                p->setBinaryLabels ("4-OP", "6-OP");
+            layout.addChoiceParameter ("DX Algorithm", getSixOpAlgorithmNames(), 0);
+            layout.addSpacer();
+
+            layout.addSpacer();
+            layout.addSpacer();
+            layout.addSpacer();
+            layout.addSpacer();
+        }
+
     protected:
         std::unique_ptr<juce::Drawable> algoDrawables[8];
 
@@ -197,6 +210,12 @@ namespace neon
             g.setColour (accentColor.withAlpha (0.06f));
             g.fillRoundedRectangle (r, 8.0f);
 
+            if (parameters[1]->getValue() > 0.5f)
+            {
+                paintRouting (g, r.reduced (20.0f), FmAlgorithmRouter::getRouting (FmAlgorithmRouter::getKernel (true, (int) parameters[2]->getValue())));
+                return;
+            }
+
             // Draw the SVG diagram making full use of the remaining area
             if (algo >= 0 && algo < 8 && algoDrawables[algo] != nullptr)
             {
@@ -211,6 +230,80 @@ namespace neon
                 algoDrawables[algo]->drawWithin (g, svgBounds, juce::RectanglePlacement::centred | juce::RectanglePlacement::onlyReduceInSize, 1.0f);
             }
         }
+
+        void paintRouting (juce::Graphics& g, juce::Rectangle<float> r, const FmRouting& routing)
+        {
+            // Carriers sit on the bottom row, every modulator one row above the highest operator it modulates
+            const int n = routing.numOperators;
+            int row[FmRouting::maxOperators] = {};
+            for (int pass = 0; pass < n; ++pass)
+                for (int op = 0; op < n; ++op)
+                    for (int target = 0; target < n; ++target)
+                        if ((routing.modulators[(size_t) target] >> op & 1) != 0)
+                            row[op] = juce::jmax (row[op], row[target] + 1);
+
+            int numRows = 1;
+            for (int op = 0; op < n; ++op)
+                numRows = juce::jmax (numRows, row[op] + 1);
+
+            // Operators of a row spread evenly, in operator order
+            juce::Rectangle<float> boxes[FmRouting::maxOperators];
+            const float rowH = (r.getHeight() - 30.0f) / (float) numRows;
+            const float boxSize = juce::jmin (44.0f, rowH * 0.6f);
+
+            for (int rw = 0; rw < numRows; ++rw)
+            {
+                int count = 0, index = 0;
+                for (int op = 0; op < n; ++op)
+                    if (row[op] == rw) ++count;
+
+                for (int op = 0; op < n; ++op)
+                {
+                    if (row[op] != rw)
+                        continue;
+
+                    const float cx = r.getX() + r.getWidth() * (float) (index++ + 1) / (float) (count + 1);
+                    const float cy = r.getY() + rowH * ((float) (numRows - 1 - rw) + 0.5f);
+                    boxes[op] = juce::Rectangle<float> (boxSize, boxSize).withCentre ({ cx, cy });
+                }
+            }
+
+            g.setColour (accentColor.withAlpha (0.5f));
+            for (int target = 0; target < n; ++target)
+                for (int op = 0; op < n; ++op)
+                    if ((routing.modulators[(size_t) target] >> op & 1) != 0)
+                        g.drawLine ({ boxes[op].getCentreX(), boxes[op].getBottom(), boxes[target].getCentreX(), boxes[target].getY() }, 2.0f);
+
+            // Carriers run down into the output bus
+            const float busY = r.getBottom() - 10.0f;
+            float busLeft = r.getRight(), busRight = r.getX();
+            for (int op = 0; op < n; ++op)
+            {
+                if (! routing.isCarrier (op))
+                    continue;
+
+                g.drawLine (boxes[op].getCentreX(), boxes[op].getBottom(), boxes[op].getCentreX(), busY, 2.0f);
+                busLeft = juce::jmin (busLeft, boxes[op].getCentreX());
+                busRight = juce::jmax (busRight, boxes[op].getCentreX());
+            }
+            g.drawLine (busLeft, busY, busRight, busY, 2.0f);
+
+            for (int op = 0; op < n; ++op)
+            {
+                g.setColour (routing.isCarrier (op) ? juce::Colours::hotpink : accentColor);
+                g.fillRoundedRectangle (boxes[op], 6.0f);
+                g.setColour (juce::Colours::black);
+                g.setFont (juce::FontOptions (18.0f));
+                g.drawText (juce::String (op + 1), boxes[op], juce::Justification::centred);
+
+                // Feedback loop marker on the operator whose Feedback is live
+                if (op == routing.feedbackOperator)
+                {
+                    g.setColour (accentColor);
+                    g.drawRoundedRectangle (boxes[op].expanded (5.0f), 8.0f, 1.5f);
+                }
+            }
+        }
     };
 
     /**
@@ -221,22 +314,27 @@ namespace neon
     class FmFilterEnvModule : public ModuleBase
     {
     public:
-        FmFilterEnvModule (const juce::String& name, const juce::Colour& color)
-            : ModuleBase (name, color)
+        FmFilterEnvModule (NeonInstance& instance, const juce::String& name, const juce::Colour& color)
+            : ModuleBase (instance, name, color)
+        {
+            addParameters (*this);
+
+            lastAdjustedIndex = 0;
+        }
+
+        static void addParameters (ParameterLayout& layout)
         {
             // Row 1: Attack, Decay, Sustain, Release
-            addParameter ("Attack",  0.0f, 10000.0f, 10.0f);
-            addParameter ("Decay",   0.0f, 10000.0f, 300.0f);
-            addParameter ("Sustain", 0.0f, 1.0f,     0.0f);
-            addParameter ("Release", 0.0f, 10000.0f, 300.0f);
+            layout.addParameter ("Attack",  0.0f, 10000.0f, 10.0f);
+            layout.addParameter ("Decay",   0.0f, 10000.0f, 300.0f);
+            layout.addParameter ("Sustain", 0.0f, 1.0f,     0.0f);
+            layout.addParameter ("Release", 0.0f, 10000.0f, 300.0f);
 
             // Row 2: Amount (bipolar), spacers
-            addParameter ("Amount", -100.0f, 100.0f, 0.0f, false, 0.0f, false, true);
-            addSpacer();
-            addSpacer();
-            addSpacer();
-
-            lastAdjustedIndex = 0;
+            layout.addParameter ("Amount", -100.0f, 100.0f, 0.0f, false, 0.0f, false, true);
+            layout.addSpacer();
+            layout.addSpacer();
+            layout.addSpacer();
         }
 
     protected:
@@ -333,23 +431,28 @@ namespace neon
     class FmFilterModule : public ModuleBase
     {
     public:
-        FmFilterModule (const juce::String& name, const juce::Colour& color)
-            : ModuleBase (name, color)
+        FmFilterModule (NeonInstance& instance, const juce::String& name, const juce::Colour& color)
+            : ModuleBase (instance, name, color)
         {
-            addChoiceParameter ("Type", { "Low Pass", "High Pass", "Band Pass" }, 0);
-            addParameter ("Cutoff", 20.0f, 20000.0f, 20000.0f);
-            addParameter ("Res", 0.0f, 1.0f, 0.0f);
-            addParameter ("Slope", 0.0f, 1.0f, 1.0f, true);
-            if (auto* p = parameters.back()) p->setBinaryLabels ("12dB", "24dB");
-
-            addParameter ("KeyTrack", 0.0f, 1.0f, 0.0f, false, 0.0f, false, true);
-            addSpacer();
-            addSpacer();
-            addSpacer();
+            addParameters (*this);
 
             lastAdjustedIndex = 0;
         }
 
+        static void addParameters (ParameterLayout& layout)
+        {
+            layout.addChoiceParameter ("Type", { "Low Pass", "High Pass", "Band Pass" }, 0);
+            layout.addParameter ("Cutoff", 20.0f, 20000.0f, 20000.0f);
+            layout.addParameter ("Res", 0.0f, 1.0f, 0.0f);
+            if (auto* p = layout.addParameter ("Slope", 0.0f, 1.0f, 1.0f, true))
+                p->setBinaryLabels ("12dB", "24dB");
+
+            layout.addParameter ("KeyTrack", 0.0f, 1.0f, 0.0f, false, 0.0f, false, true);
+            layout.addSpacer();
+            layout.addSpacer();
+            layout.addSpacer();
+        }
+
     protected:
         void paintVisualization (juce::Graphics& g, juce::Rectangle<int> area) override
         {
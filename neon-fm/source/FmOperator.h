@@ -2,6 +2,7 @@
 
 #include <juce_audio_basics/juce_audio_basics.h>
 #include <juce_dsp/juce_dsp.h>
+#include <neon_ui_components/dsp/NeonFastMath.h>
 #include <cmath>
 
 namespace neon
@@ -124,7 +125,7 @@ namespace neon
             switch (waveform)
             {
                 case Waveform::Sine:
-                    return std::sin (p * juce::MathConstants<float>::twoPi);
+                    return fastmath::sin2pi (p);
 
                 case Waveform::Triangle:
                 {
@@ -156,7 +157,7 @@ namespace neon
                 }
 
                 default:
-                    return std::sin (p * juce::MathConstants<float>::twoPi);
+                    return fastmath::sin2pi (p);
             }
         }
 
@@ -0,0 +1,39 @@
+#pragma once
+#include <neon_ui_components/neon_ui_components.h>
+#include <neon_ui_components/modules/LfoModule.h>
+#include <neon_ui_components/modules/FxModule.h>
+#include <neon_ui_components/modules/ControlModule.h>
+#include "FmModules.h"
+
+namespace neon
+{
+    /**
+     * addNeonFmParameters
+     * Every Neon FM parameter, registered by the processor before the first patch loads.
+     * All six operators exist even in 4-OP mode, so switching modes keeps their settings.
+     */
+    static inline void addNeonFmParameters (NeonInstance& instance)
+    {
+        auto& registry = instance.getParameterRegistry();
+        const auto& names = instance.getRegistry();
+
+        { ParameterLayout l (registry, "Algorithm");  FmAlgorithmModule::addParameters (l); }
+        { ParameterLayout l (registry, "Op 1");       FmOperatorModule::addParameters (l, 0); }
+        { ParameterLayout l (registry, "Op 2");       FmOperatorModule::addParameters (l, 1); }
+        { ParameterLayout l (registry, "Op 3");       FmOperatorModule::addParameters (l, 2); }
+        { ParameterLayout l (registry, "Op 4");       FmOperatorModule::addParameters (l, 3); }
+        { ParameterLayout l (registry, "Op 5");       FmOperatorModule::addParameters (l, 4); }
+        { ParameterLayout l (registry, "Op 6");       FmOperatorModule::addParameters (l, 5); }
+        { ParameterLayout l (registry, "Filter");     FmFilterModule::addParameters (l); }
+        { ParameterLayout l (registry, "Filter Env"); FmFilterEnvModule::addParameters (l); }
+        { ParameterLayout l (registry, "Amp Output"); AmpModule::addParameters (l); }
+        { ParameterLayout l (registry, "Amp Env");    DahdsrModule::addParameters (l); }
+        { ParameterLayout l (registry, "LFO 1");      LfoModule::addParameters (l, names); }
+        { ParameterLayout l (registry, "LFO 2");      LfoModule::addParameters (l, names); }
+        { ParameterLayout l (registry, "FX");         FxModule::addParameters (l); }
+        { ParameterLayout l (registry, "Control");    ControlModule::addParameters (l); }
+        { ParameterLayout l (registry, "Librarian");  LibrarianModule::addParameters (l); }
+
+        registry.setLayoutComplete();
+    }
+}
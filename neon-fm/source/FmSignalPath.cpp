@@ -5,17 +5,10 @@
 
 namespace neon
 {
-    // Fast tanh approximation
-    inline float fastTanh (float x)
-    {
-        if (x < -3.0f) return -1.0f;
-        if (x > 3.0f) return 1.0f;
-        float x2 = x * x;
-        return x * (27.0f + x2) / (27.0f + 9.0f * x2);
-    }
-
-    FmSignalPath::FmSignalPath() : registry (ParameterRegistry::getInstance())
+    FmSignalPath::FmSignalPath (NeonInstance& instance) : registry (instance.getParameterRegistry())
     {
+        renderPool = RenderPool::getShared();
+        bindParameters();
     }
 
     void FmSignalPath::prepareToPlay (int samplesPerBlockExpected, double sr)
@@ -29,6 +22,12 @@ namespace neon
         oversampledRate = sr * (1 << oversamplingOrder);
         int osBlockSize = samplesPerBlockExpected * (1 << oversamplingOrder);
         osBuffer.setSize (2, osBlockSize);
+        voiceBuffers.setSize (numVoices * 3, osBlockSize);
+
+        uint32_t lfoSeed = 1;
+        for (auto& state : voiceLfoStates)
+            for (auto& l : state.lfos)
+                l.setSeed (lfoSeed++ * 0x9e3779b9u);
 
         juce::dsp::ProcessSpec spec;
         spec.sampleRate = sr;
@@ -56,6 +55,10 @@ namespace neon
             v.ampEnv.setSampleRate (oversampledRate);
             v.filterEnv.setSampleRate (oversampledRate);
         }
+
+        // Delay length and filter coefficients depend on the sample rate
+        watches.invalidate();
+        smoothers.prepare (sr);
     }
 
     void FmSignalPath::releaseResources() {}
@@ -118,8 +121,10 @@ namespace neon
             currentPortaFreq = freq;
             lastMonoNote = midiNote;
 
-            // Set up operators
-            for (int i = 0; i < 4; ++i)
+            // Set up operators; in the 6-operator mode only the algorithm's feedback operator feeds back
+            const int feedbackOp = FmAlgorithmRouter::getRouting (currentKernel).feedbackOperator;
+
+            for (int i = 0; i < numOperators; ++i)
             {
                 auto& op = voiceToUse->ops[i];
                 auto& gs = globalOps[i];
@@ -128,7 +133,7 @@ namespace neon
                 op.ratio = gs.ratio;
                 op.detuneHz = gs.detune;
                 op.level = gs.level;
-                op.feedback = gs.feedback;
+                op.feedback = feedbackOp < 0 || feedbackOp == i ? gs.feedback : 0.0f;
                 op.keySync = gs.keySync;
                 op.velocitySens = gs.velocitySens;
 
@@ -150,10 +155,7 @@ namespace neon
 
             // Reset LFO states for this voice
             for (int i = 0; i < 2; ++i)
-            {
-                if (globalLfos[i].keySync)
-                    voiceLfoStates[voiceIdx].lfos[i].reset (globalLfos[i].phaseStart);
-            }
+                voiceLfoStates[voiceIdx].lfos[i].noteOn (globalLfos[i].phaseStart, globalLfos[i].keySync);
         }
     }
 
@@ -195,131 +197,252 @@ namespace neon
     // ============================================================
     // Parameter polling
     // ============================================================
-    void FmSignalPath::updateParams()
+    void FmSignalPath::bindParameters()
     {
-        auto getVal = [this] (const juce::String& path, float fallback = 0.0f) {
-            if (auto* p = registry.getParameter (path))
-                return p->getValue();
-            return fallback;
-        };
-
-        // Algorithm
-        currentAlgorithm = (FmAlgorithmType)(int) getVal ("Algorithm/Algorithm", 0.0f);
+        handles.algorithm      = registry.getHandle ("Algorithm", "Algorithm", 0.0f);
+        handles.operators      = registry.getHandle ("Algorithm", "Operators", 0.0f);
+        handles.sixOpAlgorithm = registry.getHandle ("Algorithm", "DX Algorithm", 0.0f);
 
-        // Operators 1-4
-        for (int i = 0; i < 4; ++i)
+        for (int i = 0; i < numOperators; ++i)
         {
             auto name = "Op " + juce::String (i + 1);
-            auto& gs = globalOps[i];
+            auto& h = handles.ops[(size_t) i];
+
+            h.waveform = registry.getHandle (name, "Waveform", 0.0f);
+            h.ratio    = registry.getHandle (name, "Ratio", 1.0f);
+            h.detune   = registry.getHandle (name, "Detune", 0.0f);
+            h.level    = registry.getHandle (name, "Level", i == 3 ? 1.0f : 0.8f);
+            h.feedback = registry.getHandle (name, "Feedback", 0.0f);
+            h.velocity = registry.getHandle (name, "Velocity", 0.5f);
+            h.keySync  = registry.getHandle (name, "KeySync", 1.0f);
+            h.env.attack  = registry.getHandle (name, "Attack", 10.0f);
+            h.env.decay   = registry.getHandle (name, "Decay", 500.0f);
+            h.env.sustain = registry.getHandle (name, "Sustain", 0.7f);
+            h.env.release = registry.getHandle (name, "Release", 500.0f);
+        }
+
+        handles.filterType     = registry.getHandle ("Filter", "Type", 0.0f);
+        handles.filterCutoff   = registry.getHandle ("Filter", "Cutoff", 20000.0f);
+        handles.filterRes      = registry.getHandle ("Filter", "Res", 0.0f);
+        handles.filterKeyTrack = registry.getHandle ("Filter", "KeyTrack", 0.0f);
+        handles.filterSlope    = registry.getHandle ("Filter", "Slope", 1.0f);
+
+        handles.filterEnv.attack  = registry.getHandle ("Filter Env", "Attack", 10.0f);
+        handles.filterEnv.decay   = registry.getHandle ("Filter Env", "Decay", 300.0f);
+        handles.filterEnv.sustain = registry.getHandle ("Filter Env", "Sustain", 0.0f);
+        handles.filterEnv.release = registry.getHandle ("Filter Env", "Release", 300.0f);
+        handles.filterEnvAmount   = registry.getHandle ("Filter Env", "Amount", 0.0f);
+
+        handles.ampLevel    = registry.getHandle ("Amp Output", "Level", 0.8f);
+        handles.ampVelocity = registry.getHandle ("Amp Output", "Velocity", 0.5f);
+
+        handles.ampEnv.attack  = registry.getHandle ("Amp Env", "Attack", 10.0f);
+        handles.ampEnv.decay   = registry.getHandle ("Amp Env", "Decay", 500.0f);
+        handles.ampEnv.sustain = registry.getHandle ("Amp Env", "Sustain", 0.7f);
+        handles.ampEnv.release = registry.getHandle ("Amp Env", "Release", 500.0f);
+
+        for (int l = 0; l < 2; ++l)
+        {
+            auto name = "LFO " + juce::String (l + 1);
+            auto& h = handles.lfos[(size_t) l];
+
+            h.shape    = registry.getHandle (name, "Shape", 0.0f);
+            h.sync     = registry.getHandle (name, "Sync", 0.0f);
+            h.rateHz   = registry.getHandle (name, "Rate Hz", 1.0f);
+            h.rateNote = registry.getHandle (name, "Rate Note", 4.0f);
+            h.keySync  = registry.getHandle (name, "KeySync", 1.0f);
+            h.phase    = registry.getHandle (name, "Phase", 0.0f);
+
+            for (int i = 0; i < 4; ++i)
+            {
+                h.slotTarget[i] = registry.getHandle (name, "Slot " + juce::String (i + 1) + " Target", 0.0f);
+                h.slotAmount[i] = registry.getHandle (name, "Slot " + juce::String (i + 1) + " Amount", 0.0f);
+            }
+        }
 
-            gs.waveform     = (int) getVal (name + "/Waveform", 0.0f);
-            gs.ratio        = getVal (name + "/Ratio", 1.0f);
-            gs.detune       = getVal (name + "/Detune", 0.0f);
-            gs.level        = getVal (name + "/Level", i == 3 ? 1.0f : 0.8f);
-            gs.feedback     = getVal (name + "/Feedback", 0.0f);
-            gs.velocitySens = getVal (name + "/Velocity", 0.5f);
-            gs.keySync      = getVal (name + "/KeySync", 1.0f) > 0.5f;
+        handles.pbRange   = registry.getHandle ("Control", "PB Range", 2.0f);
+        handles.voiceMode = registry.getHandle ("Control", "Mode", 0.0f);
+        handles.portaOn   = registry.getHandle ("Control", "Porta On", 0.0f);
+        handles.portaTime = registry.getHandle ("Control", "Porta Time", 100.0f);
+
+        handles.fxModType     = registry.getHandle ("FX", "Mod Type", 1.0f);
+        handles.fxModRate     = registry.getHandle ("FX", "Mod Rate", 1.0f);
+        handles.fxModDepth    = registry.getHandle ("FX", "Mod Depth", 0.5f);
+        handles.fxModFeedback = registry.getHandle ("FX", "Mod Feedback", 0.0f);
+        handles.fxModMix      = registry.getHandle ("FX", "Mod Mix", 0.0f);
+        handles.fxDlyTime     = registry.getHandle ("FX", "Dly Time", 400.0f);
+        handles.fxDlyNote     = registry.getHandle ("FX", "Dly Note", 4.0f);
+        handles.fxDlyFeedback = registry.getHandle ("FX", "Dly FB", 0.3f);
+        handles.fxDlyMix      = registry.getHandle ("FX", "Dly Mix", 0.0f);
+        handles.fxDlySync     = registry.getHandle ("FX", "Dly Sync", 0.0f);
+        handles.fxRvbSize     = registry.getHandle ("FX", "Rvb Size", 0.5f);
+        handles.fxRvbDamp     = registry.getHandle ("FX", "Rvb Damp", 0.5f);
+        handles.fxRvbMix      = registry.getHandle ("FX", "Rvb Mix", 0.0f);
+
+        watches.algorithm = registry.watchGroup ("Algorithm");
+        for (int i = 0; i < numOperators; ++i)
+            watches.ops[(size_t) i] = registry.watchGroup ("Op " + juce::String (i + 1));
+        watches.filter    = registry.watchGroup ("Filter");
+        watches.filterEnv = registry.watchGroup ("Filter Env");
+        watches.ampOutput = registry.watchGroup ("Amp Output");
+        watches.ampEnv    = registry.watchGroup ("Amp Env");
+        watches.lfos[0]   = registry.watchGroup ("LFO 1");
+        watches.lfos[1]   = registry.watchGroup ("LFO 2");
+        watches.control   = registry.watchGroup ("Control");
+        watches.fx        = registry.watchGroup ("FX");
+    }
+
+    void FmSignalPath::updateParams()
+    {
+        auto getVal = [this] (ParameterHandle h) { return registry.getValue (h); };
 
-            float sustain = getVal (name + "/Sustain", 0.7f);
+        auto readEnv = [&] (const EnvHandles& h) {
+            float sustain = getVal (h.sustain);
             if (sustain < 0.001f) sustain = 0.001f;
 
-            gs.envParams = juce::ADSR::Parameters ({
-                getVal (name + "/Attack", 10.0f) / 1000.0f,
-                getVal (name + "/Decay", 500.0f) / 1000.0f,
+            return juce::ADSR::Parameters ({
+                getVal (h.attack) / 1000.0f,
+                getVal (h.decay) / 1000.0f,
                 sustain,
-                getVal (name + "/Release", 500.0f) / 1000.0f
+                getVal (h.release) / 1000.0f
             });
+        };
+
+        // Algorithm
+        if (registry.consumeChanges (watches.algorithm))
+        {
+            const bool sixOp = getVal (handles.operators) > 0.5f;
+            currentKernel = FmAlgorithmRouter::getKernel (sixOp, (int) getVal (sixOp ? handles.sixOpAlgorithm : handles.algorithm));
+        }
+
+        bool envChanged = false;
+
+        // Operators 1-6
+        for (int i = 0; i < numOperators; ++i)
+        {
+            if (! registry.consumeChanges (watches.ops[(size_t) i]))
+                continue;
+
+            const auto& h = handles.ops[(size_t) i];
+            auto& gs = globalOps[i];
+
+            gs.waveform     = (int) getVal (h.waveform);
+            gs.ratio        = getVal (h.ratio);
+            gs.detune       = getVal (h.detune);
+            gs.level        = getVal (h.level);
+            gs.feedback     = getVal (h.feedback);
+            gs.velocitySens = getVal (h.velocity);
+            gs.keySync      = getVal (h.keySync) > 0.5f;
+            gs.envParams    = readEnv (h.env);
+            envChanged = true;
         }
 
         // Filter
-        filterType = (int) getVal ("Filter/Type", 0.0f);
-        baseFilterCutoff = getVal ("Filter/Cutoff", 20000.0f);
-        baseFilterRes = getVal ("Filter/Res", 0.0f);
-        filterKeyTrack = getVal ("Filter/KeyTrack", 0.0f);
-        filterIs24dB = getVal ("Filter/Slope", 1.0f) > 0.5f;
+        const bool filterChanged = registry.consumeChanges (watches.filter);
+        if (filterChanged)
+        {
+            filterType = (int) getVal (handles.filterType);
+            smoothers.setTarget (smFilterCutoff, std::log2 (juce::jmax (20.0f, getVal (handles.filterCutoff)) / 20.0f));
+            smoothers.setTarget (smFilterRes, getVal (handles.filterRes));
+            filterKeyTrack = getVal (handles.filterKeyTrack);
+            filterIs24dB = getVal (handles.filterSlope) > 0.5f;
+        }
 
         // Filter Envelope
+        if (registry.consumeChanges (watches.filterEnv))
         {
-            float feSustain = getVal ("Filter Env/Sustain", 0.0f);
-            if (feSustain < 0.001f) feSustain = 0.001f;
-            filterEnvParams = juce::ADSR::Parameters ({
-                getVal ("Filter Env/Attack", 10.0f) / 1000.0f,
-                getVal ("Filter Env/Decay", 300.0f) / 1000.0f,
-                feSustain,
-                getVal ("Filter Env/Release", 300.0f) / 1000.0f
-            });
-            filterEnvAmount = getVal ("Filter Env/Amount", 0.0f) / 100.0f;  // stored as -100..100, normalize to -1..1
+            filterEnvParams = readEnv (handles.filterEnv);
+            filterEnvAmount = getVal (handles.filterEnvAmount) / 100.0f;  // stored as -100..100, normalize to -1..1
+            envChanged = true;
         }
 
         // Amp
-        ampLevel = getVal ("Amp Output/Level", 0.8f);
-        ampVelocity = getVal ("Amp Output/Velocity", 0.5f);
-
-        float sustain = getVal ("Amp Env/Sustain", 0.7f);
-        if (sustain < 0.001f) sustain = 0.001f;
-        ampParams = juce::ADSR::Parameters ({
-            getVal ("Amp Env/Attack", 10.0f) / 1000.0f,
-            getVal ("Amp Env/Decay", 500.0f) / 1000.0f,
-            sustain,
-            getVal ("Amp Env/Release", 500.0f) / 1000.0f
-        });
+        if (registry.consumeChanges (watches.ampOutput))
+        {
+            smoothers.setTarget (smAmpLevel, getVal (handles.ampLevel));
+            ampVelocity = getVal (handles.ampVelocity);
+        }
+
+        if (registry.consumeChanges (watches.ampEnv))
+        {
+            ampParams = readEnv (handles.ampEnv);
+            envChanged = true;
+        }
 
         // LFOs
-        auto updateLfo = [&] (LfoSettings& settings, const juce::String& name) {
-            settings.shape      = (int) std::round (getVal (name + "/Shape", 0.0f));
-            settings.syncMode   = getVal (name + "/Sync", 0.0f) > 0.5f;
-            settings.rateHz     = getVal (name + "/Rate Hz", 1.0f) * 5.0f;
-            settings.rateNoteIdx = (int) std::round (getVal (name + "/Rate Note", 4.0f));
-            settings.keySync    = getVal (name + "/KeySync", 1.0f) > 0.5f;
-            settings.phaseStart = getVal (name + "/Phase", 0.0f) / 360.0f;
+        auto updateLfo = [&] (LfoSettings& settings, const LfoHandles& h) {
+            settings.shape      = (int) std::round (getVal (h.shape));
+            settings.syncMode   = getVal (h.sync) > 0.5f;
+            settings.rateHz     = getVal (h.rateHz) * 5.0f;
+            settings.rateNoteIdx = (int) std::round (getVal (h.rateNote));
+            settings.keySync    = getVal (h.keySync) > 0.5f;
+            settings.phaseStart = getVal (h.phase) / 360.0f;
 
             for (int i = 0; i < 4; ++i)
             {
-                settings.slots[i].target = getVal (name + "/Slot " + juce::String (i + 1) + " Target", 0.0f);
-                settings.slots[i].amount = getVal (name + "/Slot " + juce::String (i + 1) + " Amount", 0.0f);
+                settings.slots[i].target = getVal (h.slotTarget[i]);
+                settings.slots[i].amount = getVal (h.slotAmount[i]);
             }
         };
 
-        updateLfo (globalLfos[0], "LFO 1");
-        updateLfo (globalLfos[1], "LFO 2");
+        for (int i = 0; i < 2; ++i)
+            if (registry.consumeChanges (watches.lfos[(size_t) i]))
+                updateLfo (globalLfos[(size_t) i], handles.lfos[(size_t) i]);
 
         // Control
-        pbRange = getVal ("Control/PB Range", 2.0f);
-        isMonoMode = (int) getVal ("Control/Mode", 0.0f) == 1;
-        portaOn = getVal ("Control/Porta On", 0.0f) > 0.5f;
-        portaTime = getVal ("Control/Porta Time", 100.0f);
-
-        // FX
-        fxSettings.modType     = (int) getVal ("FX/Mod Type", 1.0f);
-        fxSettings.modRate     = getVal ("FX/Mod Rate", 1.0f);
-        fxSettings.modDepth    = getVal ("FX/Mod Depth", 0.5f);
-        fxSettings.modFeedback = getVal ("FX/Mod Feedback", 0.0f);
-        fxSettings.modMix      = getVal ("FX/Mod Mix", 0.0f);
-
-        fxSettings.dlyTime     = getVal ("FX/Dly Time", 400.0f);
-        fxSettings.dlyNoteIdx  = (int) std::round (getVal ("FX/Dly Note", 4.0f));
-        fxSettings.dlyFeedback = getVal ("FX/Dly FB", 0.3f);
-        fxSettings.dlyMix      = getVal ("FX/Dly Mix", 0.0f);
-        fxSettings.dlySync     = getVal ("FX/Dly Sync", 0.0f) > 0.5f;
-
-        fxSettings.rvbSize = getVal ("FX/Rvb Size", 0.5f);
-        fxSettings.rvbDamp = getVal ("FX/Rvb Damp", 0.5f);
-        fxSettings.rvbMix  = getVal ("FX/Rvb Mix", 0.0f);
-
-        // Update FX DSP
+        if (registry.consumeChanges (watches.control))
+        {
+            pbRange = getVal (handles.pbRange);
+            isMonoMode = (int) getVal (handles.voiceMode) == 1;
+            portaOn = getVal (handles.portaOn) > 0.5f;
+            portaTime = getVal (handles.portaTime);
+        }
+
+        // FX (synced delay also depends on tempo)
+        const bool fxChanged = registry.consumeChanges (watches.fx);
+        if (fxChanged)
+        {
+            fxSettings.modType     = (int) getVal (handles.fxModType);
+            fxSettings.modRate     = getVal (handles.fxModRate);
+            fxSettings.modDepth    = getVal (handles.fxModDepth);
+            fxSettings.modFeedback = getVal (handles.fxModFeedback);
+            fxSettings.modMix      = getVal (handles.fxModMix);
+
+            fxSettings.dlyTime     = getVal (handles.fxDlyTime);
+            fxSettings.dlyNoteIdx  = (int) std::round (getVal (handles.fxDlyNote));
+            fxSettings.dlyFeedback = getVal (handles.fxDlyFeedback);
+            fxSettings.dlyMix      = getVal (handles.fxDlyMix);
+            fxSettings.dlySync     = getVal (handles.fxDlySync) > 0.5f;
+
+            fxSettings.rvbSize = getVal (handles.fxRvbSize);
+            fxSettings.rvbDamp = getVal (handles.fxRvbDamp);
+            fxSettings.rvbMix  = getVal (handles.fxRvbMix);
+        }
+
+        if (fxChanged || (fxSettings.dlySync && bpm != fxBpm))
+        {
+            fxBpm = bpm;
+            updateFxDsp();
+        }
+
+        if (envChanged || filterChanged)
+            pushVoiceParams();
+    }
+
+    void FmSignalPath::updateFxDsp()
+    {
         chorus.setRate (fxSettings.modRate);
         chorus.setDepth (fxSettings.modDepth);
         chorus.setFeedback (fxSettings.modFeedback);
         chorus.setCentreDelay (fxSettings.modType == 3 ? 7.0f : 20.0f);
-        chorus.setMix (fxSettings.modType == 2 ? 0.0f : fxSettings.modMix);
 
         phaser.setRate (fxSettings.modRate);
         phaser.setDepth (fxSettings.modDepth);
         phaser.setFeedback (fxSettings.modFeedback);
-        phaser.setMix (fxSettings.modType == 2 ? fxSettings.modMix : 0.0f);
 
-        delay.feedback = fxSettings.dlyFeedback;
-        delay.mix = fxSettings.dlyMix;
+        smoothers.setTarget (smModMix, fxSettings.modMix);
+        smoothers.setTarget (smDlyFeedback, fxSettings.dlyFeedback);
+        smoothers.setTarget (smDlyMix, fxSettings.dlyMix);
         float actualDlyTime = fxSettings.dlyTime;
         if (fxSettings.dlySync)
         {
@@ -328,88 +451,105 @@ namespace neon
             double secPerBeat = 60.0 / bpm;
             actualDlyTime = (float)(secPerBeat * divs[idx] * 1000.0);
         }
-        delay.line.setDelay (actualDlyTime * (float) sampleRate / 1000.0f);
+        smoothers.setTarget (smDlyTime, actualDlyTime);
+
+        reverbParams.roomSize = fxSettings.rvbSize;
+        reverbParams.damping  = fxSettings.rvbDamp;
+        reverbParams.width    = 1.0f;
+        smoothers.setTarget (smRvbMix, fxSettings.rvbMix);
+
+        // The mod type may have switched between chorus and phaser
+        applySmoothedFx();
+    }
+
+    void FmSignalPath::applySmoothedParams()
+    {
+        // Operator level and feedback are latched per note in noteOn(), so they stay unsmoothed
+        baseFilterCutoff = 20.0f * std::exp2 (smoothers.get (smFilterCutoff));
+        baseFilterRes = smoothers.get (smFilterRes);
+        ampLevel = smoothers.get (smAmpLevel);
+
+        applySmoothedFx();
+    }
+
+    void FmSignalPath::applySmoothedFx()
+    {
+        float modMix = smoothers.get (smModMix);
+        chorus.setMix (fxSettings.modType == 2 ? 0.0f : modMix);
+        phaser.setMix (fxSettings.modType == 2 ? modMix : 0.0f);
+
+        delay.feedback = smoothers.get (smDlyFeedback);
+        delay.mix = smoothers.get (smDlyMix);
+        delay.line.setDelay (smoothers.get (smDlyTime) * (float) sampleRate / 1000.0f);
+
+        float rvbMix = smoothers.get (smRvbMix);
+        reverbParams.wetLevel = rvbMix;
+        reverbParams.dryLevel = 1.0f - (rvbMix * 0.5f);
+        reverb.setParameters (reverbParams);
+    }
 
-        juce::dsp::Reverb::Parameters rvbParams;
-        rvbParams.roomSize = fxSettings.rvbSize;
-        rvbParams.damping  = fxSettings.rvbDamp;
-        rvbParams.width    = 1.0f;
-        rvbParams.wetLevel = fxSettings.rvbMix;
-        rvbParams.dryLevel = 1.0f - (fxSettings.rvbMix * 0.5f);
-        reverb.setParameters (rvbParams);
+    void FmSignalPath::pushVoiceParams()
+    {
+        // Only runs when an envelope or filter group changed; idle voices are refreshed too
+        auto type = juce::dsp::StateVariableTPTFilterType::lowpass;
+        if (filterType == 1) type = juce::dsp::StateVariableTPTFilterType::highpass;
+        else if (filterType == 2) type = juce::dsp::StateVariableTPTFilterType::bandpass;
 
-        // Update envelopes on active voices
         for (auto& v : voices)
         {
-            if (v.isActive)
-            {
-                v.ampEnv.setParameters (ampParams);
-                v.filterEnv.setParameters (filterEnvParams);
+            v.ampEnv.setParameters (ampParams);
+            v.filterEnv.setParameters (filterEnvParams);
 
-                for (int i = 0; i < 4; ++i)
-                    v.ops[i].setEnvelopeParams (globalOps[i].envParams);
+            for (int i = 0; i < numOperators; ++i)
+                v.ops[i].setEnvelopeParams (globalOps[i].envParams);
 
-                auto type = juce::dsp::StateVariableTPTFilterType::lowpass;
-                if (filterType == 1) type = juce::dsp::StateVariableTPTFilterType::highpass;
-                else if (filterType == 2) type = juce::dsp::StateVariableTPTFilterType::bandpass;
-                v.filter1.setType (type);
-                v.filter2.setType (type);
-            }
+            v.filter1.setType (type);
+            v.filter2.setType (type);
         }
     }
 
     // ============================================================
-    // LFO processing helper
+    // Audio processing
     // ============================================================
-    static float computeLfo (FmSignalPath::LfoState& state, int shape, float phaseInc)
+    void FmSignalPath::getNextAudioBlock (const juce::AudioSourceChannelInfo& bufferToFill)
+    {
+        beginBlock (bufferToFill.numSamples);
+        renderRange (bufferToFill, 0, bufferToFill.numSamples);
+    }
+
+    void FmSignalPath::beginBlock (int numSamples)
     {
-        state.phase += phaseInc;
-        if (state.phase >= 1.0f) state.phase -= 1.0f;
+        registry.beginAudioBlock (numSamples, sampleRate);
+    }
 
-        float p = state.phase;
-        float out = 0.0f;
+    void FmSignalPath::renderRange (const juce::AudioSourceChannelInfo& block, int start, int numSamples)
+    {
+        // Render in segments split at parameter events so UI changes land sample-accurately
+        const int end = start + numSamples;
 
-        switch (shape)
+        for (int pos = start; pos < end;)
         {
-            case 0: // Triangle
-                out = (p < 0.5f) ? (4.0f * p - 1.0f) : (3.0f - 4.0f * p);
-                break;
-            case 1: // Ramp Up
-                out = 2.0f * p - 1.0f;
-                break;
-            case 2: // Ramp Down
-                out = 1.0f - 2.0f * p;
-                break;
-            case 3: // Square
-                out = p < 0.5f ? 1.0f : -1.0f;
-                break;
-            case 4: // S&H
-                if (p < phaseInc) // trigger on wrap
-                {
-                    state.lastOutput = juce::Random::getSystemRandom().nextFloat() * 2.0f - 1.0f;
-                    state.shTriggered = true;
-                }
-                out = state.lastOutput;
-                break;
-            default:
-                out = std::sin (p * juce::MathConstants<float>::twoPi);
-                break;
-        }
+            int next = juce::jmin (end, registry.applyParameterEvents (pos));
+            updateParams();
 
-        state.lastOutput = out;
-        return out;
+            // While anything is gliding, step in short control blocks
+            if (smoothers.isSmoothing())
+                next = juce::jmin (next, pos + SmoothingBank<numSmoothedParams>::controlBlockSize);
+
+            if (smoothers.advance (next - pos))
+                applySmoothedParams();
+
+            renderBlock ({ block.buffer, block.startSample + pos, next - pos });
+            pos = next;
+        }
     }
 
-    // ============================================================
-    // Audio processing
-    // ============================================================
-    void FmSignalPath::getNextAudioBlock (const juce::AudioSourceChannelInfo& bufferToFill)
+    void FmSignalPath::renderBlock (const juce::AudioSourceChannelInfo& bufferToFill)
     {
         auto* buffer = bufferToFill.buffer;
         auto numSamples = bufferToFill.numSamples;
 
         buffer->clear (bufferToFill.startSample, numSamples);
-        updateParams();
 
         // --- Oversampled voice rendering ---
         // Upsample: create an oversampled block from the output buffer
@@ -423,187 +563,209 @@ namespace neon
         auto* outL = osBlock.getChannelPointer (0);
         auto* outR = osBlock.getChannelPointer (1);
 
-        for (int voiceIdx = 0; voiceIdx < numVoices; ++voiceIdx)
+        // LFO rates follow the tempo, so resolve them per block
+        for (size_t l = 0; l < lfoClocks.size(); ++l)
         {
-            auto& v = voices[voiceIdx];
-            if (!v.isActive.load()) continue;
+            const auto& g = globalLfos[l];
+            lfoClocks[l].shape = g.shape;
+            lfoClocks[l].phaseIncrement = Lfo::getRateHz (g.syncMode, g.rateHz, g.rateNoteIdx, bpm) / oversampledRate;
+            lfoClocks[l].phaseStart = g.phaseStart;
+        }
 
-            for (int s = 0; s < osNumSamples; ++s)
-            {
-                // Portamento glide (at oversampled rate)
-                if (portaOn && v.currentGlideFreq != v.targetFrequency)
-                {
-                    float glideRate = 1.0f - std::exp (-1.0f / (portaTime * 0.001f * (float) oversampledRate));
-                    v.currentGlideFreq += (v.targetFrequency - v.currentGlideFreq) * glideRate;
-                }
-                else
-                {
-                    v.currentGlideFreq = v.targetFrequency;
-                }
+        jassert (osNumSamples <= voiceBuffers.getNumSamples());
 
-                // Pitch bend
-                float pbSemitones = pitchWheel * pbRange;
-                float baseFreq = v.currentGlideFreq * std::pow (2.0f, pbSemitones / 12.0f);
+        // Voices render independently into their own buffers, in parallel where it pays off
+        int activeVoices[numVoices];
+        int numActive = 0;
+        for (int i = 0; i < numVoices; ++i)
+            if (voices[(size_t)i].isActive.load())
+                activeVoices[numActive++] = i;
 
-                // LFO processing for this voice (at oversampled rate)
-                float lfoOutputs[2] = { 0.0f, 0.0f };
-                for (int li = 0; li < 2; ++li)
-                {
-                    auto& ls = globalLfos[li];
-                    auto& lState = voiceLfoStates[voiceIdx].lfos[li];
+        auto* const* voiceChannels = voiceBuffers.getArrayOfWritePointers(); // fetched here: AudioBuffer is not thread-safe
+        renderPool->run (numActive, osNumSamples, [&] (int job) {
+            const int i = activeVoices[job];
+            juce::FloatVectorOperations::clear (voiceChannels[i * 3], osNumSamples);
+            renderVoice (i, voiceChannels + i * 3, osNumSamples);
+        });
 
-                    float phaseInc = 0.0f;
-                    if (ls.syncMode)
-                    {
-                        static constexpr float divs[] = { 0.0625f, 0.125f, 0.25f, 0.5f, 1.0f, 2.0f, 4.0f, 8.0f, 16.0f };
-                        int idx = juce::jlimit (0, 8, ls.rateNoteIdx);
-                        float beatsPerSec = (float)(bpm / 60.0);
-                        float hz = beatsPerSec / divs[idx];
-                        phaseInc = hz / (float) oversampledRate;
-                    }
-                    else
-                    {
-                        phaseInc = ls.rateHz / (float) oversampledRate;
-                    }
+        // Sum in voice order so the result never depends on thread timing
+        for (int job = 0; job < numActive; ++job)
+        {
+            const float* voiceOut = voiceChannels[activeVoices[job] * 3];
+            juce::FloatVectorOperations::add (outL, voiceOut, osNumSamples);
+            juce::FloatVectorOperations::add (outR, voiceOut, osNumSamples);
+        }
 
-                    lfoOutputs[li] = computeLfo (lState, ls.shape, phaseInc);
-                }
+        // --- Downsample back to normal rate ---
+        oversampling.processSamplesDown (inputBlock);
 
-                // Apply LFO modulation to operators
-                float lfoFreqMod = 0.0f;
-                float lfoFilterMod = 0.0f;
-                float lfoOpLevelMod[4] = { 0.0f };
+        // === FX Processing (at normal sample rate) ===
+        juce::dsp::ProcessContextReplacing<float> context (inputBlock);
 
-                for (int li = 0; li < 2; ++li)
-                {
-                    for (int si = 0; si < 4; ++si)
-                    {
-                        int target = (int) globalLfos[li].slots[si].target;
-                        float amount = globalLfos[li].slots[si].amount / 100.0f;
-                        float lfoVal = lfoOutputs[li] * amount;
-
-                        if (target == (int) FmModTarget::MasterPitch)
-                            lfoFreqMod += lfoVal * 2.0f;
-
-                        if (target >= (int) FmModTarget::Op1Level && target <= (int) FmModTarget::Op4Level)
-                        {
-                            int opIdx = target - (int) FmModTarget::Op1Level;
-                            lfoOpLevelMod[opIdx] += lfoVal;
-                        }
-
-                        if (target >= (int) FmModTarget::Op1Ratio && target <= (int) FmModTarget::Op4Ratio)
-                        {
-                            int opIdx = target - (int) FmModTarget::Op1Ratio;
-                            v.ops[opIdx].ratio = globalOps[opIdx].ratio + lfoVal * 2.0f;
-                        }
-
-                        if (target == (int) FmModTarget::FilterCutoff)
-                        {
-                            lfoFilterMod += lfoVal * 4.0f;
-                        }
-                    }
-                }
+        // Modulation FX (Chorus/Phaser/Flanger)
+        if (fxSettings.modType > 0 && smoothers.get (smModMix) > 0.0f)
+        {
+            if (fxSettings.modType == 2)
+                phaser.process (context);
+            else
+                chorus.process (context);
+        }
 
-                // Apply pitch LFO mod
-                float modFreq = baseFreq * std::pow (2.0f, lfoFreqMod / 12.0f);
+        // Delay
+        if (delay.mix > 0.0f)
+            delay.process (context);
 
-                // Temporarily adjust operator levels for LFO modulation
-                float savedLevels[4];
-                for (int i = 0; i < 4; ++i)
-                {
-                    savedLevels[i] = v.ops[i].level;
-                    v.ops[i].level = juce::jlimit (0.0f, 1.0f, v.ops[i].level + lfoOpLevelMod[i]);
-                }
+        // Reverb
+        if (reverbParams.wetLevel > 0.0f)
+            reverb.process (context);
+    }
 
-                // Process FM algorithm
-                float sample = FmAlgorithmRouter::process (currentAlgorithm, v.ops, modFreq);
+    void FmSignalPath::renderVoice (int voiceIdx, float* const* scratch, int osNumSamples)
+    {
+        // The algorithm is resolved here, once per block: each kernel has its own sample loop
+        using Loop = void (FmSignalPath::*) (int, float* const*, int);
 
-                // Restore levels
-                for (int i = 0; i < 4; ++i)
-                    v.ops[i].level = savedLevels[i];
+        static constexpr auto loops = [] <size_t... Kernels> (std::index_sequence<Kernels...>) {
+            return std::array<Loop, sizeof... (Kernels)> { &FmSignalPath::renderVoiceWith<(int) Kernels>... };
+        } (std::make_index_sequence<FmAlgorithmRouter::numKernels>());
 
-                // Master amp envelope
-                float ampEnvVal = v.ampEnv.getNextSample();
+        (this->*loops[(size_t) currentKernel]) (voiceIdx, scratch, osNumSamples);
+    }
 
-                // Velocity scaling on output
-                float velScale = 1.0f - ampVelocity + ampVelocity * v.velocity;
+    template <int Kernel>
+    void FmSignalPath::renderVoiceWith (int voiceIdx, float* const* scratch, int osNumSamples)
+    {
+        // Operators beyond the algorithm's are neither rendered nor kept alive
+        constexpr int numOps = FmAlgorithmRouter::getRouting (Kernel).numOperators;
 
-                // Filter envelope modulation
-                float filterEnvVal = v.filterEnv.getNextSample();
+        // scratch[0] receives the voice, scratch[1] and [2] hold its LFOs for the block
+        auto& v = voices[(size_t)voiceIdx];
+        float* out = scratch[0];
 
-                // Filter (runs at oversampled rate for better response)
-                float cutoff = baseFilterCutoff * std::pow (2.0f, lfoFilterMod);
+        const float* lfoOut[2];
+        for (int li = 0; li < 2; ++li)
+        {
+            voiceLfoStates[(size_t)voiceIdx].lfos[(size_t)li].renderBlock (lfoClocks[(size_t)li], scratch[li + 1], osNumSamples);
+            lfoOut[li] = scratch[li + 1];
+        }
 
-                // Apply filter envelope: bipolar amount modulates cutoff in octaves
-                if (std::abs (filterEnvAmount) > 0.001f)
-                {
-                    float envOctaves = filterEnvVal * filterEnvAmount * 8.0f;  // up to +/- 8 octaves
-                    cutoff *= std::pow (2.0f, envOctaves);
-                }
+        // Constant over the block, so kept out of the sample loop
+        const float glideRate = 1.0f - std::exp (-1.0f / (portaTime * 0.001f * (float) oversampledRate));
+        const float pbRatio = fastmath::semitonesToRatio (pitchWheel * pbRange);
+        const float keyTrackOctaves = filterKeyTrack > 0.0f
+            ? filterKeyTrack * fastmath::log2 ((float) juce::MidiMessage::getMidiNoteInHertz (v.midiNote) / 261.63f)
+            : 0.0f;
 
-                if (filterKeyTrack > 0.0f)
-                {
-                    float noteFreq = (float) juce::MidiMessage::getMidiNoteInHertz (v.midiNote);
-                    cutoff *= std::pow (noteFreq / 261.63f, filterKeyTrack);
-                }
-                cutoff = juce::jlimit (20.0f, 20000.0f, cutoff);
+        for (int s = 0; s < osNumSamples; ++s)
+        {
+            // Portamento glide (at oversampled rate)
+            if (portaOn && v.currentGlideFreq != v.targetFrequency)
+            {
+                v.currentGlideFreq += (v.targetFrequency - v.currentGlideFreq) * glideRate;
+            }
+            else
+            {
+                v.currentGlideFreq = v.targetFrequency;
+            }
+
+            // Pitch bend
+            float baseFreq = v.currentGlideFreq * pbRatio;
 
-                v.filter1.setCutoffFrequency (cutoff);
-                v.filter1.setResonance (juce::jlimit (0.1f, 5.0f, baseFilterRes * 5.0f));
-                float filtered = v.filter1.processSample (0, sample);
+            float lfoOutputs[2] = { lfoOut[0][s], lfoOut[1][s] };
 
-                if (filterIs24dB)
+            // Apply LFO modulation to operators
+            float lfoFreqMod = 0.0f;
+            float lfoFilterMod = 0.0f;
+            float lfoOpLevelMod[numOperators] = { 0.0f };
+
+            for (int li = 0; li < 2; ++li)
+            {
+                for (int si = 0; si < 4; ++si)
                 {
-                    v.filter2.setCutoffFrequency (cutoff);
-                    v.filter2.setResonance (juce::jlimit (0.1f, 5.0f, baseFilterRes * 5.0f));
-                    filtered = v.filter2.processSample (0, filtered);
-                }
+                    int target = (int) globalLfos[li].slots[si].target;
+                    float amount = globalLfos[li].slots[si].amount / 100.0f;
+                    float lfoVal = lfoOutputs[li] * amount;
 
-                float finalSample = filtered * ampEnvVal * velScale * ampLevel;
+                    if (target == (int) FmModTarget::MasterPitch)
+                        lfoFreqMod += lfoVal * 2.0f;
 
-                // Soft clip
-                finalSample = fastTanh (finalSample);
+                    if (int opIdx = getFmOpLevelTarget (target); opIdx >= 0)
+                        lfoOpLevelMod[opIdx] += lfoVal;
 
-                outL[s] += finalSample;
-                outR[s] += finalSample;
+                    if (int opIdx = getFmOpRatioTarget (target); opIdx >= 0)
+                        v.ops[opIdx].ratio = globalOps[opIdx].ratio + lfoVal * 2.0f;
 
-                // Check if voice is done
-                if (!v.ampEnv.isActive())
-                {
-                    bool anyOpActive = false;
-                    for (auto& op : v.ops)
-                        if (op.isActive()) anyOpActive = true;
-                    if (!anyOpActive)
+                    if (target == (int) FmModTarget::FilterCutoff)
                     {
-                        v.isActive.store (false);
-                        break;
+                        lfoFilterMod += lfoVal * 4.0f;
                     }
                 }
             }
-        }
 
-        // --- Downsample back to normal rate ---
-        oversampling.processSamplesDown (inputBlock);
+            // Apply pitch LFO mod
+            float modFreq = baseFreq * fastmath::semitonesToRatio (lfoFreqMod);
 
-        // === FX Processing (at normal sample rate) ===
-        juce::dsp::ProcessContextReplacing<float> context (inputBlock);
+            // Temporarily adjust operator levels for LFO modulation
+            float savedLevels[numOps];
+            for (int i = 0; i < numOps; ++i)
+            {
+                savedLevels[i] = v.ops[i].level;
+                v.ops[i].level = juce::jlimit (0.0f, 1.0f, v.ops[i].level + lfoOpLevelMod[i]);
+            }
 
-        // Modulation FX (Chorus/Phaser/Flanger)
-        if (fxSettings.modType > 0 && fxSettings.modMix > 0.0f)
-        {
-            if (fxSettings.modType == 2)
-                phaser.process (context);
-            else
-                chorus.process (context);
-        }
+            // Process FM algorithm
+            float sample = FmAlgorithmRouter::process<Kernel> (v.ops, modFreq);
 
-        // Delay
-        if (fxSettings.dlyMix > 0.0f)
-            delay.process (context);
+            // Restore levels
+            for (int i = 0; i < numOps; ++i)
+                v.ops[i].level = savedLevels[i];
 
-        // Reverb
-        if (fxSettings.rvbMix > 0.0f)
-            reverb.process (context);
+            // Master amp envelope
+            float ampEnvVal = v.ampEnv.getNextSample();
+
+            // Velocity scaling on output
+            float velScale = 1.0f - ampVelocity + ampVelocity * v.velocity;
+
+            // Filter envelope modulation
+            float filterEnvVal = v.filterEnv.getNextSample();
+
+            // Filter (runs at oversampled rate for better response)
+            // LFO, filter envelope (bipolar, up to +/- 8 octaves) and key tracking all sum in octaves
+            float envOctaves = filterEnvVal * filterEnvAmount * 8.0f;
+            float cutoff = baseFilterCutoff * fastmath::exp2 (lfoFilterMod + envOctaves + keyTrackOctaves);
+            cutoff = juce::jlimit (20.0f, 20000.0f, cutoff);
+
+            v.filter1.setCutoffFrequency (cutoff);
+            v.filter1.setResonance (juce::jlimit (0.1f, 5.0f, baseFilterRes * 5.0f));
+            float filtered = v.filter1.processSample (0, sample);
+
+            if (filterIs24dB)
+            {
+                v.filter2.setCutoffFrequency (cutoff);
+                v.filter2.setResonance (juce::jlimit (0.1f, 5.0f, baseFilterRes * 5.0f));
+                filtered = v.filter2.processSample (0, filtered);
+            }
+
+            float finalSample = filtered * ampEnvVal * velScale * ampLevel;
+
+            // Soft clip
+            finalSample = fastmath::softClip (finalSample);
+
+            out[s] = finalSample;
+
+            // Check if voice is done
+            if (!v.ampEnv.isActive())
+            {
+                bool anyOpActive = false;
+                for (int i = 0; i < numOps; ++i)
+                    if (v.ops[i].isActive()) anyOpActive = true;
+                if (!anyOpActive)
+                {
+                    v.isActive.store (false);
+                    break;
+                }
+            }
+        }
     }
 
     // ============================================================
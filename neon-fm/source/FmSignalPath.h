@@ -14,19 +14,24 @@ namespace neon
     /**
      * FmSignalPath
      * The master audio engine for Neon FM.
-     * 4-operator FM synthesis with analog oscillators.
+     * 4-operator FM synthesis with analog oscillators, or 6 operators on the DX7 algorithms.
      * Polls the ParameterRegistry to drive the DSP.
      */
     class FmSignalPath : public juce::AudioSource
     {
     public:
-        FmSignalPath();
+        explicit FmSignalPath (NeonInstance& instance);
         ~FmSignalPath() override = default;
 
         void prepareToPlay (int samplesPerBlockExpected, double sampleRate) override;
         void getNextAudioBlock (const juce::AudioSourceChannelInfo& bufferToFill) override;
         void releaseResources() override;
 
+        // Sample-accurate MIDI: beginBlock() once per host block, then renderRange() for each
+        // stretch between events. start is the offset inside the block.
+        void beginBlock (int numSamples);
+        void renderRange (const juce::AudioSourceChannelInfo& block, int start, int numSamples);
+
         void noteOn (int midiNote, float velocity);
         void noteOff (int midiNote);
         void setPolyAftertouch (int midiNote, float value);
@@ -73,8 +78,8 @@ namespace neon
             float targetFrequency = 440.0f;
             float currentGlideFreq = 440.0f;
 
-            // 4 FM operators per voice
-            std::array<FmOperator, 4> ops;
+            // 6 FM operators per voice; the 4-operator algorithms use the first 4
+            std::array<FmOperator, FmRouting::maxOperators> ops;
 
             // Master filter per voice
             juce::dsp::StateVariableTPTFilter<float> filter1;
@@ -117,18 +122,17 @@ namespace neon
             float rvbMix = 0.0f;
         };
 
-    public:
-        // LFO state needs to be accessible for static helper
-        struct LfoState
-        {
-            float phase = 0.0f;
-            float lastOutput = 0.0f;
-            bool shTriggered = false;
-            void reset (float startPhase) { phase = startPhase; lastOutput = 0.0f; shTriggered = false; }
-        };
-
     private:
+        void bindParameters();
         void updateParams();
+        void renderBlock (const juce::AudioSourceChannelInfo& bufferToFill);
+        void renderVoice (int voiceIdx, float* const* scratch, int osNumSamples);
+        template <int Kernel>
+        void renderVoiceWith (int voiceIdx, float* const* scratch, int osNumSamples);
+        void updateFxDsp();
+        void applySmoothedParams();
+        void applySmoothedFx();
+        void pushVoiceParams();
 
         double sampleRate = 44100.0;
         double oversampledRate = 88200.0;
@@ -136,8 +140,9 @@ namespace neon
         double bpm = 120.0;
 
         // Global operator settings (shared, read by all voices)
-        std::array<OpSettings, 4> globalOps;
-        FmAlgorithmType currentAlgorithm = FmAlgorithmType::SerialChain;
+        static constexpr int numOperators = FmRouting::maxOperators;
+        std::array<OpSettings, numOperators> globalOps;
+        int currentKernel = 0; // FmAlgorithmRouter kernel for the operator mode and algorithm
 
         // Filter
         int filterType = 0;
@@ -184,15 +189,31 @@ namespace neon
 
         std::array<LfoSettings, 2> globalLfos;
 
+        std::array<Lfo::Settings, 2> lfoClocks; // globalLfos at the oversampled rate and current tempo
+
         // Per-voice LFO states are stored separately  
         struct VoiceLfoState
         {
-            std::array<LfoState, 2> lfos;
+            std::array<Lfo, 2> lfos;
         };
         std::array<VoiceLfoState, 16> voiceLfoStates;
 
         // FX
         FxSettings fxSettings;
+
+        // Continuous parameters glide through one bank: updateParams() sets targets and
+        // applySmoothedParams() copies the current values into the caches above.
+        enum SmoothedParam
+        {
+            smFilterCutoff, // octaves above 20 Hz
+            smFilterRes, smAmpLevel,
+            smModMix, smDlyTime, smDlyFeedback, smDlyMix, smRvbMix,
+            numSmoothedParams
+        };
+
+        SmoothingBank<numSmoothedParams> smoothers;
+        juce::dsp::Reverb::Parameters reverbParams;
+
         juce::dsp::Chorus<float> chorus;
         juce::dsp::Phaser<float> phaser;
         juce::dsp::Reverb reverb;
@@ -214,11 +235,76 @@ namespace neon
         juce::dsp::Oversampling<float> oversampling { 2, oversamplingOrder,
             juce::dsp::Oversampling<float>::filterHalfBandPolyphaseIIR, true };
         juce::AudioBuffer<float> osBuffer;
+        juce::AudioBuffer<float> voiceBuffers; // per voice: output, LFO 1, LFO 2 (oversampled)
+        std::shared_ptr<RenderPool> renderPool;
 
         // Polyphony
         static constexpr int numVoices = 16;
         std::array<Voice, numVoices> voices;
 
+        // Registry handles, resolved once in bindParameters() so updateParams()
+        // reads by index instead of building path strings every block.
+        struct EnvHandles
+        {
+            ParameterHandle attack, decay, sustain, release;
+        };
+
+        struct OpHandles
+        {
+            ParameterHandle waveform, ratio, detune, level, feedback, velocity, keySync;
+            EnvHandles env;
+        };
+
+        struct LfoHandles
+        {
+            ParameterHandle shape, sync, rateHz, rateNote, keySync, phase;
+            ParameterHandle slotTarget[4], slotAmount[4];
+        };
+
+        struct ParamHandles
+        {
+            ParameterHandle algorithm, operators, sixOpAlgorithm;
+            std::array<OpHandles, numOperators> ops;
+
+            ParameterHandle filterType, filterCutoff, filterRes, filterKeyTrack, filterSlope;
+            EnvHandles filterEnv;
+            ParameterHandle filterEnvAmount;
+
+            ParameterHandle ampLevel, ampVelocity;
+            EnvHandles ampEnv;
+
+            std::array<LfoHandles, 2> lfos;
+
+            ParameterHandle pbRange, voiceMode, portaOn, portaTime;
+
+            ParameterHandle fxModType, fxModRate, fxModDepth, fxModFeedback, fxModMix;
+            ParameterHandle fxDlyTime, fxDlyNote, fxDlyFeedback, fxDlyMix, fxDlySync;
+            ParameterHandle fxRvbSize, fxRvbDamp, fxRvbMix;
+        };
+
+        ParamHandles handles;
+
+        // One watch per module group; updateParams() skips groups that haven't changed
+        struct GroupWatches
+        {
+            ParameterGroupWatch algorithm;
+            std::array<ParameterGroupWatch, numOperators> ops;
+            ParameterGroupWatch filter, filterEnv, ampOutput, ampEnv;
+            std::array<ParameterGroupWatch, 2> lfos;
+            ParameterGroupWatch control, fx;
+
+            void invalidate()
+            {
+                for (auto* w : { &algorithm, &filter, &filterEnv, &ampOutput, &ampEnv, &control, &fx })
+                    w->invalidate();
+                for (auto& w : ops)  w.invalidate();
+                for (auto& w : lfos) w.invalidate();
+            }
+        };
+
+        GroupWatches watches;
+        double fxBpm = 0.0;
+
         ParameterRegistry& registry;
     };
 
@@ -36,9 +36,35 @@ namespace neon
         Lfo1Amount1, Lfo1Amount2, Lfo1Amount3, Lfo1Amount4,
         Lfo2Amount1, Lfo2Amount2, Lfo2Amount3, Lfo2Amount4,
 
+        // 6-operator mode (appended so saved slot targets keep their meaning)
+        Op5Level,
+        Op6Level,
+        Op5Ratio,
+        Op6Ratio,
+
         Count
     };
 
+    /** The operator (0-5) a level target points at, or -1. */
+    static inline int getFmOpLevelTarget (int target)
+    {
+        if (target >= (int) FmModTarget::Op1Level && target <= (int) FmModTarget::Op4Level)
+            return target - (int) FmModTarget::Op1Level;
+        if (target == (int) FmModTarget::Op5Level || target == (int) FmModTarget::Op6Level)
+            return 4 + target - (int) FmModTarget::Op5Level;
+        return -1;
+    }
+
+    /** The operator (0-5) a ratio target points at, or -1. */
+    static inline int getFmOpRatioTarget (int target)
+    {
+        if (target >= (int) FmModTarget::Op1Ratio && target <= (int) FmModTarget::Op4Ratio)
+            return target - (int) FmModTarget::Op1Ratio;
+        if (target == (int) FmModTarget::Op5Ratio || target == (int) FmModTarget::Op6Ratio)
+            return 4 + target - (int) FmModTarget::Op5Ratio;
+        return -1;
+    }
+
     /**
      * CtrlSource (Neon FM)
      */
@@ -63,7 +89,8 @@ namespace neon
             "Op1 Feedback", "Op2 Feedback", "Op3 Feedback", "Op4 Feedback",
             "Filter Cutoff", "Filter Res",
             "LFO 1 Amt 1", "LFO 1 Amt 2", "LFO 1 Amt 3", "LFO 1 Amt 4",
-            "LFO 2 Amt 1", "LFO 2 Amt 2", "LFO 2 Amt 3", "LFO 2 Amt 4"
+            "LFO 2 Amt 1", "LFO 2 Amt 2", "LFO 2 Amt 3", "LFO 2 Amt 4",
+            "Op5 Level", "Op6 Level", "Op5 Ratio", "Op6 Ratio"
         };
     }
 
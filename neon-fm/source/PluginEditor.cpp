@@ -9,49 +9,55 @@
 namespace neon
 {
     NeonFmAudioProcessorEditor::NeonFmAudioProcessorEditor (NeonFmAudioProcessor& p)
-        : AudioProcessorEditor (&p), audioProcessor (p)
+        : AudioProcessorEditor (&p), audioProcessor (p),
+          debugLauncher (p.getNeonInstance().getParameterRegistry())
     {
         setLookAndFeel (&lookAndFeel);
 
-        auto theme = NeonRegistry::getTheme();
+        auto& instance = p.getNeonInstance();
+        auto theme = instance.getRegistry().getTheme();
 
         selectionPanel.setCategoryNames ({ "FM", "FILTER", "AMP", "M/FX", "MAIN" });
         selectionPanel.setButtonColors (juce::Colour (0xFFFF00FF), juce::Colour (0xFF808080));
         selectionPanel.setModuleNames ({
-            "ALGO", "OP 1", "OP 2", "OP 3", "OP 4",
+            "ALGO", "OP 1", "OP 2", "OP 3", "OP 4", "OP 5", "OP 6",
             "FILTER", "F-ENV",
             "AMP", "A-ENV",
             "LFO 1", "LFO 2", "FX",
             "CTRL", "LIB"
         });
-        selectionPanel.setCategoryModules (0, { 0, 1, 2, 3, 4 });
-        selectionPanel.setCategoryModules (1, { 5, 6 });
-        selectionPanel.setCategoryModules (2, { 7, 8 });
-        selectionPanel.setCategoryModules (3, { 9, 10, 11 });
-        selectionPanel.setCategoryModules (4, { 12, 13 });
+        selectionPanel.setCategoryModules (0, { 0, 1, 2, 3, 4, 5, 6 });
+        selectionPanel.setCategoryModules (1, { 7, 8 });
+        selectionPanel.setCategoryModules (2, { 9, 10 });
+        selectionPanel.setCategoryModules (3, { 11, 12, 13 });
+        selectionPanel.setCategoryModules (4, { 14, 15 });
         selectionPanel.onModuleChanged = [this] (int index) { setActiveModule (index); };
         addAndMakeVisible (selectionPanel);
 
-        auto algo = std::make_unique<FmAlgorithmModule> ("Algorithm", theme.oscillator);
-        auto op1 = std::make_unique<FmOperatorModule> ("Op 1", juce::Colour (0xFF00DDFF), 0);
-        auto op2 = std::make_unique<FmOperatorModule> ("Op 2", juce::Colour (0xFF00FF88), 1);
-        auto op3 = std::make_unique<FmOperatorModule> ("Op 3", juce::Colour (0xFFFFAA00), 2);
-        auto op4 = std::make_unique<FmOperatorModule> ("Op 4", juce::Colour (0xFFFF4488), 3);
-        auto filter = std::make_unique<FmFilterModule> ("Filter", theme.filter);
-        auto filterEnv = std::make_unique<FmFilterEnvModule> ("Filter Env", theme.filter);
-        auto amp = std::make_unique<AmpModule> ("Amp Output", theme.amplifier);
-        auto envAmp = std::make_unique<DahdsrModule> ("Amp Env", theme.envelope, false);
-        auto lfo1 = std::make_unique<LfoModule> ("LFO 1", theme.modulation);
-        auto lfo2 = std::make_unique<LfoModule> ("LFO 2", theme.modulation);
-        auto fxModule = std::make_unique<FxModule> ("FX", theme.effects);
-        auto ctrlModule = std::make_unique<ControlModule> ("Control", theme.indicator);
-        auto libModule = std::make_unique<LibrarianModule> ("Librarian", theme.background.brighter());
+        auto algo = std::make_unique<FmAlgorithmModule> (instance, "Algorithm", theme.oscillator);
+        auto op1 = std::make_unique<FmOperatorModule> (instance, "Op 1", juce::Colour (0xFF00DDFF), 0);
+        auto op2 = std::make_unique<FmOperatorModule> (instance, "Op 2", juce::Colour (0xFF00FF88), 1);
+        auto op3 = std::make_unique<FmOperatorModule> (instance, "Op 3", juce::Colour (0xFFFFAA00), 2);
+        auto op4 = std::make_unique<FmOperatorModule> (instance, "Op 4", juce::Colour (0xFFFF4488), 3);
+        auto op5 = std::make_unique<FmOperatorModule> (instance, "Op 5", juce::Colour (0xFFAA66FF), 4);
+        auto op6 = std::make_unique<FmOperatorModule> (instance, "Op 6", juce::Colour (0xFFFFEE44), 5);
+        auto filter = std::make_unique<FmFilterModule> (instance, "Filter", theme.filter);
+        auto filterEnv = std::make_unique<FmFilterEnvModule> (instance, "Filter Env", theme.filter);
+        auto amp = std::make_unique<AmpModule> (instance, "Amp Output", theme.amplifier);
+        auto envAmp = std::make_unique<DahdsrModule> (instance, "Amp Env", theme.envelope, false);
+        auto lfo1 = std::make_unique<LfoModule> (instance, "LFO 1", theme.modulation);
+        auto lfo2 = std::make_unique<LfoModule> (instance, "LFO 2", theme.modulation);
+        auto fxModule = std::make_unique<FxModule> (instance, "FX", theme.effects);
+        auto ctrlModule = std::make_unique<ControlModule> (instance, "Control", theme.indicator);
+        auto libModule = std::make_unique<LibrarianModule> (instance, "Librarian", theme.background.brighter());
 
         modules.add (algo.release());
         modules.add (op1.release());
         modules.add (op2.release());
         modules.add (op3.release());
         modules.add (op4.release());
+        modules.add (op5.release());
+        modules.add (op6.release());
         modules.add (filter.release());
         modules.add (filterEnv.release());
         modules.add (amp.release());
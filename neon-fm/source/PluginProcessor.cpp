@@ -1,6 +1,7 @@
 #include "PluginProcessor.h"
 #include "PluginEditor.h"
 #include "ModulationTargets.h"
+#include "FmParameters.h"
 #include <neon_ui_components/core/NeonPatchManager.h>
 
 namespace neon
@@ -8,11 +9,16 @@ namespace neon
     NeonFmAudioProcessor::NeonFmAudioProcessor()
         : AudioProcessor (BusesProperties().withOutput ("Output", juce::AudioChannelSet::stereo(), true))
     {
-        PatchManager::getInstance().initialize ("NeonFM");
+        // Initialize modulation names for the UI components (shared by all instances)
+        static const auto targetNames = NeonRegistry::makeList (getNeonFmModTargetNames());
+        static const auto sourceNames = NeonRegistry::makeList (getNeonFmCtrlSourceNames());
+        neonInstance.getRegistry().setTargetNames (targetNames);
+        neonInstance.getRegistry().setSourceNames (sourceNames);
 
-        // Initialize modulation names for the UI components
-        NeonRegistry::setTargetNames (getNeonFmModTargetNames());
-        NeonRegistry::setSourceNames (getNeonFmCtrlSourceNames());
+        // Register the whole parameter set before the first patch is loaded into it
+        addNeonFmParameters (neonInstance);
+
+        neonInstance.getPatchManager().initialize ("NeonFM");
     }
 
     NeonFmAudioProcessor::~NeonFmAudioProcessor()
@@ -38,6 +44,9 @@ namespace neon
         for (auto i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
             buffer.clear (i, 0, buffer.getNumSamples());
 
+        // Patches requested by Program Change / Bank Select in earlier blocks, parsed off-thread
+        neonInstance.getPatchManager().applyPendingProgramChange();
+
         keyboardState.processNextMidiBuffer (midiMessages, 0, buffer.getNumSamples(), true);
 
         // Get host BPM
@@ -54,38 +63,41 @@ namespace neon
         if (!midiMessages.isEmpty())
             midiActivity = true;
 
-        for (const auto metadata : midiMessages)
+        // Render up to each event's sample position, then apply it
+        const juce::AudioSourceChannelInfo info (&buffer, 0, buffer.getNumSamples());
+        signalPath.beginBlock (info.numSamples);
+        renderSplitAtMidi (midiMessages, info.numSamples,
+                           [&] (int start, int num) { signalPath.renderRange (info, start, num); },
+                           [this] (const juce::MidiMessage& msg) { handleMidiMessage (msg); });
+    }
+
+    void NeonFmAudioProcessor::handleMidiMessage (const juce::MidiMessage& msg)
+    {
+        if (msg.isNoteOn())
+            signalPath.noteOn (msg.getNoteNumber(), msg.getFloatVelocity());
+        else if (msg.isNoteOff())
+            signalPath.noteOff (msg.getNoteNumber());
+        else if (msg.isAllNotesOff() || msg.isAllSoundOff())
         {
-            const auto msg = metadata.getMessage();
-            if (msg.isNoteOn())
-                signalPath.noteOn (msg.getNoteNumber(), msg.getFloatVelocity());
-            else if (msg.isNoteOff())
-                signalPath.noteOff (msg.getNoteNumber());
-            else if (msg.isAllNotesOff() || msg.isAllSoundOff())
-            {
-                for (int i = 0; i < 128; ++i) signalPath.noteOff (i);
-            }
-            else if (msg.isPitchWheel())
-                signalPath.setPitchWheel (juce::jmap ((float) msg.getPitchWheelValue(), 0.0f, 16383.0f, -1.0f, 1.0f));
-            else if (msg.isAftertouch())
-                signalPath.setPolyAftertouch (msg.getNoteNumber(), msg.getAfterTouchValue() / 127.0f);
-            else if (msg.isChannelPressure())
-                signalPath.setChannelAftertouch (msg.getChannelPressureValue() / 127.0f);
-            else if (msg.isController())
-            {
-                if (msg.getControllerNumber() == 1)
-                    signalPath.setModWheel (msg.getControllerValue() / 127.0f);
-                else if (msg.getControllerNumber() == 0 || msg.getControllerNumber() == 32)
-                    PatchManager::getInstance().selectBank (msg.getControllerValue());
-            }
-            else if (msg.isProgramChange())
-            {
-                PatchManager::getInstance().loadPatch (msg.getProgramChangeNumber());
-            }
+            for (int i = 0; i < 128; ++i) signalPath.noteOff (i);
+        }
+        else if (msg.isPitchWheel())
+            signalPath.setPitchWheel (juce::jmap ((float) msg.getPitchWheelValue(), 0.0f, 16383.0f, -1.0f, 1.0f));
+        else if (msg.isAftertouch())
+            signalPath.setPolyAftertouch (msg.getNoteNumber(), msg.getAfterTouchValue() / 127.0f);
+        else if (msg.isChannelPressure())
+            signalPath.setChannelAftertouch (msg.getChannelPressureValue() / 127.0f);
+        else if (msg.isController())
+        {
+            if (msg.getControllerNumber() == 1)
+                signalPath.setModWheel (msg.getControllerValue() / 127.0f);
+            else if (msg.getControllerNumber() == 0 || msg.getControllerNumber() == 32)
+                neonInstance.getPatchManager().requestBankSelect (msg.getControllerValue());
+        }
+        else if (msg.isProgramChange())
+        {
+            neonInstance.getPatchManager().requestProgramChange (msg.getProgramChangeNumber());
         }
-
-        juce::AudioSourceChannelInfo info (&buffer, 0, buffer.getNumSamples());
-        signalPath.getNextAudioBlock (info);
     }
 
     juce::AudioProcessorEditor* NeonFmAudioProcessor::createEditor()
@@ -95,12 +107,12 @@ namespace neon
 
     void NeonFmAudioProcessor::getStateInformation (juce::MemoryBlock& destData)
     {
-        PatchManager::getInstance().saveStateToMemory (destData);
+        neonInstance.getPatchManager().saveStateToMemory (destData);
     }
 
     void NeonFmAudioProcessor::setStateInformation (const void* data, int sizeInBytes)
     {
-        PatchManager::getInstance().loadStateFromMemory (data, sizeInBytes);
+        neonInstance.getPatchManager().loadStateFromMemory (data, sizeInBytes);
     }
 
 } // namespace neon
@@ -33,13 +33,17 @@ namespace neon
         void getStateInformation (juce::MemoryBlock&) override;
         void setStateInformation (const void*, int) override;
 
+        NeonInstance& getNeonInstance() { return neonInstance; }
         FmSignalPath& getSignalPath() { return signalPath; }
         juce::MidiKeyboardState& getKeyboardState() { return keyboardState; }
 
         std::atomic<bool> midiActivity { false };
 
     private:
-        FmSignalPath signalPath;
+        void handleMidiMessage (const juce::MidiMessage& msg);
+
+        NeonInstance neonInstance;
+        FmSignalPath signalPath { neonInstance };
         juce::MidiKeyboardState keyboardState;
 
         JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (NeonFmAudioProcessor)
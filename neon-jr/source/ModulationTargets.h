@@ -29,6 +29,8 @@ namespace neon
 
         Lfo1Amount1, Lfo1Amount2, Lfo1Amount3, Lfo1Amount4,
         Lfo2Amount1, Lfo2Amount2, Lfo2Amount3, Lfo2Amount4,
+
+        Osc1WtPos, // appended so saved routings keep their target indices
         
         Count
     };
@@ -60,7 +62,8 @@ namespace neon
             "Sub Level", "Sub Pitch",
             "Filter Cutoff", "Filter Res",
             "LFO 1 Amt 1", "LFO 1 Amt 2", "LFO 1 Amt 3", "LFO 1 Amt 4",
-            "LFO 2 Amt 1", "LFO 2 Amt 2", "LFO 2 Amt 3", "LFO 2 Amt 4"
+            "LFO 2 Amt 1", "LFO 2 Amt 2", "LFO 2 Amt 3", "LFO 2 Amt 4",
+            "Osc1 WT Pos"
         };
     }
 
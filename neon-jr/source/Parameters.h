@@ -0,0 +1,42 @@
+#pragma once
+#include <neon_ui_components/neon_ui_components.h>
+#include <neon_ui_components/modules/LfoModule.h>
+#include <neon_ui_components/modules/ArpModule.h>
+#include <neon_ui_components/modules/FxModule.h>
+#include <neon_ui_components/modules/ControlModule.h>
+#include <neon_ui_components/modules/ModMatrixModule.h>
+#include <neon_ui_components/modules/NoiseModule.h>
+#include <neon_ui_components/modules/SubOscModule.h>
+
+namespace neon
+{
+    /**
+     * addNeonJrParameters
+     * Every Neon Jr parameter, registered by the processor before the first patch loads.
+     * Needs the modulation target names set first; the module names match PluginEditor's.
+     */
+    static inline void addNeonJrParameters (NeonInstance& instance)
+    {
+        auto& registry = instance.getParameterRegistry();
+        const auto& names = instance.getRegistry();
+
+        { ParameterLayout l (registry, "Oscillator 1");  OscillatorModule::addParameters (l); }
+        { ParameterLayout l (registry, "Sub Osc");       SubOscModule::addParameters (l); }
+        { ParameterLayout l (registry, "Noise");         NoiseModule::addParameters (l); }
+        { ParameterLayout l (registry, "Ladder Filter"); LadderFilterModule::addParameters (l, names); }
+        { ParameterLayout l (registry, "Amp Output");    AmpModule::addParameters (l); }
+        { ParameterLayout l (registry, "Pitch Env");     DahdsrModule::addParameters (l, false, true); }
+        { ParameterLayout l (registry, "Filter Env");    DahdsrModule::addParameters (l, false, true); }
+        { ParameterLayout l (registry, "Mod Env");       DahdsrModule::addParameters (l); DahdsrModule::addModSlotParameters (l, names); }
+        { ParameterLayout l (registry, "Amp Env");       DahdsrModule::addParameters (l); }
+        { ParameterLayout l (registry, "LFO 1");         LfoModule::addParameters (l, names); }
+        { ParameterLayout l (registry, "LFO 2");         LfoModule::addParameters (l, names); }
+        { ParameterLayout l (registry, "Arp");           ArpModule::addParameters (l); }
+        { ParameterLayout l (registry, "Mod");           ModMatrixModule::addParameters (l, names); }
+        { ParameterLayout l (registry, "FX");            FxModule::addParameters (l); }
+        { ParameterLayout l (registry, "Control");       ControlModule::addParameters (l, true, true); }
+        { ParameterLayout l (registry, "Librarian");     LibrarianModule::addParameters (l); }
+
+        registry.setLayoutComplete();
+    }
+}
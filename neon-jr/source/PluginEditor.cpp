@@ -12,11 +12,13 @@
 namespace neon
 {
     NeonJrAudioProcessorEditor::NeonJrAudioProcessorEditor (NeonJrAudioProcessor& p)
-        : AudioProcessorEditor (&p), audioProcessor (p)
+        : AudioProcessorEditor (&p), audioProcessor (p),
+          debugLauncher (p.getNeonInstance().getParameterRegistry())
     {
         setLookAndFeel (&lookAndFeel);
 
-        auto theme = NeonRegistry::getTheme();
+        auto& instance = p.getNeonInstance();
+        auto theme = instance.getRegistry().getTheme();
 
         selectionPanel.setCategoryNames ({ "OSC", "FILTER", "AMP", "M/FX", "MAIN" });
         selectionPanel.setButtonColors (juce::Colour (0xFFFF00FF), juce::Colour (0xFF808080));
@@ -32,61 +34,35 @@ namespace neon
 
         addAndMakeVisible (selectionPanel);
         
-        // Modules
-        auto osc1 = std::make_unique<OscillatorModule> ("Oscillator 1", theme.oscillator);
-        auto subOsc = std::make_unique<SubOscModule> ("Sub Osc", theme.oscillator);
-        auto noise = std::make_unique<NoiseModule> ("Noise", theme.oscillator);
-        auto filter = std::make_unique<LadderFilterModule> ("Ladder Filter", theme.filter);
-        auto amp = std::make_unique<AmpModule> ("Amp Output", theme.amplifier);
+        // Modules: the parameters already exist (see addNeonJrParameters), each module adds its cards
+        auto osc1 = std::make_unique<OscillatorModule> (instance, "Oscillator 1", theme.oscillator);
+        auto subOsc = std::make_unique<SubOscModule> (instance, "Sub Osc", theme.oscillator);
+        auto noise = std::make_unique<NoiseModule> (instance, "Noise", theme.oscillator);
+        auto filter = std::make_unique<LadderFilterModule> (instance, "Ladder Filter", theme.filter);
+        auto amp = std::make_unique<AmpModule> (instance, "Amp Output", theme.amplifier);
         
-        auto envPitch = std::make_unique<DahdsrModule> ("Pitch Env", theme.envelope, false, true);  // Include modulation parameters
-        auto envFilter = std::make_unique<DahdsrModule> ("Filter Env", theme.envelope, false, true); // Include modulation parameters
-        auto envMod = std::make_unique<DahdsrModule> ("Mod Env", theme.envelope, false);  // No modulation parameters
-        auto envAmp = std::make_unique<DahdsrModule> ("Amp Env", theme.envelope, false);  // No modulation parameters
+        auto envPitch = std::make_unique<DahdsrModule> (instance, "Pitch Env", theme.envelope, false, true);  // Include modulation parameters
+        auto envFilter = std::make_unique<DahdsrModule> (instance, "Filter Env", theme.envelope, false, true); // Include modulation parameters
+        auto envMod = std::make_unique<DahdsrModule> (instance, "Mod Env", theme.envelope, false);  // No modulation parameters
+        auto envAmp = std::make_unique<DahdsrModule> (instance, "Amp Env", theme.envelope, false);  // No modulation parameters
+        DahdsrModule::addModSlotParameters (*envMod, instance.getRegistry());
 
-        auto lfo1 = std::make_unique<LfoModule> ("LFO 1", theme.modulation);
-        auto lfo2 = std::make_unique<LfoModule> ("LFO 2", theme.modulation);
+        auto lfo1 = std::make_unique<LfoModule> (instance, "LFO 1", theme.modulation);
+        auto lfo2 = std::make_unique<LfoModule> (instance, "LFO 2", theme.modulation);
 
-        auto arp = std::make_unique<ArpModule> ("Arp", theme.modulation);
+        auto arp = std::make_unique<ArpModule> (instance, "Arp", theme.modulation);
 
         // Control Matrix Module (Now renamed to MOD)
-        // 4-slot modulation matrix with [Source][Target][Amount]
-        auto modMatrix = std::make_unique<ModMatrixModule> ("Mod", theme.modulation);
-        auto targets = getModTargetNames();
-        std::vector<juce::String> sources = {"None", "Velocity", "Aftertouch", "Note#", 
-                                             "CC 1 (Mod Wheel)", "CC 11 (Expression)", "CC 2 (Breath)", 
-                                             "CC 4 (Foot Pedal)", "CC 64 (Sustain)",
-                                             "CC 16", "CC 17", "CC 18", "CC 19",
-                                             "CC 80", "CC 81", "CC 82", "CC 83"};
-
-        for (int i = 1; i <= 4; ++i)
-        {
-            modMatrix->addChoiceParameter ("Slot " + juce::String(i) + " Source", sources, 0);
-            modMatrix->addChoiceParameter ("Slot " + juce::String(i) + " Target", targets, 0);
-            modMatrix->addParameter       ("Slot " + juce::String(i) + " Amount", -100.0f, 100.0f, 0.0f);
-            modMatrix->addChoiceParameter (" ", {" "}, 0); // Spacer for alignment
-        }
+        auto modMatrix = std::make_unique<ModMatrixModule> (instance, "Mod", theme.modulation);
 
         // FX Module
-        auto fxModule = std::make_unique<FxModule> ("FX", theme.effects);
+        auto fxModule = std::make_unique<FxModule> (instance, "FX", theme.effects);
 
         // Global Controls Module
-        auto ctrlModule = std::make_unique<ControlModule> ("Control", theme.indicator);
+        auto ctrlModule = std::make_unique<ControlModule> (instance, "Control", theme.indicator, true, true);
 
         // Librarian Module
-        auto libModule = std::make_unique<LibrarianModule> ("Librarian", theme.background.brighter());
-
-        // ... (existing code continues)
-
-        // Page 1 has 7 cards (6 DAHDSR + 1 Mode). 
-        // We add one empty parameter to serve as a spacer to perfectly align the 4 Slot-pairs on Page 2.
-        envMod->addChoiceParameter (" ", {" "}, 0); 
-
-        for (int i = 1; i <= 4; ++i)
-        {
-            envMod->addChoiceParameter ("Slot " + juce::String(i) + " Target", targets, 0);
-            envMod->addParameter       ("Slot " + juce::String(i) + " Amount", -100.0f, 100.0f, 0.0f);
-        }
+        auto libModule = std::make_unique<LibrarianModule> (instance, "Librarian", theme.background.brighter());
 
         modules.add (osc1.release());        // 0 - OSC
         modules.add (subOsc.release());      // 1 - SUB
@@ -130,14 +106,37 @@ namespace neon
 
         float pb = audioProcessor.getSignalPath().getPitchWheel();
         float mw = audioProcessor.getSignalPath().getModWheel();
+        const auto& governor = audioProcessor.getSignalPath().getCpuGovernor();
+
+        // User wavetables load in the background; refresh their names when a new set lands
+        std::vector<juce::String> userTableNames;
+        juce::String userTableStatus;
+        if (auto* library = audioProcessor.getSignalPath().getUserWavetables())
+        {
+            if (int generation = library->getGeneration(); generation != userTableGeneration)
+            {
+                userTableGeneration = generation;
+                userTableNames = library->getChoiceNames();
+                userTableStatus = library->getStatus();
+            }
+        }
 
         for (auto* m : modules)
         {
             m->setMidiActive (midiIsActive);
             m->setVoiceCount (activeVoices);
             
+            if (auto* osc = dynamic_cast<OscillatorModule*> (m); osc != nullptr && ! userTableNames.empty())
+            {
+                osc->setUserWavetableNames (userTableNames);
+                osc->setUserWavetableStatus (userTableStatus);
+            }
+
             if (auto* ctrl = dynamic_cast<ControlModule*> (m))
+            {
                 ctrl->updateMeters (pb, mw, 0.0f); // Aftertouch is now per-voice, show 0 for global display
+                ctrl->updateCpuReport (governor.getLoad(), CpuGovernor::describe (governor.getDegradations()));
+            }
         }
     }
 
@@ -27,6 +27,7 @@ namespace neon
         NeonDebugLauncher debugLauncher;
         ModuleSelectionPanel selectionPanel;
         juce::OwnedArray<ModuleBase> modules;
+        int userTableGeneration = -1;
 
         JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (NeonJrAudioProcessorEditor)
     };
@@ -8,7 +8,8 @@ namespace neon
         : AudioProcessorEditor (&p), audioProcessor (p)
     {
         setLookAndFeel (&lookAndFeel);
-        auto theme = NeonRegistry::getTheme();
+        auto& instance = p.getNeonInstance();
+        auto theme = instance.getRegistry().getTheme();
 
         selectionPanel.setCategoryNames ({ "SID", "FILTER", "AMP", "M-FX", "MAIN" });
         selectionPanel.setButtonColors (juce::Colour (0xFF4040FF), juce::Colour (0xFF808080));
@@ -23,13 +24,13 @@ namespace neon
         selectionPanel.onModuleChanged = [this] (int index) { setActiveModule (index); };
         addAndMakeVisible (selectionPanel);
 
-        modules.add (std::make_unique<SidOscModule> ("Osc 1", theme.oscillator));
-        modules.add (std::make_unique<SidOscModule> ("Osc 2", theme.oscillator));
-        modules.add (std::make_unique<SidOscModule> ("Osc 3", theme.oscillator));
-        modules.add (std::make_unique<LadderFilterModule> ("Filter", theme.filter));
-        modules.add (std::make_unique<AmpModule> ("Amp Output", theme.amplifier));
-        modules.add (std::make_unique<DahdsrModule> ("Amp Env", theme.envelope, false));
-        modules.add (std::make_unique<LibrarianModule> ("Librarian", theme.background.brighter()));
+        modules.add (std::make_unique<SidOscModule> (instance, "Osc 1", theme.oscillator));
+        modules.add (std::make_unique<SidOscModule> (instance, "Osc 2", theme.oscillator));
+        modules.add (std::make_unique<SidOscModule> (instance, "Osc 3", theme.oscillator));
+        modules.add (std::make_unique<LadderFilterModule> (instance, "Filter", theme.filter));
+        modules.add (std::make_unique<AmpModule> (instance, "Amp Output", theme.amplifier));
+        modules.add (std::make_unique<DahdsrModule> (instance, "Amp Env", theme.envelope, false));
+        modules.add (std::make_unique<LibrarianModule> (instance, "Librarian", theme.background.brighter()));
 
         for (auto* m : modules)
             addChildComponent (m);
@@ -60,7 +61,7 @@ namespace neon
 
     void NeonSidAudioProcessorEditor::paint (juce::Graphics& g)
     {
-        g.fillAll (NeonRegistry::getTheme().background);
+        g.fillAll (audioProcessor.getNeonInstance().getRegistry().getTheme().background);
     }
 
     void NeonSidAudioProcessorEditor::resized()
@@ -1,5 +1,6 @@
 #include "PluginProcessor.h"
 #include "PluginEditor.h"
+#include "SidParameters.h"
 #include <neon_ui_components/core/NeonPatchManager.h>
 
 namespace neon
@@ -7,7 +8,10 @@ namespace neon
     NeonSidAudioProcessor::NeonSidAudioProcessor()
         : AudioProcessor (BusesProperties().withOutput ("Output", juce::AudioChannelSet::stereo(), true))
     {
-        PatchManager::getInstance().initialize ("NeonSid");
+        // Register the whole parameter set before the first patch is loaded into it
+        addNeonSidParameters (neonInstance);
+
+        neonInstance.getPatchManager().initialize ("NeonSid");
     }
 
     NeonSidAudioProcessor::~NeonSidAudioProcessor() = default;
@@ -33,21 +37,25 @@ namespace neon
 
         keyboardState.processNextMidiBuffer (midiMessages, 0, buffer.getNumSamples(), true);
 
-        for (const auto metadata : midiMessages)
-        {
-            const auto msg = metadata.getMessage();
-            if (msg.isNoteOn())
-                signalPath.noteOn (msg.getNoteNumber(), msg.getFloatVelocity());
-            else if (msg.isNoteOff())
-                signalPath.noteOff (msg.getNoteNumber());
-            else if (msg.isPitchWheel())
-                signalPath.setPitchWheel (juce::jmap ((float)msg.getPitchWheelValue(), 0.0f, 16383.0f, -1.0f, 1.0f));
-            else if (msg.isController() && msg.getControllerNumber() == 1)
-                signalPath.setModWheel (msg.getControllerValue() / 127.0f);
-        }
-
-        juce::AudioSourceChannelInfo info (&buffer, 0, buffer.getNumSamples());
-        signalPath.getNextAudioBlock (info);
+        // Render up to each event's sample position, then apply it
+        const juce::AudioSourceChannelInfo info (&buffer, 0, buffer.getNumSamples());
+        signalPath.setNonRealtime (isNonRealtime()); // bounces render at the top quality tier
+        signalPath.beginBlock (info.numSamples);
+        renderSplitAtMidi (midiMessages, info.numSamples,
+                           [&] (int start, int num) { signalPath.renderRange (info, start, num); },
+                           [this] (const juce::MidiMessage& msg) { handleMidiMessage (msg); });
+    }
+
+    void NeonSidAudioProcessor::handleMidiMessage (const juce::MidiMessage& msg)
+    {
+        if (msg.isNoteOn())
+            signalPath.noteOn (msg.getNoteNumber(), msg.getFloatVelocity());
+        else if (msg.isNoteOff())
+            signalPath.noteOff (msg.getNoteNumber());
+        else if (msg.isPitchWheel())
+            signalPath.setPitchWheel (juce::jmap ((float)msg.getPitchWheelValue(), 0.0f, 16383.0f, -1.0f, 1.0f));
+        else if (msg.isController() && msg.getControllerNumber() == 1)
+            signalPath.setModWheel (msg.getControllerValue() / 127.0f);
     }
 
     juce::AudioProcessorEditor* NeonSidAudioProcessor::createEditor()
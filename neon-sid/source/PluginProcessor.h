@@ -35,10 +35,14 @@ namespace neon
         void getStateInformation (juce::MemoryBlock&) override {}
         void setStateInformation (const void*, int) override {}
 
+        NeonInstance& getNeonInstance() { return neonInstance; }
         juce::MidiKeyboardState& getKeyboardState() { return keyboardState; }
 
     private:
-        SidSignalPath signalPath;
+        void handleMidiMessage (const juce::MidiMessage& msg);
+
+        NeonInstance neonInstance;
+        SidSignalPath signalPath { neonInstance };
         juce::MidiKeyboardState keyboardState;
 
         JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (NeonSidAudioProcessor)
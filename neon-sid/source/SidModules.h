@@ -11,24 +11,30 @@ namespace neon
     class SidOscModule : public ModuleBase
     {
     public:
-        SidOscModule (const juce::String& name, const juce::Colour& color)
-            : ModuleBase (name, color)
+        SidOscModule (NeonInstance& instance, const juce::String& name, const juce::Colour& color)
+            : ModuleBase (instance, name, color)
+        {
+            addParameters (*this);
+        }
+
+        static void addParameters (ParameterLayout& layout)
         {
             // Row 1: Primary Controls
-            addChoiceParameter ("Waveform", { "Triangle", "Sawtooth", "Pulse", "Noise" }, 2);
-            addParameter ("Volume", 0.0f, 1.0f, 0.8f);
-            addParameter ("Transp", -24.0f, 24.0f, 0.0f, false, 1.0f);
-            addParameter ("Fine", -100.0f, 100.0f, 0.0f);
+            layout.addChoiceParameter ("Waveform", { "Triangle", "Sawtooth", "Pulse", "Noise" }, 2);
+            layout.addParameter ("Volume", 0.0f, 1.0f, 0.8f);
+            layout.addParameter ("Transp", -24.0f, 24.0f, 0.0f, false, 1.0f);
+            layout.addParameter ("Fine", -100.0f, 100.0f, 0.0f);
 
             // Row 2: SID Special Features
-            addParameter ("Pulse Width", 0.01f, 0.99f, 0.5f);
-            addParameter ("Sync", 0.0f, 1.0f, 0.0f, true);
-            if (auto* p = parameters.back()) p->setBinaryLabels("OFF", "ON");
+            layout.addParameter ("Pulse Width", 0.01f, 0.99f, 0.5f);
+            if (auto* p = layout.addParameter ("Sync", 0.0f, 1.0f, 0.0f, true))
+                p->setBinaryLabels("OFF", "ON");
+            
+            if (auto* p = layout.addParameter ("Ring Mod", 0.0f, 1.0f, 0.0f, true))
             
-            addParameter ("Ring Mod", 0.0f, 1.0f, 0.0f, true);
-            if (auto* p = parameters.back()) p->setBinaryLabels("OFF", "ON");
+                p->setBinaryLabels("OFF", "ON");
             
-            addSpacer();
+            layout.addSpacer();
         }
 
     protected:
@@ -0,0 +1,27 @@
+#pragma once
+#include <neon_ui_components/neon_ui_components.h>
+#include "SidModules.h"
+
+namespace neon
+{
+    /**
+     * addNeonSidParameters
+     * Every Neon SID parameter, registered by the processor before the first patch loads.
+     * The filter uses NeonRegistry's default LP/HP/BP types.
+     */
+    static inline void addNeonSidParameters (NeonInstance& instance)
+    {
+        auto& registry = instance.getParameterRegistry();
+        const auto& names = instance.getRegistry();
+
+        { ParameterLayout l (registry, "Osc 1");      SidOscModule::addParameters (l); }
+        { ParameterLayout l (registry, "Osc 2");      SidOscModule::addParameters (l); }
+        { ParameterLayout l (registry, "Osc 3");      SidOscModule::addParameters (l); }
+        { ParameterLayout l (registry, "Filter");     LadderFilterModule::addParameters (l, names); }
+        { ParameterLayout l (registry, "Amp Output"); AmpModule::addParameters (l); }
+        { ParameterLayout l (registry, "Amp Env");    DahdsrModule::addParameters (l); }
+        { ParameterLayout l (registry, "Librarian");  LibrarianModule::addParameters (l); }
+
+        registry.setLayoutComplete();
+    }
+}
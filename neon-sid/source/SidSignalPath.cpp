@@ -2,12 +2,21 @@
 
 namespace neon
 {
-    SidSignalPath::SidSignalPath() : registry (ParameterRegistry::getInstance())
+    SidSignalPath::SidSignalPath (NeonInstance& instance) : registry (instance.getParameterRegistry())
     {
         for (auto& v : voices)
         {
             v.filter.setType (juce::dsp::StateVariableTPTFilterType::lowpass);
         }
+
+        // Unbound parameters keep these defaults
+        smoothers.setTarget (smOsc1Volume, osc1Params.volume);
+        smoothers.setTarget (smOsc2Volume, osc2Params.volume);
+        smoothers.setTarget (smOsc3Volume, osc3Params.volume);
+        smoothers.setTarget (smFilterCutoff, std::log2 (filterCutoff / 20.0f));
+        smoothers.setTarget (smFilterRes, filterRes);
+
+        bindParameters();
     }
 
     void SidSignalPath::prepareToPlay (int samplesPerBlockExpected, double sr)
@@ -15,9 +24,9 @@ namespace neon
         sampleRate = sr;
         for (auto& v : voices)
         {
-            v.osc1.setSampleRate (sr);
-            v.osc2.setSampleRate (sr);
-            v.osc3.setSampleRate (sr);
+            v.osc1.setSampleRate (sr * oscOversampling);
+            v.osc2.setSampleRate (sr * oscOversampling);
+            v.osc3.setSampleRate (sr * oscOversampling);
             v.ampEnv.setSampleRate (sr);
             
             juce::dsp::ProcessSpec spec;
@@ -26,6 +35,8 @@ namespace neon
             spec.numChannels = 1;
             v.filter.prepare (spec);
         }
+
+        smoothers.prepare (sr);
     }
 
     void SidSignalPath::releaseResources() {}
@@ -59,39 +70,128 @@ namespace neon
                 v.ampEnv.noteOff();
     }
 
+    void SidSignalPath::bindParameters()
+    {
+        auto bindOsc = [this] (const juce::String& prefix, OscHandles& h) {
+            h.waveform   = registry.getHandle (prefix, "Waveform");
+            h.volume     = registry.getHandle (prefix, "Volume");
+            h.transpose  = registry.getHandle (prefix, "Transp");
+            h.fine       = registry.getHandle (prefix, "Fine");
+            h.pulseWidth = registry.getHandle (prefix, "Pulse Width");
+            h.sync       = registry.getHandle (prefix, "Sync");
+            h.ringMod    = registry.getHandle (prefix, "Ring Mod");
+        };
+
+        bindOsc ("Osc 1", handles.osc1);
+        bindOsc ("Osc 2", handles.osc2);
+        bindOsc ("Osc 3", handles.osc3);
+
+        handles.filterCutoff = registry.getHandle ("Filter", "Cutoff");
+        handles.filterRes    = registry.getHandle ("Filter", "Resonance");
+        handles.filterType   = registry.getHandle ("Filter", "Filter Type");
+
+        handles.ampAttack  = registry.getHandle ("Amp Env", "Attack");
+        handles.ampDecay   = registry.getHandle ("Amp Env", "Decay");
+        handles.ampSustain = registry.getHandle ("Amp Env", "Sustain");
+        handles.ampRelease = registry.getHandle ("Amp Env", "Release");
+    }
+
     void SidSignalPath::updateParams()
     {
-        auto pollOsc = [&](const juce::String& prefix, OscParams& p) {
-            if (auto* param = registry.getParameter (prefix + "/Waveform")) p.waveform = (int)param->getValue();
-            if (auto* param = registry.getParameter (prefix + "/Volume")) p.volume = param->getValue();
-            if (auto* param = registry.getParameter (prefix + "/Transp")) p.transpose = param->getValue();
-            if (auto* param = registry.getParameter (prefix + "/Fine")) p.fine = param->getValue() / 100.0f;
-            if (auto* param = registry.getParameter (prefix + "/Pulse Width")) p.pulseWidth = param->getValue();
-            if (auto* param = registry.getParameter (prefix + "/Sync")) p.sync = param->getValue() > 0.5f;
-            if (auto* param = registry.getParameter (prefix + "/Ring Mod")) p.ringMod = param->getValue() > 0.5f;
+        // Nothing moved anywhere in the registry since the last poll
+        auto generation = registry.getGeneration();
+        if (! paramsDirty && generation == lastParamGeneration)
+            return;
+
+        paramsDirty = false;
+        lastParamGeneration = generation;
+
+        auto pollOsc = [&](const OscHandles& h, OscParams& p, int volumeIndex) {
+            if (registry.isBound (h.waveform)) p.waveform = (int)registry.getValue (h.waveform);
+            if (registry.isBound (h.volume)) smoothers.setTarget (volumeIndex, registry.getValue (h.volume));
+            if (registry.isBound (h.transpose)) p.transpose = registry.getValue (h.transpose);
+            if (registry.isBound (h.fine)) p.fine = registry.getValue (h.fine) / 100.0f;
+            if (registry.isBound (h.pulseWidth)) p.pulseWidth = registry.getValue (h.pulseWidth);
+            if (registry.isBound (h.sync)) p.sync = registry.getValue (h.sync) > 0.5f;
+            if (registry.isBound (h.ringMod)) p.ringMod = registry.getValue (h.ringMod) > 0.5f;
         };
 
-        pollOsc ("Osc 1", osc1Params);
-        pollOsc ("Osc 2", osc2Params);
-        pollOsc ("Osc 3", osc3Params);
+        pollOsc (handles.osc1, osc1Params, smOsc1Volume);
+        pollOsc (handles.osc2, osc2Params, smOsc2Volume);
+        pollOsc (handles.osc3, osc3Params, smOsc3Volume);
 
-        if (auto* p = registry.getParameter ("Filter/Cutoff")) filterCutoff = p->getValue();
-        if (auto* p = registry.getParameter ("Filter/Resonance")) filterRes = p->getValue();
-        if (auto* p = registry.getParameter ("Filter/Filter Type")) filterType = (int)p->getValue();
+        if (registry.isBound (handles.filterCutoff)) smoothers.setTarget (smFilterCutoff, std::log2 (juce::jmax (20.0f, registry.getValue (handles.filterCutoff)) / 20.0f));
+        if (registry.isBound (handles.filterRes)) smoothers.setTarget (smFilterRes, registry.getValue (handles.filterRes));
+        if (registry.isBound (handles.filterType)) filterType = (int)registry.getValue (handles.filterType);
 
-        if (auto* p = registry.getParameter ("Amp Env/Attack"))  ampParams.attack = p->getValue() / 1000.0f;
-        if (auto* p = registry.getParameter ("Amp Env/Decay"))   ampParams.decay = p->getValue() / 1000.0f;
-        if (auto* p = registry.getParameter ("Amp Env/Sustain")) ampParams.sustain = p->getValue();
-        if (auto* p = registry.getParameter ("Amp Env/Release")) ampParams.release = p->getValue() / 1000.0f;
+        if (registry.isBound (handles.ampAttack))  ampParams.attack = registry.getValue (handles.ampAttack) / 1000.0f;
+        if (registry.isBound (handles.ampDecay))   ampParams.decay = registry.getValue (handles.ampDecay) / 1000.0f;
+        if (registry.isBound (handles.ampSustain)) ampParams.sustain = registry.getValue (handles.ampSustain);
+        if (registry.isBound (handles.ampRelease)) ampParams.release = registry.getValue (handles.ampRelease) / 1000.0f;
+    }
+
+    void SidSignalPath::applySmoothedParams()
+    {
+        osc1Params.volume = smoothers.get (smOsc1Volume);
+        osc2Params.volume = smoothers.get (smOsc2Volume);
+        osc3Params.volume = smoothers.get (smOsc3Volume);
+        filterCutoff = 20.0f * std::exp2 (smoothers.get (smFilterCutoff));
+        filterRes = smoothers.get (smFilterRes);
     }
 
     void SidSignalPath::getNextAudioBlock (const juce::AudioSourceChannelInfo& bufferToFill)
     {
-        updateParams();
+        beginBlock (bufferToFill.numSamples);
+        renderRange (bufferToFill, 0, bufferToFill.numSamples);
+    }
+
+    void SidSignalPath::beginBlock (int numSamples)
+    {
+        registry.beginAudioBlock (numSamples, sampleRate);
+    }
+
+    void SidSignalPath::renderRange (const juce::AudioSourceChannelInfo& block, int start, int numSamples)
+    {
+        // Render in segments split at parameter events so UI changes land sample-accurately
+        const int end = start + numSamples;
+
+        for (int pos = start; pos < end;)
+        {
+            int next = juce::jmin (end, registry.applyParameterEvents (pos));
+            updateParams();
+
+            // While anything is gliding, step in short control blocks
+            if (smoothers.isSmoothing())
+                next = juce::jmin (next, pos + SmoothingBank<numSmoothedParams>::controlBlockSize);
+
+            if (smoothers.advance (next - pos))
+                applySmoothedParams();
+
+            renderBlock ({ block.buffer, block.startSample + pos, next - pos });
+            pos = next;
+        }
+    }
+
+    void SidSignalPath::renderBlock (const juce::AudioSourceChannelInfo& bufferToFill)
+    {
         bufferToFill.clearActiveBufferRegion();
         auto* outL = bufferToFill.buffer->getWritePointer (0, bufferToFill.startSample);
         auto* outR = bufferToFill.buffer->getNumChannels() > 1 ? bufferToFill.buffer->getWritePointer (1, bufferToFill.startSample) : nullptr;
 
+        // Quality tier for this block; the oscillators follow a change of oversampling
+        const int factor = RenderQuality::get (getRenderQuality()).oversampling;
+
+        if (factor != oscOversampling)
+        {
+            oscOversampling = factor;
+            for (auto& v : voices)
+            {
+                v.osc1.setSampleRate (sampleRate * factor);
+                v.osc2.setSampleRate (sampleRate * factor);
+                v.osc3.setSampleRate (sampleRate * factor);
+            }
+        }
+
         for (int s = 0; s < bufferToFill.numSamples; ++s)
         {
             float mixedSample = 0.0f;
@@ -99,9 +199,10 @@ namespace neon
             {
                 if (!v.isActive.load()) continue;
 
-                float baseFreq = (float)juce::MidiMessage::getMidiNoteInHertz (v.midiNote + (int)pitchWheel * 12);
+                // Note, bend and per-oscillator tuning all in semitones from A4
+                float baseSemis = (float)(v.midiNote + (int)pitchWheel * 12 - 69);
                 auto getFreq = [&](const OscParams& p) { 
-                    return baseFreq * std::pow (2.0f, (p.transpose + p.fine) / 12.0f); 
+                    return 440.0f * fastmath::semitonesToRatio (baseSemis + p.transpose + p.fine); 
                 };
 
                 v.osc1.setFrequency (getFreq(osc1Params));
@@ -116,16 +217,22 @@ namespace neon
                 v.osc3.setWaveform (osc3Params.waveform);
                 v.osc3.setPulseWidth (osc3Params.pulseWidth);
 
-                // SID Sync/Ring Routing: 1 targets 3, 2 targets 1, 3 targets 2
-                float s1 = v.osc1.process (v.osc3.getPhase(), osc1Params.sync, 0.0f, false);
-                float s2 = v.osc2.process (v.osc1.getPhase(), osc2Params.sync, s1, osc2Params.ringMod);
-                float s3 = v.osc3.process (v.osc2.getPhase(), osc3Params.sync, s2, osc3Params.ringMod);
-                
-                // Ring mod for Osc 1 uses Osc 3
-                v.osc1.process (0.0f, false, s3, osc1Params.ringMod); // Second pass for Ring Mod on Osc 1 if needed? 
-                // Actually SID ring mod is simpler. Let's just do one pass per sample correctly.
-                
-                float voiceMix = (s1 * osc1Params.volume) + (s2 * osc2Params.volume) + (s3 * osc3Params.volume);
+                float sub[Decimator::maxFactor];
+                for (int k = 0; k < factor; ++k)
+                {
+                    // SID Sync/Ring Routing: 1 targets 3, 2 targets 1, 3 targets 2
+                    float s1 = v.osc1.process (v.osc3.getPhase(), osc1Params.sync, 0.0f, false);
+                    float s2 = v.osc2.process (v.osc1.getPhase(), osc2Params.sync, s1, osc2Params.ringMod);
+                    float s3 = v.osc3.process (v.osc2.getPhase(), osc3Params.sync, s2, osc3Params.ringMod);
+
+                    // Ring mod for Osc 1 uses Osc 3
+                    v.osc1.process (0.0f, false, s3, osc1Params.ringMod); // Second pass for Ring Mod on Osc 1 if needed?
+                    // Actually SID ring mod is simpler. Let's just do one pass per sample correctly.
+
+                    sub[k] = (s1 * osc1Params.volume) + (s2 * osc2Params.volume) + (s3 * osc3Params.volume);
+                }
+
+                float voiceMix = v.decimator.process (sub, factor);
                 
                 v.filter.setCutoffFrequency (filterCutoff);
                 v.filter.setResonance (filterRes);
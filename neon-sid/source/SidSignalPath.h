@@ -17,18 +17,27 @@ namespace neon
     class SidSignalPath : public juce::AudioSource
     {
     public:
-        SidSignalPath();
+        explicit SidSignalPath (NeonInstance& instance);
         ~SidSignalPath() override = default;
 
         void prepareToPlay (int samplesPerBlockExpected, double sampleRate) override;
         void getNextAudioBlock (const juce::AudioSourceChannelInfo& bufferToFill) override;
         void releaseResources() override;
 
+        // Sample-accurate MIDI: beginBlock() once per host block, then renderRange() for each
+        // stretch between events. start is the offset inside the block.
+        void beginBlock (int numSamples);
+        void renderRange (const juce::AudioSourceChannelInfo& block, int start, int numSamples);
+
         void noteOn (int midiNote, float velocity);
         void noteOff (int midiNote);
         void setPitchWheel (float value) { pitchWheel = value; }
         void setModWheel (float value) { modWheel = value; }
 
+        /** SID has no Quality control: it plays at REALTIME and renders at OFFLINE while processBlock reports a bounce. */
+        void setNonRealtime (bool isNonRealtime) { nonRealtime.store (isNonRealtime); }
+        RenderQuality::Tier getRenderQuality() const { return RenderQuality::resolve (RenderQuality::realtime, nonRealtime.load()); }
+
         struct OscParams
         {
             int waveform = 0;
@@ -48,12 +57,14 @@ namespace neon
             double noteOnTime = 0.0;
 
             SidOscillator osc1, osc2, osc3;
+            Decimator decimator; // back from the oversampled oscillator rate
             juce::ADSR ampEnv;
             juce::dsp::StateVariableTPTFilter<float> filter;
 
             void reset()
             {
                 osc1.reset(); osc2.reset(); osc3.reset();
+                decimator.reset();
                 ampEnv.reset();
                 filter.reset();
                 isActive.store (false);
@@ -62,7 +73,25 @@ namespace neon
         };
 
     private:
+        void bindParameters();
         void updateParams();
+        void renderBlock (const juce::AudioSourceChannelInfo& bufferToFill);
+        void applySmoothedParams();
+
+        struct OscHandles
+        {
+            ParameterHandle waveform, volume, transpose, fine, pulseWidth, sync, ringMod;
+        };
+
+        struct ParamHandles
+        {
+            OscHandles osc1, osc2, osc3;
+            ParameterHandle filterCutoff, filterRes, filterType;
+            ParameterHandle ampAttack, ampDecay, ampSustain, ampRelease;
+        } handles;
+
+        uint32_t lastParamGeneration = 0;
+        bool paramsDirty = true;
 
         ParameterRegistry& registry;
         std::array<Voice, 8> voices;
@@ -70,6 +99,11 @@ namespace neon
         float pitchWheel = 0.0f;
         float modWheel = 0.0f;
 
+        // Render quality: the naive waves alias, so the tiers that oversample run the
+        // three oscillators at a multiple of the rate
+        std::atomic<bool> nonRealtime { false };
+        int oscOversampling = 1; // the multiple the oscillators are currently prepared for
+
         OscParams osc1Params, osc2Params, osc3Params;
         
         float filterCutoff = 1000.0f;
@@ -77,5 +111,17 @@ namespace neon
         int filterType = 0;
 
         juce::ADSR::Parameters ampParams;
+
+        // Continuous parameters glide through one bank; applySmoothedParams() copies
+        // the current values into the caches above.
+        enum SmoothedParam
+        {
+            smOsc1Volume, smOsc2Volume, smOsc3Volume,
+            smFilterCutoff, // octaves above 20 Hz
+            smFilterRes,
+            numSmoothedParams
+        };
+
+        SmoothingBank<numSmoothedParams> smoothers;
     };
 }
@@ -192,7 +192,7 @@ float BassEngine::renderVoices()
             // Still add sub if specified
             if (preset.subOscLevel > 0.0f)
             {
-                float subSample = std::sin(subPhases[i] * juce::MathConstants<float>::twoPi);
+                float subSample = neon::fastmath::sin2pi(subPhases[i]);
                 sample = sample * (1.0f - preset.subOscLevel) + subSample * preset.subOscLevel;
             }
         }
@@ -213,7 +213,7 @@ float BassEngine::renderVoices()
             float subOsc = 0.0f;
             if (preset.subOscLevel > 0.0f)
             {
-                subOsc = std::sin(subPhases[i] * juce::MathConstants<float>::twoPi);
+                subOsc = neon::fastmath::sin2pi(subPhases[i]);
             }
             
             // Mix oscillators
@@ -244,9 +244,9 @@ float BassEngine::processLPF(float input, float cutoff, float resonance, LPFStat
 {
     // Convert normalized cutoff to filter coefficient
     // Map 0-1 to roughly 20Hz - 20kHz in a musically useful curve
-    float freq = 20.0f * std::pow(1000.0f, cutoff);
+    float freq = 20.0f * neon::fastmath::exp2(cutoff * 9.96578428f); // 1000^cutoff
     float w = 2.0f * juce::MathConstants<float>::pi * freq / static_cast<float>(sampleRate);
-    float g = std::tan(w * 0.5f);
+    float g = neon::fastmath::tan(w * 0.5f);
     
     // Resonance (0-1 maps to Q of 0.5 to 20)
     float Q = 0.5f + resonance * 19.5f;
@@ -83,9 +83,9 @@ void Chorus::processBlock(juce::AudioBuffer<float>& buffer)
         delayLineR[writePos] = dryR;
         
         // Calculate modulated delay times using 3 LFOs
-        float mod1 = std::sin(lfoPhase1 * juce::MathConstants<float>::twoPi);
-        float mod2 = std::sin(lfoPhase2 * juce::MathConstants<float>::twoPi);
-        float mod3 = std::sin(lfoPhase3 * juce::MathConstants<float>::twoPi);
+        float mod1 = neon::fastmath::sin2pi(lfoPhase1);
+        float mod2 = neon::fastmath::sin2pi(lfoPhase2);
+        float mod3 = neon::fastmath::sin2pi(lfoPhase3);
         
         // Left channel uses LFO 1 and 2
         float delayL1 = baseDelaySamples + mod1 * depthSamples;
@@ -153,7 +153,7 @@ float DrumEngine::renderKick()
     float freq = 50.0f + (kick.pitchEnv * 100.0f);
     float phaseInc = freq / static_cast<float>(sampleRate);
     
-    float out = std::sin(kick.phase * juce::MathConstants<float>::twoPi);
+    float out = neon::fastmath::sin2pi(kick.phase);
     kick.phase = std::fmod(kick.phase + phaseInc, 1.0f);
 
     return out * kick.ampEnv;
@@ -170,7 +170,7 @@ float DrumEngine::renderSnare()
     static float snarePhase = 0.0f;
     float freq = 180.0f;
     float phaseInc = freq / static_cast<float>(sampleRate);
-    float pop = std::sin(snarePhase * juce::MathConstants<float>::twoPi);
+    float pop = neon::fastmath::sin2pi(snarePhase);
     snarePhase = std::fmod(snarePhase + phaseInc, 1.0f);
 
     return (noise * 0.7f + pop * 0.3f) * snare.ampEnv;
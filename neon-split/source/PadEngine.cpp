@@ -109,7 +109,7 @@ float PadEngine::renderVoices()
         for (int osc = 0; osc < preset.numOscillators; ++osc)
         {
             float detune = preset.detuneAmounts[osc];
-            float oscFreq = voice.frequency * std::pow(2.0f, detune / 1200.0f); // cents to ratio
+            float oscFreq = voice.frequency * neon::fastmath::centsToRatio(detune);
             float freqIncrement = oscFreq * phaseIncrement;
             
             state.oscPhases[osc] += freqIncrement;
@@ -12,7 +12,8 @@ namespace neon
     {
         setLookAndFeel (&lookAndFeel);
 
-        auto theme = NeonRegistry::getTheme();
+        auto& instance = p.getNeonInstance();
+        auto theme = instance.getRegistry().getTheme();
 
         selectionPanel.setCategoryNames ({ "BASS", "PAD", "ARP", "DRUM", "MAIN" });
         selectionPanel.setButtonColors (juce::Colour (0xFFFF00FF), juce::Colour (0xFF808080));
@@ -25,12 +26,12 @@ namespace neon
         selectionPanel.onModuleChanged = [this] (int index) { setActiveModule (index); };
         addAndMakeVisible (selectionPanel);
 
-        auto bass = std::make_unique<BassModule> ("Bass", juce::Colour (0xFF0088FF));
-        auto pad = std::make_unique<PadModule> ("Pad", juce::Colour (0xFF00CCAA));
-        auto arp = std::make_unique<ArpSplitModule> ("Arp", juce::Colour (0xFFFFAA00));
-        auto drums = std::make_unique<DrumModule> ("Drums", juce::Colour (0xFFFF4488));
-        auto splitCtrl = std::make_unique<SplitControlModule> ("Split", theme.indicator);
-        auto libModule = std::make_unique<LibrarianModule> ("Librarian", theme.background.brighter());
+        auto bass = std::make_unique<BassModule> (instance, "Bass", juce::Colour (0xFF0088FF));
+        auto pad = std::make_unique<PadModule> (instance, "Pad", juce::Colour (0xFF00CCAA));
+        auto arp = std::make_unique<ArpSplitModule> (instance, "Arp", juce::Colour (0xFFFFAA00));
+        auto drums = std::make_unique<DrumModule> (instance, "Drums", juce::Colour (0xFFFF4488));
+        auto splitCtrl = std::make_unique<SplitControlModule> (instance, "Split", theme.indicator);
+        auto libModule = std::make_unique<LibrarianModule> (instance, "Librarian", theme.background.brighter());
 
         modules.add (bass.release());
         modules.add (pad.release());
@@ -1,6 +1,7 @@
 #include "PluginProcessor.h"
 #include "PluginEditor.h"
 #include "ModulationTargets.h"
+#include "SplitParameters.h"
 #include <neon_ui_components/core/NeonPatchManager.h>
 
 namespace neon
@@ -8,11 +9,16 @@ namespace neon
     NeonSplitAudioProcessor::NeonSplitAudioProcessor()
         : AudioProcessor (BusesProperties().withOutput ("Output", juce::AudioChannelSet::stereo(), true))
     {
-        PatchManager::getInstance().initialize ("NeonSplit");
+        // Initialize modulation names for the UI components (shared by all instances)
+        static const auto targetNames = NeonRegistry::makeList (getNeonSplitModTargetNames());
+        static const auto sourceNames = NeonRegistry::makeList (getNeonSplitCtrlSourceNames());
+        neonInstance.getRegistry().setTargetNames (targetNames);
+        neonInstance.getRegistry().setSourceNames (sourceNames);
 
-        // Initialize modulation names for the UI components
-        NeonRegistry::setTargetNames (getNeonSplitModTargetNames());
-        NeonRegistry::setSourceNames (getNeonSplitCtrlSourceNames());
+        // Register the whole parameter set before the first patch is loaded into it
+        addNeonSplitParameters (neonInstance);
+
+        neonInstance.getPatchManager().initialize ("NeonSplit");
     }
 
     NeonSplitAudioProcessor::~NeonSplitAudioProcessor()
@@ -36,6 +42,9 @@ namespace neon
         for (auto i = getTotalNumInputChannels(); i < getTotalNumOutputChannels(); ++i)
             buffer.clear (i, 0, buffer.getNumSamples());
 
+        // Patches requested by Program Change / Bank Select in earlier blocks, parsed off-thread
+        neonInstance.getPatchManager().applyPendingProgramChange();
+
         // Inject on-screen keyboard events into the MIDI buffer
         keyboardState.processNextMidiBuffer (midiMessages, 0, buffer.getNumSamples(), true);
 
@@ -63,11 +72,11 @@ namespace neon
             if (msg.isController())
             {
                 if (msg.getControllerNumber() == 0 || msg.getControllerNumber() == 32)
-                    PatchManager::getInstance().selectBank (msg.getControllerValue());
+                    neonInstance.getPatchManager().requestBankSelect (msg.getControllerValue());
             }
             else if (msg.isProgramChange())
             {
-                PatchManager::getInstance().loadPatch (msg.getProgramChangeNumber());
+                neonInstance.getPatchManager().requestProgramChange (msg.getProgramChangeNumber());
             }
         }
 
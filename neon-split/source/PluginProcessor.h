@@ -33,13 +33,15 @@ namespace neon
         void getStateInformation (juce::MemoryBlock&) override {}
         void setStateInformation (const void*, int) override {}
 
+        NeonInstance& getNeonInstance() { return neonInstance; }
         SplitSignalPath& getSignalPath() { return signalPath; }
         juce::MidiKeyboardState& getKeyboardState() { return keyboardState; }
 
         std::atomic<bool> midiActivity { false };
 
     private:
-        SplitSignalPath signalPath;
+        NeonInstance neonInstance;
+        SplitSignalPath signalPath { neonInstance };
         juce::MidiKeyboardState keyboardState;
 
         JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (NeonSplitAudioProcessor)
@@ -16,51 +16,59 @@ namespace neon
     class BassModule : public ModuleBase
     {
     public:
-        BassModule (const juce::String& name, const juce::Colour& color)
-            : ModuleBase (name, color)
+        BassModule (NeonInstance& instance, const juce::String& name, const juce::Colour& color)
+            : ModuleBase (instance, name, color)
+        {
+            addParameters (*this);
+
+            auto& reg = instance.getParameterRegistry();
+            for (int i = 0; i < 16; ++i)
+                stepParams[i] = reg.getParameter (name + "/Step " + juce::String (i + 1));
+
+            moduleNameDisplay.setText ("BASS ENGINE", juce::dontSendNotification);
+            lastAdjustedIndex = 0;
+        }
+
+        static void addParameters (ParameterLayout& layout)
         {
             // Page 1, Row 1
             std::vector<juce::String> presetNames;
             for (int i = 0; i < 16; ++i)
                 presetNames.push_back ("Preset " + juce::String (i + 1));
-            addChoiceParameter ("Preset", presetNames, 0);
+            layout.addChoiceParameter ("Preset", presetNames, 0);
 
-            addParameter ("Pattern On", 0.0f, 1.0f, 0.0f, true);
-            if (auto* p = parameters.back()) p->setBinaryLabels ("OFF", "ON");
+            if (auto* p = layout.addParameter ("Pattern On", 0.0f, 1.0f, 0.0f, true))
+                p->setBinaryLabels ("OFF", "ON");
 
             std::vector<juce::String> patterns = { "Off", "8th Drive", "Oct Bounce", "Sync Pulse", "Pump 8ths", "Stac 16ths", "User Seq" };
-            addChoiceParameter ("Pattern", patterns, 0);
+            layout.addChoiceParameter ("Pattern", patterns, 0);
 
             std::vector<juce::String> stepLens = { "1/1", "1/2", "1/4", "1/8", "1/16", "1/32" };
-            addChoiceParameter ("Step Len", stepLens, 4);
+            layout.addChoiceParameter ("Step Len", stepLens, 4);
 
             // Page 1, Row 2
-            addParameter ("LPF", 20.0f, 20000.0f, 20000.0f);
-            addParameter ("Volume", 0.0f, 1.0f, 0.8f);
-            addParameter ("Delay", 0.0f, 1.0f, 0.0f, true);
-            if (auto* p = parameters.back()) p->setBinaryLabels ("OFF", "ON");
-            addSpacer();
+            layout.addParameter ("LPF", 20.0f, 20000.0f, 20000.0f);
+            layout.addParameter ("Volume", 0.0f, 1.0f, 0.8f);
+            if (auto* p = layout.addParameter ("Delay", 0.0f, 1.0f, 0.0f, true))
+                p->setBinaryLabels ("OFF", "ON");
+            layout.addSpacer();
 
             // Page 2, Row 1
             std::vector<juce::String> dlyTimes = { "1/16", "1/8", "1/4", "1/2", "1/1" };
-            addChoiceParameter ("Dly Time", dlyTimes, 1);
-            addParameter ("Dly Mix", 0.0f, 1.0f, 0.3f);
-            addSpacer();
-            addSpacer();
+            layout.addChoiceParameter ("Dly Time", dlyTimes, 1);
+            layout.addParameter ("Dly Mix", 0.0f, 1.0f, 0.3f);
+            layout.addSpacer();
+            layout.addSpacer();
 
             // Page 2, Row 2
-            addSpacer();
-            addSpacer();
-            addSpacer();
-            addSpacer();
+            layout.addSpacer();
+            layout.addSpacer();
+            layout.addSpacer();
+            layout.addSpacer();
 
-            // Register hidden step parameters directly in the registry (not as cards)
-            auto& reg = ParameterRegistry::getInstance();
+            // Hidden step parameters, drawn by the grid instead of as cards
             for (int i = 0; i < 16; ++i)
-                stepParams[i] = reg.getOrCreateParameter (name, "Step " + juce::String (i + 1), 0.0f, 1.0f, 1.0f, true);
-
-            moduleNameDisplay.setText ("BASS ENGINE", juce::dontSendNotification);
-            lastAdjustedIndex = 0;
+                layout.addHiddenParameter ("Step " + juce::String (i + 1), 0.0f, 1.0f, 1.0f, true);
         }
 
     protected:
@@ -173,44 +181,49 @@ namespace neon
     class PadModule : public ModuleBase
     {
     public:
-        PadModule (const juce::String& name, const juce::Colour& color)
-            : ModuleBase (name, color)
+        PadModule (NeonInstance& instance, const juce::String& name, const juce::Colour& color)
+            : ModuleBase (instance, name, color)
+        {
+            addParameters (*this);
+
+            moduleNameDisplay.setText ("PAD ENGINE", juce::dontSendNotification);
+            lastAdjustedIndex = 0;
+        }
+
+        static void addParameters (ParameterLayout& layout)
         {
             // Page 1, Row 1
             std::vector<juce::String> presetNames;
             for (int i = 0; i < 16; ++i)
                 presetNames.push_back ("Preset " + juce::String (i + 1));
-            addChoiceParameter ("Preset", presetNames, 0);
+            layout.addChoiceParameter ("Preset", presetNames, 0);
 
             std::vector<juce::String> chorusTypes = { "Type I", "Type II", "Type III" };
-            addChoiceParameter ("Chorus", chorusTypes, 0);
-            addParameter ("Chorus Mix", 0.0f, 1.0f, 0.5f);
-            addParameter ("Volume", 0.0f, 1.0f, 0.8f);
+            layout.addChoiceParameter ("Chorus", chorusTypes, 0);
+            layout.addParameter ("Chorus Mix", 0.0f, 1.0f, 0.5f);
+            layout.addParameter ("Volume", 0.0f, 1.0f, 0.8f);
 
             // Page 1, Row 2
-            addParameter ("Delay", 0.0f, 1.0f, 0.0f, true);
-            if (auto* p = parameters.back()) p->setBinaryLabels ("OFF", "ON");
+            if (auto* p = layout.addParameter ("Delay", 0.0f, 1.0f, 0.0f, true))
+                p->setBinaryLabels ("OFF", "ON");
 
             std::vector<juce::String> dlyTimes = { "1/16", "1/8", "1/4", "1/2", "1/1" };
-            addChoiceParameter ("Dly Time", dlyTimes, 2);
-            addParameter ("Dly Mix", 0.0f, 1.0f, 0.25f);
-            addSpacer();
+            layout.addChoiceParameter ("Dly Time", dlyTimes, 2);
+            layout.addParameter ("Dly Mix", 0.0f, 1.0f, 0.25f);
+            layout.addSpacer();
 
             // Page 2, Row 1
-            addParameter ("Reverb", 0.0f, 1.0f, 1.0f, true);
-            if (auto* p = parameters.back()) p->setBinaryLabels ("OFF", "ON");
-            addParameter ("Rvb Time", 0.1f, 10.0f, 2.5f);
-            addParameter ("Rvb Mix", 0.0f, 1.0f, 0.35f);
-            addSpacer();
+            if (auto* p = layout.addParameter ("Reverb", 0.0f, 1.0f, 1.0f, true))
+                p->setBinaryLabels ("OFF", "ON");
+            layout.addParameter ("Rvb Time", 0.1f, 10.0f, 2.5f);
+            layout.addParameter ("Rvb Mix", 0.0f, 1.0f, 0.35f);
+            layout.addSpacer();
 
             // Page 2, Row 2
-            addSpacer();
-            addSpacer();
-            addSpacer();
-            addSpacer();
-
-            moduleNameDisplay.setText ("PAD ENGINE", juce::dontSendNotification);
-            lastAdjustedIndex = 0;
+            layout.addSpacer();
+            layout.addSpacer();
+            layout.addSpacer();
+            layout.addSpacer();
         }
 
     protected:
@@ -263,46 +276,51 @@ namespace neon
     class ArpSplitModule : public ModuleBase
     {
     public:
-        ArpSplitModule (const juce::String& name, const juce::Colour& color)
-            : ModuleBase (name, color)
+        ArpSplitModule (NeonInstance& instance, const juce::String& name, const juce::Colour& color)
+            : ModuleBase (instance, name, color)
+        {
+            addParameters (*this);
+
+            moduleNameDisplay.setText ("ARPEGGIATOR", juce::dontSendNotification);
+            lastAdjustedIndex = 0;
+        }
+
+        static void addParameters (ParameterLayout& layout)
         {
             // Page 1, Row 1
-            addParameter ("Arp On", 0.0f, 1.0f, 0.0f, true);
-            if (auto* p = parameters.back()) p->setBinaryLabels ("OFF", "ON");
+            if (auto* p = layout.addParameter ("Arp On", 0.0f, 1.0f, 0.0f, true))
+                p->setBinaryLabels ("OFF", "ON");
 
             std::vector<juce::String> waveforms = { "FM", "Pulse", "Saw", "Sine" };
-            addChoiceParameter ("Waveform", waveforms, 2);
+            layout.addChoiceParameter ("Waveform", waveforms, 2);
 
             std::vector<juce::String> patterns = { "Up", "Down", "Up/Down", "Synth Gate", "Random" };
-            addChoiceParameter ("Pattern", patterns, 0);
+            layout.addChoiceParameter ("Pattern", patterns, 0);
 
-            addParameter ("Volume", 0.0f, 1.0f, 0.7f);
+            layout.addParameter ("Volume", 0.0f, 1.0f, 0.7f);
 
             // Page 1, Row 2
-            addParameter ("Filter", 20.0f, 20000.0f, 20000.0f);
-            addParameter ("Resonance", 0.0f, 1.0f, 0.0f, true);
-            if (auto* p = parameters.back()) p->setBinaryLabels ("OFF", "ON");
-            addSpacer();
-            addSpacer();
+            layout.addParameter ("Filter", 20.0f, 20000.0f, 20000.0f);
+            if (auto* p = layout.addParameter ("Resonance", 0.0f, 1.0f, 0.0f, true))
+                p->setBinaryLabels ("OFF", "ON");
+            layout.addSpacer();
+            layout.addSpacer();
 
             // Page 2, Row 1
-            addParameter ("Delay", 0.0f, 1.0f, 0.0f, true);
-            if (auto* p = parameters.back()) p->setBinaryLabels ("OFF", "ON");
+            if (auto* p = layout.addParameter ("Delay", 0.0f, 1.0f, 0.0f, true))
+                p->setBinaryLabels ("OFF", "ON");
 
             std::vector<juce::String> dlyTimes = { "1/16", "1/8", "1/4", "1/2", "1/1" };
-            addChoiceParameter ("Dly Time", dlyTimes, 1);
-            addParameter ("Dly Mix", 0.0f, 1.0f, 0.3f);
-            addSpacer();
+            layout.addChoiceParameter ("Dly Time", dlyTimes, 1);
+            layout.addParameter ("Dly Mix", 0.0f, 1.0f, 0.3f);
+            layout.addSpacer();
 
             // Page 2, Row 2
-            addParameter ("Reverb", 0.0f, 1.0f, 0.0f, true);
-            if (auto* p = parameters.back()) p->setBinaryLabels ("OFF", "ON");
-            addParameter ("Rvb Time", 0.1f, 10.0f, 1.5f);
-            addParameter ("Rvb Mix", 0.0f, 1.0f, 0.25f);
-            addSpacer();
-
-            moduleNameDisplay.setText ("ARPEGGIATOR", juce::dontSendNotification);
-            lastAdjustedIndex = 0;
+            if (auto* p = layout.addParameter ("Reverb", 0.0f, 1.0f, 0.0f, true))
+                p->setBinaryLabels ("OFF", "ON");
+            layout.addParameter ("Rvb Time", 0.1f, 10.0f, 1.5f);
+            layout.addParameter ("Rvb Mix", 0.0f, 1.0f, 0.25f);
+            layout.addSpacer();
         }
 
     protected:
@@ -353,34 +371,46 @@ namespace neon
     class DrumModule : public ModuleBase
     {
     public:
-        DrumModule (const juce::String& name, const juce::Colour& color)
-            : ModuleBase (name, color)
+        DrumModule (NeonInstance& instance, const juce::String& name, const juce::Colour& color)
+            : ModuleBase (instance, name, color)
+        {
+            addParameters (*this);
+
+            auto& reg = instance.getParameterRegistry();
+            for (int i = 0; i < 16; ++i)
+            {
+                kickSteps[i]  = reg.getParameter (name + "/K " + juce::String (i + 1));
+                snareSteps[i] = reg.getParameter (name + "/S " + juce::String (i + 1));
+                hihatSteps[i] = reg.getParameter (name + "/H " + juce::String (i + 1));
+            }
+
+            moduleNameDisplay.setText ("DRUM MACHINE", juce::dontSendNotification);
+            lastAdjustedIndex = 0;
+        }
+
+        static void addParameters (ParameterLayout& layout)
         {
             // Page 1, Row 1
-            addParameter ("Drum On", 0.0f, 1.0f, 0.0f, true);
-            if (auto* p = parameters.back()) p->setBinaryLabels ("OFF", "ON");
+            if (auto* p = layout.addParameter ("Drum On", 0.0f, 1.0f, 0.0f, true))
+                p->setBinaryLabels ("OFF", "ON");
 
-            addParameter ("HH Tone", 500.0f, 15000.0f, 5000.0f);
-            addParameter ("Snare Rev", 0.0f, 1.0f, 0.3f);
-            addSpacer();
+            layout.addParameter ("HH Tone", 500.0f, 15000.0f, 5000.0f);
+            layout.addParameter ("Snare Rev", 0.0f, 1.0f, 0.3f);
+            layout.addSpacer();
 
             // Page 1, Row 2
-            addSpacer();
-            addSpacer();
-            addSpacer();
-            addSpacer();
+            layout.addSpacer();
+            layout.addSpacer();
+            layout.addSpacer();
+            layout.addSpacer();
 
-            // Register hidden step parameters directly in the registry (not as cards)
-            auto& reg = ParameterRegistry::getInstance();
+            // Hidden step parameters, drawn by the grid instead of as cards
             for (int i = 0; i < 16; ++i)
             {
-                kickSteps[i]  = reg.getOrCreateParameter (name, "K " + juce::String (i + 1), 0.0f, 1.0f, 0.0f, true);
-                snareSteps[i] = reg.getOrCreateParameter (name, "S " + juce::String (i + 1), 0.0f, 1.0f, 0.0f, true);
-                hihatSteps[i] = reg.getOrCreateParameter (name, "H " + juce::String (i + 1), 0.0f, 1.0f, 0.0f, true);
+                layout.addHiddenParameter ("K " + juce::String (i + 1), 0.0f, 1.0f, 0.0f, true);
+                layout.addHiddenParameter ("S " + juce::String (i + 1), 0.0f, 1.0f, 0.0f, true);
+                layout.addHiddenParameter ("H " + juce::String (i + 1), 0.0f, 1.0f, 0.0f, true);
             }
-
-            moduleNameDisplay.setText ("DRUM MACHINE", juce::dontSendNotification);
-            lastAdjustedIndex = 0;
         }
 
     protected:
@@ -528,25 +558,30 @@ namespace neon
     class SplitControlModule : public ModuleBase
     {
     public:
-        SplitControlModule (const juce::String& name, const juce::Colour& color)
-            : ModuleBase (name, color)
+        SplitControlModule (NeonInstance& instance, const juce::String& name, const juce::Colour& color)
+            : ModuleBase (instance, name, color)
         {
-            // Page 1, Row 1
-            addParameter ("Split Point", 24.0f, 84.0f, 60.0f, false, 1.0f, false, true);
-            addChoiceParameter ("Sync Mode", { "Host Sync", "Free Run" }, 0);
-            addParameter ("Master Vol", 0.0f, 1.0f, 0.8f);
-            addSpacer();
-
-            // Page 1, Row 2
-            addSpacer();
-            addSpacer();
-            addSpacer();
-            addSpacer();
+            addParameters (*this);
 
             moduleNameDisplay.setText ("GLOBAL CONTROLS", juce::dontSendNotification);
             lastAdjustedIndex = 0;
         }
 
+        static void addParameters (ParameterLayout& layout)
+        {
+            // Page 1, Row 1
+            layout.addParameter ("Split Point", 24.0f, 84.0f, 60.0f, false, 1.0f, false, true);
+            layout.addChoiceParameter ("Sync Mode", { "Host Sync", "Free Run" }, 0);
+            layout.addParameter ("Master Vol", 0.0f, 1.0f, 0.8f);
+            layout.addSpacer();
+
+            // Page 1, Row 2
+            layout.addSpacer();
+            layout.addSpacer();
+            layout.addSpacer();
+            layout.addSpacer();
+        }
+
     protected:
         void paintVisualization (juce::Graphics& g, juce::Rectangle<int> area) override
         {
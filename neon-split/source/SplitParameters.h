@@ -0,0 +1,25 @@
+#pragma once
+#include <neon_ui_components/neon_ui_components.h>
+#include "SplitModules.h"
+
+namespace neon
+{
+    /**
+     * addNeonSplitParameters
+     * Every Neon Split parameter, registered by the processor before the first patch loads,
+     * including the hidden step grids of the bass and drum sequencers.
+     */
+    static inline void addNeonSplitParameters (NeonInstance& instance)
+    {
+        auto& registry = instance.getParameterRegistry();
+
+        { ParameterLayout l (registry, "Bass");      BassModule::addParameters (l); }
+        { ParameterLayout l (registry, "Pad");       PadModule::addParameters (l); }
+        { ParameterLayout l (registry, "Arp");       ArpSplitModule::addParameters (l); }
+        { ParameterLayout l (registry, "Drums");     DrumModule::addParameters (l); }
+        { ParameterLayout l (registry, "Split");     SplitControlModule::addParameters (l); }
+        { ParameterLayout l (registry, "Librarian"); LibrarianModule::addParameters (l); }
+
+        registry.setLayoutComplete();
+    }
+}
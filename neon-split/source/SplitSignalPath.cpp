@@ -2,8 +2,10 @@
 
 namespace neon
 {
-    SplitSignalPath::SplitSignalPath()
+    SplitSignalPath::SplitSignalPath (NeonInstance& instance)
+        : registry (instance.getParameterRegistry())
     {
+        bindParameters();
     }
 
     void SplitSignalPath::prepareToPlay (double sampleRate, int samplesPerBlock)
@@ -16,6 +18,8 @@ namespace neon
         arpEngine.prepare (sampleRate, samplesPerBlock);
         drumEngine.prepare (sampleRate, samplesPerBlock);
         patternEngine.prepare (sampleRate);
+
+        paramsDirty = true;
     }
 
     void SplitSignalPath::releaseResources()
@@ -32,85 +36,143 @@ namespace neon
         return 0;
     }
 
+    void SplitSignalPath::bindParameters()
+    {
+        handles.splitPoint  = registry.getHandle ("Split", "Split Point", 60.0f);
+        handles.masterVol   = registry.getHandle ("Split", "Master Vol", 0.8f);
+        handles.syncMode    = registry.getHandle ("Split", "Sync Mode", 0.0f);
+
+        handles.bassPreset    = registry.getHandle ("Bass", "Preset", 0.0f);
+        handles.bassLpf       = registry.getHandle ("Bass", "LPF", 20000.0f);
+        handles.bassVolume    = registry.getHandle ("Bass", "Volume", 0.8f);
+        handles.bassDelay     = registry.getHandle ("Bass", "Delay", 0.0f);
+        handles.bassDlyTime   = registry.getHandle ("Bass", "Dly Time", 1.0f);
+        handles.bassDlyMix    = registry.getHandle ("Bass", "Dly Mix", 0.3f);
+        handles.bassPatternOn = registry.getHandle ("Bass", "Pattern On", 0.0f);
+        handles.bassPattern   = registry.getHandle ("Bass", "Pattern", 0.0f);
+        handles.bassStepLen   = registry.getHandle ("Bass", "Step Len", 4.0f);
+
+        handles.padPreset    = registry.getHandle ("Pad", "Preset", 0.0f);
+        handles.padChorus    = registry.getHandle ("Pad", "Chorus", 0.0f);
+        handles.padChorusMix = registry.getHandle ("Pad", "Chorus Mix", 0.5f);
+        handles.padVolume    = registry.getHandle ("Pad", "Volume", 0.8f);
+        handles.padDelay     = registry.getHandle ("Pad", "Delay", 0.0f);
+        handles.padDlyTime   = registry.getHandle ("Pad", "Dly Time", 2.0f);
+        handles.padDlyMix    = registry.getHandle ("Pad", "Dly Mix", 0.25f);
+        handles.padReverb    = registry.getHandle ("Pad", "Reverb", 0.0f);
+        handles.padRvbTime   = registry.getHandle ("Pad", "Rvb Time", 2.5f);
+        handles.padRvbMix    = registry.getHandle ("Pad", "Rvb Mix", 0.35f);
+
+        handles.arpOn        = registry.getHandle ("Arp", "Arp On", 0.0f);
+        handles.arpWaveform  = registry.getHandle ("Arp", "Waveform", 2.0f);
+        handles.arpPattern   = registry.getHandle ("Arp", "Pattern", 0.0f);
+        handles.arpFilter    = registry.getHandle ("Arp", "Filter", 20000.0f);
+        handles.arpResonance = registry.getHandle ("Arp", "Resonance", 0.0f);
+        handles.arpVolume    = registry.getHandle ("Arp", "Volume", 0.7f);
+        handles.arpDelay     = registry.getHandle ("Arp", "Delay", 0.0f);
+        handles.arpDlyTime   = registry.getHandle ("Arp", "Dly Time", 1.0f);
+        handles.arpDlyMix    = registry.getHandle ("Arp", "Dly Mix", 0.3f);
+        handles.arpReverb    = registry.getHandle ("Arp", "Reverb", 0.0f);
+        handles.arpRvbTime   = registry.getHandle ("Arp", "Rvb Time", 1.5f);
+        handles.arpRvbMix    = registry.getHandle ("Arp", "Rvb Mix", 0.25f);
+
+        handles.drumOn       = registry.getHandle ("Drums", "Drum On", 0.0f);
+        handles.drumHhTone   = registry.getHandle ("Drums", "HH Tone", 5000.0f);
+        handles.drumSnareRev = registry.getHandle ("Drums", "Snare Rev", 0.3f);
+
+        for (int i = 0; i < 16; ++i)
+        {
+            auto step = juce::String (i + 1);
+            handles.bassStep[i] = registry.getHandle ("Bass", "Step " + step, 1.0f);
+            handles.drumKick[i]  = registry.getHandle ("Drums", "K " + step, 0.0f);
+            handles.drumSnare[i] = registry.getHandle ("Drums", "S " + step, 0.0f);
+            handles.drumHiHat[i] = registry.getHandle ("Drums", "H " + step, 0.0f);
+        }
+    }
+
     void SplitSignalPath::updateParams()
     {
-        auto& reg = ParameterRegistry::getInstance();
+        // Tempo comes from the host, not the registry, so it is pushed every block
+        bassEngine.setTempo (bpm);
+
+        // Nothing moved anywhere in the registry since the last poll
+        auto generation = registry.getGeneration();
+        if (! paramsDirty && generation == lastParamGeneration)
+            return;
+
+        paramsDirty = false;
+        lastParamGeneration = generation;
 
-        auto getVal = [&](const juce::String& path, float fallback) -> float {
-            if (auto* p = reg.getParameter (path))
-                return p->getValue();
-            return fallback;
+        auto getVal = [&](ParameterHandle h) -> float {
+            return registry.getValue (h);
         };
 
-        auto getInt = [&](const juce::String& path, int fallback) -> int {
-            if (auto* p = reg.getParameter (path))
-                return static_cast<int> (std::round (p->getValue()));
-            return fallback;
+        auto getInt = [&](ParameterHandle h) -> int {
+            return static_cast<int> (std::round (registry.getValue (h)));
         };
 
         // ===== GLOBAL =====
-        splitPoint = getInt ("Split/Split Point", 60);
-        masterVolume = getVal ("Split/Master Vol", 0.8f);
+        splitPoint = getInt (handles.splitPoint);
+        masterVolume = getVal (handles.masterVol);
 
-        int syncIdx = getInt ("Split/Sync Mode", 0);
+        int syncIdx = getInt (handles.syncMode);
         syncMode = (syncIdx == 0) ? SyncMode::HostSync : SyncMode::FreeRun;
 
         // ===== BASS =====
-        bassEngine.setPreset (getInt ("Bass/Preset", 0));
-        bassEngine.setLPFCutoff (getVal ("Bass/LPF", 20000.0f));
-        bassEngine.setVolume (getVal ("Bass/Volume", 0.8f));
-        bassEngine.setDelayEnabled (getVal ("Bass/Delay", 0.0f) > 0.5f);
-        bassEngine.setDelayTime (getInt ("Bass/Dly Time", 1));
-        bassEngine.setDelayMix (getVal ("Bass/Dly Mix", 0.3f));
-        bassEngine.setTempo (bpm);
+        bassEngine.setPreset (getInt (handles.bassPreset));
+        bassEngine.setLPFCutoff (getVal (handles.bassLpf));
+        bassEngine.setVolume (getVal (handles.bassVolume));
+        bassEngine.setDelayEnabled (getVal (handles.bassDelay) > 0.5f);
+        bassEngine.setDelayTime (getInt (handles.bassDlyTime));
+        bassEngine.setDelayMix (getVal (handles.bassDlyMix));
 
-        patternEngine.setBassPatternEnabled (getVal ("Bass/Pattern On", 0.0f) > 0.5f);
-        patternEngine.setBassPattern (static_cast<PatternEngine::BassPattern> (getInt ("Bass/Pattern", 0)));
-        patternEngine.setSequencerStepLength (getInt ("Bass/Step Len", 4));
+        patternEngine.setBassPatternEnabled (getVal (handles.bassPatternOn) > 0.5f);
+        patternEngine.setBassPattern (static_cast<PatternEngine::BassPattern> (getInt (handles.bassPattern)));
+        patternEngine.setSequencerStepLength (getInt (handles.bassStepLen));
 
         for (int i = 0; i < 16; ++i)
         {
-            bool stepOn = getVal ("Bass/Step " + juce::String (i + 1), 1.0f) > 0.5f;
+            bool stepOn = getVal (handles.bassStep[i]) > 0.5f;
             patternEngine.setSequencerStep (i, stepOn);
         }
 
         // ===== PAD =====
-        padEngine.setPreset (getInt ("Pad/Preset", 0));
-        padEngine.setChorusType (getInt ("Pad/Chorus", 0));
-        padEngine.setChorusMix (getVal ("Pad/Chorus Mix", 0.5f));
-        padEngine.setVolume (getVal ("Pad/Volume", 0.8f));
-        padEngine.setDelayEnabled (getVal ("Pad/Delay", 0.0f) > 0.5f);
-        padEngine.setDelayTime (getInt ("Pad/Dly Time", 2));
-        padEngine.setDelayMix (getVal ("Pad/Dly Mix", 0.25f));
-        padEngine.setReverbEnabled (getVal ("Pad/Reverb", 0.0f) > 0.5f);
-        padEngine.setReverbTime (getVal ("Pad/Rvb Time", 2.5f));
-        padEngine.setReverbMix (getVal ("Pad/Rvb Mix", 0.35f));
+        padEngine.setPreset (getInt (handles.padPreset));
+        padEngine.setChorusType (getInt (handles.padChorus));
+        padEngine.setChorusMix (getVal (handles.padChorusMix));
+        padEngine.setVolume (getVal (handles.padVolume));
+        padEngine.setDelayEnabled (getVal (handles.padDelay) > 0.5f);
+        padEngine.setDelayTime (getInt (handles.padDlyTime));
+        padEngine.setDelayMix (getVal (handles.padDlyMix));
+        padEngine.setReverbEnabled (getVal (handles.padReverb) > 0.5f);
+        padEngine.setReverbTime (getVal (handles.padRvbTime));
+        padEngine.setReverbMix (getVal (handles.padRvbMix));
 
         // ===== ARP =====
-        bool arpOn = getVal ("Arp/Arp On", 0.0f) > 0.5f;
+        bool arpOn = getVal (handles.arpOn) > 0.5f;
         arpEngine.setEnabled (arpOn);
         if (arpOn)
         {
-            arpEngine.setWaveform (getInt ("Arp/Waveform", 2));
-            arpEngine.setPattern (getInt ("Arp/Pattern", 0));
-            arpEngine.setFilterCutoff (getVal ("Arp/Filter", 20000.0f));
-            arpEngine.setResonanceEnabled (getVal ("Arp/Resonance", 0.0f) > 0.5f);
-            arpEngine.setVolume (getVal ("Arp/Volume", 0.7f));
-            arpEngine.setDelayEnabled (getVal ("Arp/Delay", 0.0f) > 0.5f);
-            arpEngine.setDelayTime (getInt ("Arp/Dly Time", 1));
-            arpEngine.setDelayMix (getVal ("Arp/Dly Mix", 0.3f));
-            arpEngine.setReverbEnabled (getVal ("Arp/Reverb", 0.0f) > 0.5f);
-            arpEngine.setReverbTime (getVal ("Arp/Rvb Time", 1.5f));
-            arpEngine.setReverbMix (getVal ("Arp/Rvb Mix", 0.25f));
+            arpEngine.setWaveform (getInt (handles.arpWaveform));
+            arpEngine.setPattern (getInt (handles.arpPattern));
+            arpEngine.setFilterCutoff (getVal (handles.arpFilter));
+            arpEngine.setResonanceEnabled (getVal (handles.arpResonance) > 0.5f);
+            arpEngine.setVolume (getVal (handles.arpVolume));
+            arpEngine.setDelayEnabled (getVal (handles.arpDelay) > 0.5f);
+            arpEngine.setDelayTime (getInt (handles.arpDlyTime));
+            arpEngine.setDelayMix (getVal (handles.arpDlyMix));
+            arpEngine.setReverbEnabled (getVal (handles.arpReverb) > 0.5f);
+            arpEngine.setReverbTime (getVal (handles.arpRvbTime));
+            arpEngine.setReverbMix (getVal (handles.arpRvbMix));
         }
 
         // ===== DRUMS =====
-        bool drumOn = getVal ("Drums/Drum On", 0.0f) > 0.5f;
+        bool drumOn = getVal (handles.drumOn) > 0.5f;
         drumEngine.setEnabled (drumOn);
         if (drumOn)
         {
-            drumEngine.setHiHatTone (getVal ("Drums/HH Tone", 5000.0f));
-            drumEngine.setSnareReverbMix (getVal ("Drums/Snare Rev", 0.3f));
+            drumEngine.setHiHatTone (getVal (handles.drumHhTone));
+            drumEngine.setSnareReverbMix (getVal (handles.drumSnareRev));
         }
     }
 
@@ -119,6 +181,11 @@ namespace neon
         int numSamples = buffer.getNumSamples();
         int numChannels = buffer.getNumChannels();
 
+        // The sub-engines are clocked per block, so this block's parameter events
+        // are all applied up front rather than splitting the render
+        registry.beginAudioBlock (numSamples, currentSampleRate);
+        registry.applyParameterEvents (numSamples);
+
         // Poll parameters from the registry
         updateParams();
 
@@ -177,24 +244,20 @@ namespace neon
         juce::AudioBuffer<float> drumBuffer (numChannels, numSamples);
         drumBuffer.clear();
 
-        auto& reg = ParameterRegistry::getInstance();
-
         if (drumEngine.getEnabled() && isPlaying)
         {
             int currentStep = static_cast<int> (std::floor (ppqPosition * 4.0)) % 16;
             if (currentStep != lastDrumStep)
             {
-                auto getStepVal = [&](const juce::String& path) -> bool {
-                    if (auto* p = reg.getParameter (path))
-                        return p->getValue() > 0.5f;
-                    return false;
+                auto getStepVal = [&](ParameterHandle h) -> bool {
+                    return registry.getValue (h) > 0.5f;
                 };
 
-                if (getStepVal ("Drums/K " + juce::String (currentStep + 1)))
+                if (getStepVal (handles.drumKick[currentStep]))
                     drumEngine.triggerKick (0.8f);
-                if (getStepVal ("Drums/S " + juce::String (currentStep + 1)))
+                if (getStepVal (handles.drumSnare[currentStep]))
                     drumEngine.triggerSnare (0.7f);
-                if (getStepVal ("Drums/H " + juce::String (currentStep + 1)))
+                if (getStepVal (handles.drumHiHat[currentStep]))
                     drumEngine.triggerHiHat (0.6f);
 
                 lastDrumStep = currentStep;
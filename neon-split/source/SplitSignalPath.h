@@ -23,7 +23,7 @@ namespace neon
     class SplitSignalPath
     {
     public:
-        SplitSignalPath();
+        explicit SplitSignalPath (NeonInstance& instance);
         ~SplitSignalPath() = default;
 
         void prepareToPlay (double sampleRate, int samplesPerBlock);
@@ -37,6 +37,7 @@ namespace neon
         int getActiveVoicesCount() const;
 
     private:
+        void bindParameters();
         void updateParams();
 
         double currentSampleRate = 44100.0;
@@ -64,6 +65,30 @@ namespace neon
 
         // Drum step tracking
         int lastDrumStep = -1;
+
+        // Registry handles, resolved once in bindParameters()
+        struct ParamHandles
+        {
+            ParameterHandle splitPoint, masterVol, syncMode;
+
+            ParameterHandle bassPreset, bassLpf, bassVolume, bassDelay, bassDlyTime, bassDlyMix;
+            ParameterHandle bassPatternOn, bassPattern, bassStepLen;
+            ParameterHandle bassStep[16];
+
+            ParameterHandle padPreset, padChorus, padChorusMix, padVolume, padDelay, padDlyTime, padDlyMix;
+            ParameterHandle padReverb, padRvbTime, padRvbMix;
+
+            ParameterHandle arpOn, arpWaveform, arpPattern, arpFilter, arpResonance, arpVolume;
+            ParameterHandle arpDelay, arpDlyTime, arpDlyMix, arpReverb, arpRvbTime, arpRvbMix;
+
+            ParameterHandle drumOn, drumHhTone, drumSnareRev;
+            ParameterHandle drumKick[16], drumSnare[16], drumHiHat[16];
+        } handles;
+
+        uint32_t lastParamGeneration = 0;
+        bool paramsDirty = true;
+
+        ParameterRegistry& registry;
     };
 
 } // namespace neon
@@ -67,7 +67,7 @@ float VoiceBase::generateSample(WaveformType waveform, float phase, float pulseW
     switch (waveform)
     {
         case WaveformType::AnalogSine:
-            return std::sin(phase * juce::MathConstants<float>::twoPi);
+            return neon::fastmath::sin2pi(phase);
             
         case WaveformType::AnalogSaw:
         {
@@ -86,8 +86,8 @@ float VoiceBase::generateSample(WaveformType waveform, float phase, float pulseW
         case WaveformType::FM:
         {
             // Simple 2-op FM
-            float modulator = std::sin(phase * juce::MathConstants<float>::twoPi * 2.0f);
-            return std::sin(phase * juce::MathConstants<float>::twoPi + modulator * 2.0f);
+            float modulator = neon::fastmath::sin2pi(phase * 2.0f);
+            return neon::fastmath::sin2pi(phase + modulator * (2.0f / juce::MathConstants<float>::twoPi));
         }
         
         default:
@@ -165,6 +165,6 @@ void VoiceBase::updateEnvelope(Voice& voice, float attackTime, float releaseTime
 
 float VoiceBase::fmOperator(float phase, float modIndex, float modPhase)
 {
-    float modulator = std::sin(modPhase * juce::MathConstants<float>::twoPi);
-    return std::sin(phase * juce::MathConstants<float>::twoPi + modulator * modIndex);
+    float modulator = neon::fastmath::sin2pi(modPhase);
+    return neon::fastmath::sin2pi(phase + modulator * modIndex * (1.0f / juce::MathConstants<float>::twoPi));
 }
@@ -4,7 +4,8 @@
 namespace neon
 {
     NeonTemplateAudioProcessorEditor::NeonTemplateAudioProcessorEditor(NeonTemplateAudioProcessor& p)
-        : AudioProcessorEditor(&p), audioProcessor(p)
+        : AudioProcessorEditor(&p), audioProcessor(p),
+          debugLauncher(p.getNeonInstance().getParameterRegistry())
     {
         setLookAndFeel(&lookAndFeel);
 
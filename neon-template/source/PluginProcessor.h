@@ -1,6 +1,7 @@
 #pragma once
 
 #include <juce_audio_processors/juce_audio_processors.h>
+#include <neon_ui_components/neon_ui_components.h>
 
 namespace neon
 {
@@ -34,6 +35,11 @@ namespace neon
         void getStateInformation (juce::MemoryBlock&) override {}
         void setStateInformation (const void*, int) override {}
 
+        NeonInstance& getNeonInstance() { return neonInstance; }
+
+    private:
+        NeonInstance neonInstance;
+
         JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (NeonTemplateAudioProcessor)
     };
 }